@@ -388,6 +388,7 @@ LOCAL_SRC_FILES                                                  := \
     src/posix/platform/backtrace.cpp                                \
     src/posix/platform/config_file.cpp                              \
     src/posix/platform/daemon.cpp                                   \
+    src/posix/platform/ecdsa_verifier.cpp                           \
     src/posix/platform/entropy.cpp                                  \
     src/posix/platform/firewall.cpp                                 \
     src/posix/platform/hdlc_interface.cpp                           \
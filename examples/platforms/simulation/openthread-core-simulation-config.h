@@ -147,6 +147,14 @@
  */
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 1
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES
+ *
+ * Specifies the maximum number of records tracked by the RAM index of the flash settings driver.
+ *
+ */
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES 64
+
 /**
  * @def CLI_COAP_SECURE_USE_COAP_DEFAULT_HANDLER
  *
@@ -285,4 +293,104 @@
 #define OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+ *
+ * Define to 1 to keep AES contexts with the MAC keys already set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+ *
+ * Define to 1 to maintain a hash index over the EID-to-RLOC cache entries.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+ *
+ * Define to 1 to keep a per-child queue of the indirect messages for sleepy children.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define to 1 to index the child table by RLOC16, extended address and registered IPv6 addresses.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+ *
+ * Define to 1 to index the SRP server hosts and services by name.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+ *
+ * Define to 1 to keep the SRP server hosts and services in lease expiration order.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES
+ *
+ * Specifies the maximum total size (in bytes) of the responses kept in the DNS client response cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES 2048
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+ *
+ * Define to 1 to compile the Leader Network Data into a forwarding table used by route lookups.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+ *
+ * Define to 1 to compile the 6LoWPAN contexts in the Leader Network Data into a table used by context lookups.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE 1
+#endif
+
 #endif // OPENTHREAD_CORE_SIMULATION_CONFIG_H_
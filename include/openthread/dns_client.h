@@ -136,6 +136,38 @@ const otDnsQueryConfig *otDnsClientGetDefaultConfig(otInstance *aInstance);
  */
 void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *aConfig);
 
+/**
+ * This structure represents the DNS client response cache counters.
+ *
+ */
+typedef struct otDnsClientCacheCounters
+{
+    uint32_t mHits;   ///< Number of queries answered from the cache.
+    uint32_t mMisses; ///< Number of queries which were not found in the cache and were sent to the server.
+} otDnsClientCacheCounters;
+
+/**
+ * This function gets the DNS client response cache counters.
+ *
+ * This function requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the DNS client response cache counters.
+ *
+ */
+const otDnsClientCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function removes all the entries from the DNS client response cache.
+ *
+ * This function requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientClearCache(otInstance *aInstance);
+
 /**
  * This type is an opaque representation of a response to an address resolution DNS query.
  *
@@ -242,6 +242,33 @@ typedef struct otMqttsnGatewayInfo {
     otIp6Address mGatewayAddress;
 } otMqttsnGatewayInfo;
 
+/**
+ * This structure contains PUBLISH statistics of a single topic.
+ */
+typedef struct otMqttsnPublishTopicStats {
+    /**
+     * Topic of the published messages. Topic ID, predefined topic ID or short topic name.
+     */
+    otMqttsnTopic mTopic;
+    /**
+     * Number of PUBLISH messages sent or held in the batch for the topic.
+     */
+    uint32_t mPublishCount;
+    /**
+     * Publish rate in messages per second measured over the last completed one second window. It drops to zero once
+     * a whole window elapses without any PUBLISH message for the topic.
+     */
+    uint16_t mRate;
+    /**
+     * Number of PUBLISH messages for the topic currently held in the batch.
+     */
+    uint16_t mQueueDepth;
+    /**
+     * Maximal number of PUBLISH messages for the topic held in the batch at once.
+     */
+    uint16_t mMaxQueueDepth;
+} otMqttsnPublishTopicStats;
+
 /**
  * Declaration of function for connection callback.
  *
@@ -543,6 +570,36 @@ otError otMqttsnPublish(otInstance *aInstance, const uint8_t* aData, int32_t aLe
  */
 otError otMqttsnPublishQosm1(otInstance *aInstance, const uint8_t* aData, int32_t aLength, bool aRetained, const otMqttsnTopic *aTopic, const otIp6Address* aAddress, uint16_t aPort);
 
+/**
+ * Configure batching of QoS 0 and QoS -1 PUBLISH messages.
+ *
+ * When batching is enabled, PUBLISH messages with QoS level 0 or -1 sent to the same gateway are held until the
+ * oldest one was held for @p aLingerTime or until the total size of held messages reaches @p aByteBudget. All held
+ * messages are then sent back-to-back in a single run of the client process task. Batching is bypassed while the
+ * client is asleep. Disabling batching sends all held messages.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aLingerTime  Maximal time in milliseconds a PUBLISH message is held. Zero disables batching.
+ * @param[in]  aByteBudget  Size of held messages in bytes which triggers sending of the batch. Zero for no limit.
+ *
+ * @retval OT_ERROR_NONE  Batching successfully configured.
+ *
+ */
+otError otMqttsnSetPublishBatching(otInstance *aInstance, uint32_t aLingerTime, uint16_t aByteBudget);
+
+/**
+ * Get PUBLISH statistics of the topics the client published to. Statistics are kept for up to
+ * OPENTHREAD_CONFIG_MQTTSN_PUBLISH_TOPIC_STATS_MAX topics.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aBuffer      A pointer to buffer for storing topic statistics.
+ * @param[in]  aBufferSize  Maximal number of items which can be stored in the buffer.
+ *
+ * @returns  Number of topic statistics written in the buffer.
+ *
+ */
+uint16_t otMqttsnGetPublishTopicStats(otInstance *aInstance, otMqttsnPublishTopicStats *aBuffer, uint16_t aBufferSize);
+
 /**
  * Unsubscribe from the topic by topic name string.
  *
@@ -171,9 +171,11 @@ typedef struct otNat64AddressMapping
 {
     uint64_t mId; ///< The unique id for a mapping session.
 
-    otIp4Address mIp4;             ///< The IPv4 address of the mapping.
-    otIp6Address mIp6;             ///< The IPv6 address of the mapping.
-    uint32_t     mRemainingTimeMs; ///< Remaining time before expiry in milliseconds.
+    otIp4Address mIp4;                ///< The IPv4 address of the mapping.
+    otIp6Address mIp6;                ///< The IPv6 address of the mapping.
+    uint16_t     mSrcPortOrId;        ///< The source port or ICMP echo ID of the IPv6 host (zero without NAPT).
+    uint16_t     mTranslatedPortOrId; ///< The translated port or ICMP echo ID on the IPv4 side (zero without NAPT).
+    uint32_t     mRemainingTimeMs;    ///< Remaining time before expiry in milliseconds.
 
     otNat64ProtocolCounters mCounters;
 } otNat64AddressMapping;
@@ -39,6 +39,7 @@
 #include <stdlib.h>
 
 #include <openthread/error.h>
+#include <openthread/instance.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -650,6 +651,50 @@ otError otPlatCryptoEcdsaVerify(const otPlatCryptoEcdsaPublicKey *aPublicKey,
                                 const otPlatCryptoSha256Hash     *aHash,
                                 const otPlatCryptoEcdsaSignature *aSignature);
 
+/**
+ * Start verifying the ECDSA signature of a hashed message asynchronously.
+ *
+ * This function is used by the SRP server when `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE` is enabled.
+ * The platform copies the key, hash and signature, and reports the verification result by calling
+ * `otPlatCryptoEcdsaVerifyAsyncDone()` with @p aRequestId. The result MUST NOT be reported from within this function.
+ *
+ * The default implementation returns `OT_ERROR_NOT_IMPLEMENTED`, in which case OpenThread verifies the signature
+ * with `otPlatCryptoEcdsaVerify()` instead.
+ *
+ * @param[in]  aInstance          The OpenThread instance structure.
+ * @param[in]  aRequestId         The identifier of the request, to be passed to `otPlatCryptoEcdsaVerifyAsyncDone()`.
+ * @param[in]  aPublicKey         A pointer to an ECDSA public key structure where the public key for signature
+ *                                verification is stored.
+ * @param[in]  aHash              A pointer to a SHA-256 hash structure where the hash value for signature verification
+ *                                is stored.
+ * @param[in]  aSignature         A pointer to an ECDSA signature structure where the signature value to be verified is
+ *                                stored.
+ *
+ * @retval OT_ERROR_NONE             The verification was started successfully.
+ * @retval OT_ERROR_NO_BUFS          The platform cannot take any more verification requests for now. OpenThread submits
+ *                                   the request again later.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  Asynchronous verification is not supported by the platform.
+ *
+ */
+otError otPlatCryptoEcdsaVerifyAsync(otInstance                       *aInstance,
+                                     uint32_t                          aRequestId,
+                                     const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                     const otPlatCryptoSha256Hash     *aHash,
+                                     const otPlatCryptoEcdsaSignature *aSignature);
+
+/**
+ * The platform calls this function to report the result of a verification started by
+ * `otPlatCryptoEcdsaVerifyAsync()`.
+ *
+ * This function MUST be called from the OpenThread thread, exactly once for each successfully started verification.
+ *
+ * @param[in]  aInstance          The OpenThread instance structure.
+ * @param[in]  aRequestId         The identifier of the request given to `otPlatCryptoEcdsaVerifyAsync()`.
+ * @param[in]  aError             The result of the verification, as returned by `otPlatCryptoEcdsaVerify()`.
+ *
+ */
+extern void otPlatCryptoEcdsaVerifyAsyncDone(otInstance *aInstance, uint32_t aRequestId, otError aError);
+
 /**
  * Perform PKCS#5 PBKDF2 using CMAC (AES-CMAC-PRF-128).
  *
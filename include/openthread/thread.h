@@ -916,6 +916,25 @@ const otMleCounters *otThreadGetMleCounters(otInstance *aInstance);
  */
 void otThreadResetMleCounters(otInstance *aInstance);
 
+/**
+ * Gets the number of temporary MLE (or TREL MAC) key requests served from the cached keys of the previous and next
+ * key sequences.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The number of temporary key cache hits.
+ *
+ */
+uint32_t otThreadGetTemporaryKeyCacheHits(otInstance *aInstance);
+
+/**
+ * Resets the temporary key cache hits counter.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetTemporaryKeyCacheHits(otInstance *aInstance);
+
 /**
  * This function pointer is called every time an MLE Parent Response message is received.
  *
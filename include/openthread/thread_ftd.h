@@ -552,6 +552,35 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator);
 
+/**
+ * This structure represents the EID-to-RLOC cache counters.
+ *
+ */
+typedef struct otAddressCacheCounters
+{
+    uint32_t mHits;      ///< Number of EID lookups resolved using a cached (or snooped) entry.
+    uint32_t mMisses;    ///< Number of EID lookups for which there was no entry in the cache.
+    uint32_t mEvictions; ///< Number of entries evicted from the cache to make room for a new entry.
+} otAddressCacheCounters;
+
+/**
+ * This function gets the EID-to-RLOC cache counters.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID-to-RLOC cache counters.
+ *
+ */
+const otAddressCacheCounters *otThreadGetAddressCacheCounters(otInstance *aInstance);
+
+/**
+ * This function resets the EID-to-RLOC cache counters.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetAddressCacheCounters(otInstance *aInstance);
+
 /**
  * Get the Thread PSKc
  *
@@ -2718,11 +2718,13 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
      * Partition Id Changes: 1
      * Better Partition Attach Attempts: 0
      * Parent Changes: 0
+     * Temporary Key Cache Hits: 0
      * Done
      * @endcode
      * @cparam counters @ca{mle}
-     * @par api_copy
-     * #otThreadGetMleCounters
+     * @par
+     * Gets the Thread MLE counters (#otThreadGetMleCounters) and the number of temporary key requests served
+     * from the cached keys of the adjacent key sequences (#otThreadGetTemporaryKeyCacheHits).
      */
     else if (aArgs[0] == "mle")
     {
@@ -2752,6 +2754,8 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
             {
                 OutputLine("%s: %u", counter.mName, mleCounters->*counter.mValuePtr);
             }
+
+            OutputLine("Temporary Key Cache Hits: %lu", ToUlong(otThreadGetTemporaryKeyCacheHits(GetInstancePtr())));
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
             {
                 struct MleTimeCounterName
@@ -2784,12 +2788,14 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
          * Done
          * @endcode
          * @cparam counters @ca{mle} reset
-         * @par api_copy
-         * #otThreadResetMleCounters
+         * @par
+         * Resets the Thread MLE counters (#otThreadResetMleCounters) and the temporary key cache hits
+         * (#otThreadResetTemporaryKeyCacheHits).
          */
         else if ((aArgs[1] == "reset") && aArgs[2].IsEmpty())
         {
             otThreadResetMleCounters(GetInstancePtr());
+            otThreadResetTemporaryKeyCacheHits(GetInstancePtr());
         }
         else
         {
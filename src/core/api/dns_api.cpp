@@ -75,6 +75,15 @@ void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+const otDnsClientCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<Dns::Client>().GetCacheCounters();
+}
+
+void otDnsClientClearCache(otInstance *aInstance) { AsCoreType(aInstance).Get<Dns::Client>().ClearCache(); }
+#endif
+
 otError otDnsClientResolveAddress(otInstance             *aInstance,
                                   const char             *aHostName,
                                   otDnsAddressCallback    aCallback,
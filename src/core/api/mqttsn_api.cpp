@@ -159,6 +159,20 @@ otError otMqttsnPublishQosm1(otInstance *aInstance, const uint8_t* aData, int32_
     return client.PublishQosm1(aData, aLength, aRetained, topic, *static_cast<const Ip6::Address *>(aAddress), aPort);
 }
 
+otError otMqttsnSetPublishBatching(otInstance *aInstance, uint32_t aLingerTime, uint16_t aByteBudget)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+    Mqttsn::MqttsnClient &client = instance.Get<Mqttsn::MqttsnClient>();
+    return client.SetPublishBatching(aLingerTime, aByteBudget);
+}
+
+uint16_t otMqttsnGetPublishTopicStats(otInstance *aInstance, otMqttsnPublishTopicStats *aBuffer, uint16_t aBufferSize)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+    Mqttsn::MqttsnClient &client = instance.Get<Mqttsn::MqttsnClient>();
+    return client.GetPublishTopicStats(aBuffer, aBufferSize);
+}
+
 otError otMqttsnUnsubscribe(otInstance *aInstance, const otMqttsnTopic *aTopic, otMqttsnUnsubscribedHandler aHandler, void* aContext)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -436,6 +436,16 @@ const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
 
 void otThreadResetMleCounters(otInstance *aInstance) { AsCoreType(aInstance).Get<Mle::MleRouter>().ResetCounters(); }
 
+uint32_t otThreadGetTemporaryKeyCacheHits(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<KeyManager>().GetTemporaryKeyCacheHits();
+}
+
+void otThreadResetTemporaryKeyCacheHits(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<KeyManager>().ResetTemporaryKeyCacheHits();
+}
+
 void otThreadRegisterParentResponseCallback(otInstance                    *aInstance,
                                             otThreadParentResponseCallback aCallback,
                                             void                          *aContext)
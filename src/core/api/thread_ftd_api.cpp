@@ -264,6 +264,16 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
                                                                           AsCoreType(aIterator));
 }
 
+const otAddressCacheCounters *otThreadGetAddressCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<AddressResolver>().GetCacheCounters();
+}
+
+void otThreadResetAddressCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<AddressResolver>().ResetCacheCounters();
+}
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
 void otThreadSetSteeringData(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
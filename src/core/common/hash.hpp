@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a hash used to select hash table buckets.
+ */
+
+#ifndef HASH_HPP_
+#define HASH_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+namespace ot {
+
+/**
+ * This class implements a (non-cryptographic) hash used to select a bucket or slot in the in-memory hash tables.
+ *
+ */
+class Hash
+{
+public:
+    /**
+     * This constructor initializes the hash computation.
+     *
+     */
+    Hash(void)
+        : mHash(0)
+    {
+    }
+
+    /**
+     * This method feeds a value into the hash computation.
+     *
+     * @param[in]  aValue  The value (e.g., a byte or a 32-bit word of an address).
+     *
+     */
+    void Update(uint32_t aValue) { mHash = (mHash ^ aValue) * kMultiplier; }
+
+    /**
+     * This method gets the bucket index from the current hash value.
+     *
+     * Only the high bits of the hash value depend on all the bits fed into it (e.g., on the last byte of sequentially
+     * assigned IIDs). They are folded into the low bits before the bucket index is selected.
+     *
+     * @param[in]  aNumBuckets  The number of buckets.
+     *
+     * @returns The bucket index, in the range `[0, aNumBuckets)`.
+     *
+     */
+    uint16_t GetBucket(uint16_t aNumBuckets) const
+    {
+        uint32_t hash = mHash;
+
+        hash ^= hash >> 16;
+        hash *= kFinalMultiplier;
+        hash ^= hash >> 13;
+
+        return static_cast<uint16_t>(hash % aNumBuckets);
+    }
+
+private:
+    static constexpr uint32_t kMultiplier      = 0x9e3779b1;
+    static constexpr uint32_t kFinalMultiplier = 0x85ebca6b;
+
+    uint32_t mHash;
+};
+
+} // namespace ot
+
+#endif // HASH_HPP_
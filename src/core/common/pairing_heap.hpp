@@ -0,0 +1,323 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic intrusive pairing heap.
+ */
+
+#ifndef PAIRING_HEAP_HPP_
+#define PAIRING_HEAP_HPP_
+
+#include "openthread-core-config.h"
+
+#include "common/code_utils.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+
+/**
+ * This template class implements an intrusive pairing heap.
+ *
+ * The heap provides O(1) insert and access to the first entry, and O(log n) amortized removal of any entry.
+ *
+ * The `Type` class should contain `mNext`, `mChild` and `mPrev` member variables (pointers to `Type`) which are used
+ * by the heap to link the entries: `mChild` is the first child, `mNext` the next sibling and `mPrev` the previous
+ * sibling (or the parent for the first child) of the entry. If these members are private, `Type` should declare
+ * `PairingHeap<Type>` as a friend. An entry that is not in the heap has `mNext` pointing to itself.
+ *
+ * The entries are ordered using a `Comparator` object passed to the methods which modify the heap. It should provide
+ * the following method, returning whether `aFirst` should come before `aSecond` in the heap:
+ *
+ *     bool Comparator::IsBefore(const Type &aFirst, const Type &aSecond) const
+ *
+ * The same ordering should be used for all the operations on a heap.
+ *
+ */
+template <typename Type> class PairingHeap : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the heap as empty.
+     *
+     */
+    PairingHeap(void)
+        : mRoot(nullptr)
+    {
+    }
+
+    /**
+     * This method indicates whether the heap is empty.
+     *
+     * @retval TRUE   The heap is empty.
+     * @retval FALSE  The heap is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return (mRoot == nullptr); }
+
+    /**
+     * This method returns the first entry in the heap.
+     *
+     * @returns A pointer to the first entry, or `nullptr` if the heap is empty.
+     *
+     */
+    Type *GetHead(void) { return mRoot; }
+
+    /**
+     * This method returns the first entry in the heap.
+     *
+     * @returns A pointer to the first entry, or `nullptr` if the heap is empty.
+     *
+     */
+    const Type *GetHead(void) const { return mRoot; }
+
+    /**
+     * This method indicates whether an entry is in a heap.
+     *
+     * @param[in] aEntry  The entry.
+     *
+     * @retval TRUE   The entry is in a heap.
+     * @retval FALSE  The entry is not in a heap.
+     *
+     */
+    static bool IsInHeap(const Type &aEntry) { return (aEntry.mNext != &aEntry); }
+
+    /**
+     * This method marks an entry as not being in any heap.
+     *
+     * This method should be used to initialize an entry before it is added to a heap for the first time.
+     *
+     * @param[in] aEntry  The entry.
+     *
+     */
+    static void MarkAsNotInHeap(Type &aEntry)
+    {
+        aEntry.mNext  = &aEntry;
+        aEntry.mChild = nullptr;
+        aEntry.mPrev  = nullptr;
+    }
+
+    /**
+     * This method adds an entry to the heap.
+     *
+     * The entry MUST not be in the heap (it should be removed first if its order has changed).
+     *
+     * @param[in] aEntry       The entry to add.
+     * @param[in] aComparator  The comparator defining the order of the entries.
+     *
+     */
+    template <typename Comparator> void Add(Type &aEntry, const Comparator &aComparator)
+    {
+        aEntry.mChild = nullptr;
+        aEntry.mNext  = nullptr;
+        aEntry.mPrev  = nullptr;
+
+        if (mRoot == nullptr)
+        {
+            mRoot = &aEntry;
+        }
+        else
+        {
+            mRoot        = Meld(*mRoot, aEntry, aComparator);
+            mRoot->mNext = nullptr;
+            mRoot->mPrev = nullptr;
+        }
+    }
+
+    /**
+     * This method removes an entry from the heap.
+     *
+     * This method does nothing if the entry is not in a heap. Otherwise, the entry MUST be in this heap.
+     *
+     * @param[in] aEntry       The entry to remove.
+     * @param[in] aComparator  The comparator defining the order of the entries.
+     *
+     */
+    template <typename Comparator> void Remove(Type &aEntry, const Comparator &aComparator)
+    {
+        VerifyOrExit(IsInHeap(aEntry));
+
+        if (mRoot == &aEntry)
+        {
+            mRoot = (aEntry.mChild != nullptr) ? MergePairs(*aEntry.mChild, aComparator) : nullptr;
+        }
+        else
+        {
+            if (aEntry.mPrev->mChild == &aEntry)
+            {
+                aEntry.mPrev->mChild = aEntry.mNext;
+            }
+            else
+            {
+                aEntry.mPrev->mNext = aEntry.mNext;
+            }
+
+            if (aEntry.mNext != nullptr)
+            {
+                aEntry.mNext->mPrev = aEntry.mPrev;
+            }
+
+            // All the entries under `aEntry` come after the root, so
+            // the merged heap of its children is added as a child of
+            // the root.
+
+            if (aEntry.mChild != nullptr)
+            {
+                AddChild(*mRoot, *MergePairs(*aEntry.mChild, aComparator));
+            }
+        }
+
+        MarkAsNotInHeap(aEntry);
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method removes all the entries from the heap.
+     *
+     */
+    void RemoveAll(void)
+    {
+        // Walks the heap using a list of pending entries (linked
+        // through `mNext`), adding the children of each removed entry
+        // to it.
+
+        Type *pending = mRoot;
+
+        mRoot = nullptr;
+
+        while (pending != nullptr)
+        {
+            Type *entry = pending;
+            Type *child = entry->mChild;
+
+            pending = entry->mNext;
+
+            while (child != nullptr)
+            {
+                Type *nextChild = child->mNext;
+
+                child->mNext = pending;
+                pending      = child;
+                child        = nextChild;
+            }
+
+            MarkAsNotInHeap(*entry);
+        }
+    }
+
+private:
+    static void AddChild(Type &aParent, Type &aChild)
+    {
+        aChild.mPrev = &aParent;
+        aChild.mNext = aParent.mChild;
+
+        if (aParent.mChild != nullptr)
+        {
+            aParent.mChild->mPrev = &aChild;
+        }
+
+        aParent.mChild = &aChild;
+    }
+
+    template <typename Comparator> static Type *Meld(Type &aFirst, Type &aSecond, const Comparator &aComparator)
+    {
+        // Melds two heaps, the root coming later becomes the first
+        // child of the other one. The sibling pointers of the returned
+        // root are left unchanged.
+
+        Type *root = &aFirst;
+
+        if (aComparator.IsBefore(aSecond, aFirst))
+        {
+            root = &aSecond;
+            AddChild(aSecond, aFirst);
+        }
+        else
+        {
+            AddChild(aFirst, aSecond);
+        }
+
+        return root;
+    }
+
+    template <typename Comparator> static Type *MergePairs(Type &aFirst, const Comparator &aComparator)
+    {
+        // Merges a list of sibling heaps (linked through `mNext`) into
+        // a single heap using the two-pass pairing. The first pass
+        // melds the siblings in pairs from left to right, pushing the
+        // results on a stack (linked through `mNext`). The second pass
+        // melds the heaps on the stack, i.e., from right to left.
+
+        Type *stack = nullptr;
+        Type *next  = &aFirst;
+        Type *root;
+
+        while (next != nullptr)
+        {
+            Type *first  = next;
+            Type *second = first->mNext;
+
+            if (second != nullptr)
+            {
+                next  = second->mNext;
+                first = Meld(*first, *second, aComparator);
+            }
+            else
+            {
+                next = nullptr;
+            }
+
+            first->mNext = stack;
+            stack        = first;
+        }
+
+        root  = stack;
+        stack = stack->mNext;
+
+        while (stack != nullptr)
+        {
+            Type *heap = stack;
+
+            stack = stack->mNext;
+            root  = Meld(*root, *heap, aComparator);
+        }
+
+        root->mNext = nullptr;
+        root->mPrev = nullptr;
+
+        return root;
+    }
+
+    Type *mRoot;
+};
+
+} // namespace ot
+
+#endif // PAIRING_HEAP_HPP_
@@ -0,0 +1,129 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a meter measuring the rate of events.
+ */
+
+#ifndef RATE_METER_HPP_
+#define RATE_METER_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace ot {
+
+/**
+ * This template class implements a meter measuring the rate of events per second over fixed-length windows.
+ *
+ * The rate is the number of events counted in the last completed window. It is evaluated at the time it is read, so it
+ * drops to zero once a whole window has elapsed without any event, even if no event is counted anymore.
+ *
+ * @tparam kWindow  The measurement window in milliseconds.
+ *
+ */
+template <uint32_t kWindow> class RateMeter
+{
+    static_assert(kWindow > 0, "kWindow must not be zero");
+
+public:
+    /**
+     * This method starts the measurement.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     */
+    void Start(TimeMilli aNow)
+    {
+        mWindowStart = aNow;
+        mWindowCount = 0;
+        mLastCount   = 0;
+    }
+
+    /**
+     * This method counts an event.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     */
+    void Count(TimeMilli aNow)
+    {
+        uint32_t numWindows = (aNow - mWindowStart) / kWindow;
+
+        if (numWindows > 0)
+        {
+            mLastCount = (numWindows == 1) ? mWindowCount : 0;
+            mWindowStart += numWindows * kWindow;
+            mWindowCount = 0;
+        }
+
+        mWindowCount++;
+    }
+
+    /**
+     * This method gets the rate of events.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     * @returns The number of events per second in the last completed window.
+     *
+     */
+    uint16_t GetRate(TimeMilli aNow) const
+    {
+        uint32_t numWindows = (aNow - mWindowStart) / kWindow;
+        uint32_t count;
+
+        switch (numWindows)
+        {
+        case 0:
+            count = mLastCount;
+            break;
+        case 1:
+            count = mWindowCount;
+            break;
+        default:
+            count = 0;
+            break;
+        }
+
+        return static_cast<uint16_t>(count * 1000 / kWindow);
+    }
+
+private:
+    TimeMilli mWindowStart;
+    uint32_t  mWindowCount;
+    uint32_t  mLastCount;
+};
+
+} // namespace ot
+
+#endif // RATE_METER_HPP_
@@ -38,6 +38,7 @@
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
+#include "common/serial_number.hpp"
 
 namespace ot {
 
@@ -103,6 +104,61 @@ void TimerMilli::Stop(void) { Get<Scheduler>().Remove(*this); }
 
 void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().RemoveAll(); }
 
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
+bool Timer::Scheduler::FireOrder::IsBefore(const Timer &aFirstTimer, const Timer &aSecondTimer) const
+{
+    // Timers with the same fire time are ordered by when they were
+    // started (same as a sorted list).
+
+    bool retval = aFirstTimer.DoesFireBefore(aSecondTimer, mNow);
+
+    if (!retval && (aFirstTimer.mFireTime == aSecondTimer.mFireTime))
+    {
+        retval = SerialNumber::IsLess(aFirstTimer.mSequence, aSecondTimer.mSequence);
+    }
+
+    return retval;
+}
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mSequence = mSequence++;
+    mHeap.Add(aTimer, FireOrder(Time(aAlarmApi.AlarmGetNow())));
+
+    if (mHeap.GetHead() == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    bool wasHead = (mHeap.GetHead() == &aTimer);
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    mHeap.Remove(aTimer, FireOrder(Time(aAlarmApi.AlarmGetNow())));
+
+    if (wasHead)
+    {
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    mHeap.RemoveAll();
+    SetAlarm(aAlarmApi);
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -151,15 +207,30 @@ exit:
     return;
 }
 
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    while ((timer = mTimerList.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#endif // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
 void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    Timer *timer = GetHead();
+
+    if (timer == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer   *timer = mTimerList.GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
@@ -171,7 +242,7 @@ void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
@@ -191,18 +262,6 @@ exit:
     return;
 }
 
-void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
-{
-    Timer *timer;
-
-    while ((timer = mTimerList.Pop()) != nullptr)
-    {
-        timer->SetNext(timer);
-    }
-
-    SetAlarm(aAlarmApi);
-}
-
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
@@ -46,6 +46,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pairing_heap.hpp"
 #include "common/tasklet.hpp"
 #include "common/time.hpp"
 
@@ -68,6 +69,9 @@ namespace ot {
 class Timer : public InstanceLocator, public LinkedListEntry<Timer>
 {
     friend class LinkedListEntry<Timer>;
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    friend class PairingHeap<Timer>;
+#endif
 
 public:
     /**
@@ -116,6 +120,9 @@ protected:
 
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+            , mSequence(0)
+#endif
         {
         }
 
@@ -125,13 +132,44 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+        // The running timers are kept in a pairing heap (the first
+        // timer to fire is at its head).
+
+        class FireOrder
+        {
+        public:
+            explicit FireOrder(Time aNow)
+                : mNow(aNow)
+            {
+            }
+
+            bool IsBefore(const Timer &aFirstTimer, const Timer &aSecondTimer) const;
+
+        private:
+            Time mNow;
+        };
+
+        Timer *GetHead(void) { return mHeap.GetHead(); }
+
+        PairingHeap<Timer> mHeap;
+        uint32_t           mSequence;
+#else
+        Timer *GetHead(void) { return mTimerList.GetHead(); }
+
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+        , mChild(nullptr)
+        , mPrev(nullptr)
+        , mSequence(0)
+#endif
     {
     }
 
@@ -141,6 +179,11 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    Timer   *mChild;
+    Timer   *mPrev;
+    uint32_t mSequence; // Order in which timers were started, used for timers with the same fire time.
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
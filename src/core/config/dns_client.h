@@ -150,4 +150,43 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_RECURSION_DESIRED_FLAG 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ * When enabled, successful responses are kept (keyed by query name, query type and server socket address) for the
+ * minimum TTL of the records in their answer and additional data sections. A later query for the same name and type
+ * sent to the same server is then answered from the cache by invoking the response callback directly from the call
+ * starting the query, without sending any message. When the cache is full, the least recently used responses are
+ * evicted.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of responses kept in the DNS client response cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES
+ *
+ * Specifies the maximum total size (in bytes) of the responses kept in the DNS client response cache.
+ *
+ * The cached responses are stored in message buffers, so this value also bounds the number of message buffers used
+ * by the cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES 1024
+#endif
+
 #endif // CONFIG_DNS_CLIENT_H_
@@ -521,4 +521,17 @@
 #define OPENTHREAD_CONFIG_MAC_OUTGOING_BEACON_PAYLOAD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+ *
+ * Define to 1 for `SubMac` to keep an AES context with the key already set (expanded) for each of its MAC keys (for
+ * key ID mode 1), so that the AES CCM processing of frames does not set (expand) the key on every frame.
+ *
+ * This adds three AES contexts (`OPENTHREAD_CONFIG_AES_CONTEXT_SIZE` or the mbedTLS AES context size each).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE 0
+#endif
+
 #endif // CONFIG_MAC_H_
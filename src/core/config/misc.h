@@ -215,6 +215,33 @@
 #define OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+ *
+ * Define as 1 for `IndirectSender` to keep a per-child queue of references to the messages in the send queue destined
+ * to each sleepy child, so that the next indirect message for a child is found without searching the send queue.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENTRIES
+ *
+ * The number of message references shared by the per-child indirect queues. A message destined to several sleepy
+ * children (e.g., multicast) uses one reference per child.
+ *
+ * When there is no free reference to queue a message for a child, the queue of that child is dropped and its indirect
+ * messages are looked up by searching the send queue until it has no more messages for the child.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENTRIES
+#define OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENTRIES OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
  *
@@ -403,6 +430,23 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES
+ *
+ * Specifies the maximum number of records tracked by the RAM index of the flash settings driver. Each entry uses
+ * 8 bytes of RAM. The index maps a key and an index to the offset of a record so that reads and deletes do not need
+ * to scan the whole flash area. If the number of valid records exceeds this limit, the driver falls back to scanning
+ * the flash until the index can be rebuilt (on the next swap or wipe).
+ *
+ * Define to 0 to disable the index.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -641,4 +685,64 @@
 #define OPENTHREAD_CONFIG_ALLOW_EMPTY_NETWORK_NAME 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+ *
+ * Define as 1 to compile the Leader Network Data into a forwarding table which is used by route lookups (instead of
+ * parsing the Network Data TLVs on every lookup).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_MAX_PREFIXES
+ *
+ * Specifies the maximum number of Prefix TLVs in the Network Data forwarding table.
+ *
+ * If the Network Data contains more Prefix TLVs, the route lookups fall back to parsing the Network Data TLVs.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_MAX_PREFIXES
+#define OPENTHREAD_CONFIG_NETDATA_FIB_MAX_PREFIXES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_MAX_ROUTES
+ *
+ * Specifies the maximum number of route RLOC16 entries (external and default routes) in the Network Data forwarding
+ * table.
+ *
+ * If more entries are needed, the route lookups fall back to parsing the Network Data TLVs.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_MAX_ROUTES
+#define OPENTHREAD_CONFIG_NETDATA_FIB_MAX_ROUTES 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+ *
+ * Define as 1 to compile the 6LoWPAN contexts in the Leader Network Data into a table indexed by Context ID and sorted
+ * by prefix length, which is used by the context lookups (instead of parsing the Network Data TLVs on every lookup).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+ *
+ * Define as 1 for the timer scheduler (used by both `TimerMilli` and `TimerMicro`) to keep the running timers in a
+ * pairing heap (O(1) insert, O(log n) amortized remove) instead of a sorted linked list (O(n) insert and remove).
+ *
+ * The pairing heap adds two pointers and a `uint32_t` to every timer.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE 0
+#endif
+
 #endif // CONFIG_MISC_H_
@@ -58,6 +58,19 @@
 #define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define as 1 to index the child table by RLOC16, extended address and registered IPv6 addresses.
+ *
+ * When enabled, child lookups by MAC address and the check for sleepy children subscribed to a multicast address use
+ * small hash tables instead of scanning all child entries. This is useful on devices supporting many children.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT
  *
@@ -55,4 +55,14 @@
 #define OPENTHREAD_CONFIG_MQTTSN_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MQTTSN_PUBLISH_TOPIC_STATS_MAX
+ *
+ * Maximal number of topics for which MQTT-SN client keeps PUBLISH statistics.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MQTTSN_PUBLISH_TOPIC_STATS_MAX
+#define OPENTHREAD_CONFIG_MQTTSN_PUBLISH_TOPIC_STATS_MAX 8
+#endif
+
 #endif // CONFIG_MQTTSN_H_
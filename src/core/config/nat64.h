@@ -65,6 +65,50 @@
 #define OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS 7200
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+ *
+ * Define to 1 to enable port translation (NAPT) in the NAT64 translator.
+ *
+ * When enabled, a mapping is created for each (IPv6 source address, protocol, source port or ICMP echo identifier)
+ * and is assigned a port (or ICMP echo identifier) on an IPv4 address of the configured CIDR, so that many IPv6 hosts
+ * can share a single IPv4 address. Otherwise, each IPv6 host is mapped to its own IPv4 address.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+#define OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS
+ *
+ * Specifies timeout in seconds before removing an inactive UDP mapping when port translation is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS
+#define OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS 300
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS
+ *
+ * Specifies timeout in seconds before removing an inactive TCP mapping when port translation is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS
+#define OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS 7440
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS
+ *
+ * Specifies timeout in seconds before removing an inactive ICMP echo mapping when port translation is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS
+#define OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS 60
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
  *
@@ -109,4 +109,73 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+ *
+ * Define to 1 to index the registered hosts and services by host full name, service name and service instance name.
+ *
+ * When enabled, the SRP server keeps hash chains over its hosts and services so that name conflict checks and DNS-SD
+ * queries resolved from the SRP registry do not need to walk all the registered hosts and services.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+ *
+ * Define to 1 to keep the registered hosts and services in queues ordered by the expiration time of their LEASE or
+ * KEY-LEASE.
+ *
+ * When enabled, the lease timer handler only visits the hosts and services whose lease has expired, instead of all the
+ * registered hosts and services. This adds three pointers and a time value to every host and service.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+ *
+ * Define to 1 to let the platform verify the SIG(0) signature of received SRP updates asynchronously.
+ *
+ * When enabled, a received SRP update is parsed and then kept by the SRP server until the platform reports the result
+ * of the signature verification through `otPlatCryptoEcdsaVerifyAsyncDone()`. The updates are completed in the order
+ * they were received. If the platform does not implement `otPlatCryptoEcdsaVerifyAsync()`, the signature is verified
+ * synchronously and the update is completed from a tasklet.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_IN_FLIGHT
+ *
+ * Specifies the maximum number of signature verifications the SRP server submits to the platform at the same time.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_IN_FLIGHT
+#define OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_IN_FLIGHT 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_PENDING
+ *
+ * Specifies the maximum number of received SRP updates waiting for their signature verification.
+ *
+ * An SRP update received while this many updates are waiting is rejected with a server failure response, so that the
+ * client retries it later.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_PENDING
+#define OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_PENDING 32
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
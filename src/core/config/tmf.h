@@ -56,6 +56,20 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+ *
+ * Define as 1 to maintain a hash index (keyed by EID) over the EID-to-RLOC cache entries.
+ *
+ * The index avoids a linear search of the cache lists when looking up an EID which is not in the cache and speeds up
+ * the search for one which is. It uses `2 * OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES` additional `uint16_t` slots
+ * and is mainly useful when the number of cache entries is large (e.g., on a border router).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT
  *
@@ -121,7 +121,7 @@ void AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mEcb->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -169,7 +169,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -183,7 +183,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -194,23 +194,53 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 {
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
+    uint32_t length          = aLength;
     uint8_t  byte;
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    // Process whole blocks in a single pass (one CTR and one CBC-MAC
+    // block per iteration) while both are at a block boundary.
+
+    while ((length >= AesEcb::kBlockSize) && (mCtrLength == sizeof(mCtrPad)) &&
+           ((mBlockLength == 0) || (mBlockLength == sizeof(mBlock))))
     {
-        if (mCtrLength == 16)
+        IncrementCounter();
+        mEcb->Encrypt(mCtr, mCtrPad);
+
+        if (mBlockLength == sizeof(mBlock))
+        {
+            mEcb->Encrypt(mBlock, mBlock);
+        }
+
+        for (uint8_t i = 0; i < AesEcb::kBlockSize; i++)
         {
-            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+            if (aMode == kEncrypt)
+            {
+                byte               = plaintextBytes[i];
+                ciphertextBytes[i] = byte ^ mCtrPad[i];
+            }
+            else
             {
-                if (++mCtr[j])
-                {
-                    break;
-                }
+                byte              = ciphertextBytes[i] ^ mCtrPad[i];
+                plaintextBytes[i] = byte;
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mBlock[i] ^= byte;
+        }
+
+        mBlockLength = sizeof(mBlock);
+        plaintextBytes += AesEcb::kBlockSize;
+        ciphertextBytes += AesEcb::kBlockSize;
+        length -= AesEcb::kBlockSize;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (mCtrLength == 16)
+        {
+            IncrementCounter();
+            mEcb->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -227,7 +257,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -240,7 +270,8 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
+            mBlockLength = 0;
         }
 
         // reset counter
@@ -269,7 +300,7 @@ void AesCcm::Finalize(void *aTag)
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    mEcb->Encrypt(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
@@ -277,6 +308,17 @@ void AesCcm::Finalize(void *aTag)
     }
 }
 
+void AesCcm::IncrementCounter(void)
+{
+    for (int i = sizeof(mCtr) - 1; i > mNonceLength; i--)
+    {
+        if (++mCtr[i])
+        {
+            break;
+        }
+    }
+}
+
 void AesCcm::GenerateNonce(const Mac::ExtAddress &aAddress,
                            uint32_t               aFrameCounter,
                            uint8_t                aSecurityLevel,
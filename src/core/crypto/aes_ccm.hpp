@@ -41,6 +41,7 @@
 #include <openthread/platform/crypto.h>
 #include "common/error.hpp"
 #include "common/message.hpp"
+#include "common/non_copyable.hpp"
 #include "common/type_traits.hpp"
 #include "crypto/aes_ecb.hpp"
 #include "crypto/storage.hpp"
@@ -60,7 +61,7 @@ namespace Crypto {
  * This class implements AES CCM computation.
  *
  */
-class AesCcm
+class AesCcm : private NonCopyable
 {
 public:
     static constexpr uint8_t kMinTagLength = 4;                  ///< Minimum tag length (in bytes).
@@ -77,13 +78,26 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    AesCcm(void)
+        : mEcb(&mOwnEcb)
+    {
+    }
+
     /**
      * This method sets the key.
      *
      * @param[in]  aKey    Crypto Key used in AES operation
      *
      */
-    void SetKey(const Key &aKey) { mEcb.SetKey(aKey); }
+    void SetKey(const Key &aKey)
+    {
+        mEcb = &mOwnEcb;
+        mOwnEcb.SetKey(aKey);
+    }
 
     /**
      * This method sets the key.
@@ -102,6 +116,17 @@ public:
      */
     void SetKey(const Mac::KeyMaterial &aMacKey);
 
+    /**
+     * This method sets the key to use from an `AesEcb` whose key is already set.
+     *
+     * This skips the AES key expansion, so it can be used when the same key is used for many AES CCM computations.
+     * @p aKeyedEcb is used (not copied) and MUST remain valid and keep its key during the AES CCM computation.
+     *
+     * @param[in]  aKeyedEcb   An `AesEcb` with its key set.
+     *
+     */
+    void SetKey(AesEcb &aKeyedEcb) { mEcb = &aKeyedEcb; }
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -199,7 +224,10 @@ public:
                               uint8_t               *aNonce);
 
 private:
-    AesEcb   mEcb;
+    void IncrementCounter(void);
+
+    AesEcb   mOwnEcb;
+    AesEcb  *mEcb;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
@@ -741,3 +741,22 @@ OT_TOOL_WEAK void otPlatCryptoPbkdf2GenerateKey(const uint8_t *aPassword,
 }
 
 #endif // #if OPENTHREAD_FTD
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+OT_TOOL_WEAK otError otPlatCryptoEcdsaVerifyAsync(otInstance                       *aInstance,
+                                                  uint32_t                          aRequestId,
+                                                  const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                                  const otPlatCryptoSha256Hash     *aHash,
+                                                  const otPlatCryptoEcdsaSignature *aSignature)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aRequestId);
+    OT_UNUSED_VARIABLE(aPublicKey);
+    OT_UNUSED_VARIABLE(aHash);
+    OT_UNUSED_VARIABLE(aSignature);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
@@ -1575,7 +1575,7 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         ExitNow();
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey, mLinks.GetSubMac().GetKeyedAesEcb(*macKey)));
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1695,7 +1695,7 @@ Error Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
-    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey, mLinks.GetSubMac().GetKeyedAesEcb(*macKey));
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
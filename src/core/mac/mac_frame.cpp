@@ -1140,10 +1140,11 @@ void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 #endif
 }
 
-void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb *aKeyedEcb)
 {
 #if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
     OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aKeyedEcb);
 #else
     uint32_t       frameCounter = 0;
     uint8_t        securityLevel;
@@ -1158,7 +1159,15 @@ void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey());
+    if (aKeyedEcb != nullptr)
+    {
+        aesCcm.SetKey(*aKeyedEcb);
+    }
+    else
+    {
+        aesCcm.SetKey(GetAesKey());
+    }
+
     tagLength = GetFooterLength() - GetFcsSize();
 
     aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -1302,11 +1311,14 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 
-Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey)
+Error RxFrame::ProcessReceiveAesCcm(const ExtAddress  &aExtAddress,
+                                    const KeyMaterial &aMacKey,
+                                    Crypto::AesEcb    *aKeyedEcb)
 {
 #if OPENTHREAD_RADIO
     OT_UNUSED_VARIABLE(aExtAddress);
     OT_UNUSED_VARIABLE(aMacKey);
+    OT_UNUSED_VARIABLE(aKeyedEcb);
 
     return kErrorNone;
 #else
@@ -1325,7 +1337,15 @@ Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMate
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aMacKey);
+    if (aKeyedEcb != nullptr)
+    {
+        aesCcm.SetKey(*aKeyedEcb);
+    }
+    else
+    {
+        aesCcm.SetKey(aMacKey);
+    }
+
     tagLength = GetFooterLength() - GetFcsSize();
 
     aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -42,6 +42,7 @@
 #include "common/as_core_type.hpp"
 #include "common/const_cast.hpp"
 #include "common/encoding.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "mac/mac_types.hpp"
 #include "meshcop/network_name.hpp"
 
@@ -1168,7 +1169,25 @@ public:
      * @retval kErrorSecurity  Received frame MIC check failed.
      *
      */
-    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey)
+    {
+        return ProcessReceiveAesCcm(aExtAddress, aMacKey, nullptr);
+    }
+
+    /**
+     * This method performs AES CCM on the frame which is received, optionally using an `AesEcb` with the MAC key
+     * already set (expanded).
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame.
+     * @param[in]  aKeyedEcb    A pointer to an `AesEcb` with @p aMacKey set, or `nullptr` to use @p aMacKey.
+     *
+     * @retval kErrorNone      Process of received frame AES CCM succeeded.
+     * @retval kErrorSecurity  Received frame MIC check failed.
+     *
+     */
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey, Crypto::AesEcb *aKeyedEcb);
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
@@ -1314,7 +1333,19 @@ public:
      *                          for AES CCM computation.
      *
      */
-    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress) { ProcessTransmitAesCcm(aExtAddress, nullptr); }
+
+    /**
+     * This method performs AES CCM on the frame which is going to be sent, optionally using an `AesEcb` with the
+     * frame's AES key already set (expanded).
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aKeyedEcb    A pointer to an `AesEcb` with the AES key (`GetAesKey()`) set, or `nullptr` to use
+     *                          the AES key.
+     *
+     */
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb *aKeyedEcb);
 
     /**
      * This method indicates whether or not the frame has security processed.
@@ -90,6 +90,9 @@ void SubMac::Init(void)
     mPrevKey.Clear();
     mCurrKey.Clear();
     mNextKey.Clear();
+#if OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+    mKeyedAesEcbsValid = false;
+#endif
 
     mFrameCounter = 0;
     mKeyId        = 0;
@@ -399,7 +402,7 @@ void SubMac::ProcessTransmitSecurity(void)
     VerifyOrExit(mTransmitFrame.GetTimeIeOffset() == 0);
 #endif
 
-    mTransmitFrame.ProcessTransmitAesCcm(*extAddress);
+    mTransmitFrame.ProcessTransmitAesCcm(*extAddress, GetKeyedAesEcb(GetCurrentMacKey()));
 
 exit:
     return;
@@ -931,6 +934,9 @@ void SubMac::SetMacKey(uint8_t            aKeyIdMode,
         mPrevKey = aPrevKey;
         mCurrKey = aCurrKey;
         mNextKey = aNextKey;
+#if OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+        UpdateKeyedAesEcbs();
+#endif
         break;
 
     default:
@@ -946,6 +952,47 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+void SubMac::UpdateKeyedAesEcbs(void)
+{
+    Crypto::Key cryptoKey;
+
+    mPrevKey.ConvertToCryptoKey(cryptoKey);
+    mPrevKeyAesEcb.SetKey(cryptoKey);
+
+    mCurrKey.ConvertToCryptoKey(cryptoKey);
+    mCurrKeyAesEcb.SetKey(cryptoKey);
+
+    mNextKey.ConvertToCryptoKey(cryptoKey);
+    mNextKeyAesEcb.SetKey(cryptoKey);
+
+    mKeyedAesEcbsValid = true;
+}
+
+Crypto::AesEcb *SubMac::GetKeyedAesEcb(const KeyMaterial &aKey)
+{
+    Crypto::AesEcb *aesEcb = nullptr;
+
+    VerifyOrExit(mKeyedAesEcbsValid);
+
+    if (&aKey == &mCurrKey)
+    {
+        aesEcb = &mCurrKeyAesEcb;
+    }
+    else if (&aKey == &mPrevKey)
+    {
+        aesEcb = &mPrevKeyAesEcb;
+    }
+    else if (&aKey == &mNextKey)
+    {
+        aesEcb = &mNextKeyAesEcb;
+    }
+
+exit:
+    return aesEcb;
+}
+#endif // OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+
 void SubMac::SignalFrameCounterUsed(uint32_t aFrameCounter)
 {
     mCallbacks.FrameCounterUsed(aFrameCounter);
@@ -477,6 +477,23 @@ public:
      */
     const KeyMaterial &GetNextMacKey(void) const { return mNextKey; }
 
+    /**
+     * This method returns an `AesEcb` with a given MAC key already set (expanded), if available.
+     *
+     * An `AesEcb` is available for the previous, current and next MAC keys (i.e., @p aKey is the one returned from
+     * `GetPreviousMacKey()`, `GetCurrentMacKey()` or `GetNextMacKey()`) when `SubMac` keeps AES contexts for them.
+     *
+     * @param[in] aKey  A reference to the MAC key.
+     *
+     * @returns A pointer to an `AesEcb` with @p aKey set, or `nullptr` if not available.
+     *
+     */
+#if OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+    Crypto::AesEcb *GetKeyedAesEcb(const KeyMaterial &aKey);
+#else
+    Crypto::AesEcb *GetKeyedAesEcb(const KeyMaterial &) { return nullptr; }
+#endif
+
     /**
      * This method returns the current MAC frame counter value.
      *
@@ -596,6 +613,9 @@ private:
 
     void ProcessTransmitSecurity(void);
     void SignalFrameCounterUsed(uint32_t aFrameCounter);
+#if OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+    void UpdateKeyedAesEcbs(void);
+#endif
     void StartCsmaBackoff(void);
     void StartTimerForBackoff(uint8_t aBackoffExponent);
     void BeginTransmit(void);
@@ -638,6 +658,12 @@ private:
     KeyMaterial                  mNextKey;
     uint32_t                     mFrameCounter;
     uint8_t                      mKeyId;
+#if OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+    bool           mKeyedAesEcbsValid;
+    Crypto::AesEcb mPrevKeyAesEcb;
+    Crypto::AesEcb mCurrKeyAesEcb;
+    Crypto::AesEcb mNextKeyAesEcb;
+#endif
 #if OPENTHREAD_CONFIG_MAC_ADD_DELAY_ON_NO_ACK_ERROR_BEFORE_RETRY
     uint8_t mRetxDelayBackOffExponent;
 #endif
@@ -228,6 +228,18 @@ exit:
     return error;
 }
 
+template <typename CallbackType>
+otError WaitingMessagesQueue<CallbackType>::Enqueue(Message &aMessage, const MessageMetadata<CallbackType> &aMetadata)
+{
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = aMetadata.AppendTo(aMessage));
+    mQueue.Enqueue(aMessage);
+
+exit:
+    return error;
+}
+
 template <typename CallbackType>
 otError WaitingMessagesQueue<CallbackType>::Dequeue(Message &aMessage)
 {
@@ -272,9 +284,9 @@ otError WaitingMessagesQueue<CallbackType>::HandleTimer()
                 // Invoke message retransmission and decrement retransmission counter
                 if (mRetransmissionFunc)
                 {
+                    // Retransmission function takes ownership of the message copy
                     VerifyOrExit((retransmissionMessage = metadata.GetRawMessage(*current)), error = OT_ERROR_NO_BUFS);
                     mRetransmissionFunc(*retransmissionMessage, metadata.mDestinationAddress, metadata.mDestinationPort, mRetransmissionContext);
-                    retransmissionMessage->Free();
                 }
                 metadata.mRetransmissionCount--;
                 metadata.mTimestamp = TimerMilli::GetNow().GetValue();
@@ -355,6 +367,15 @@ MqttsnClient::MqttsnClient(Instance& instance)
     , mDisconnectedContext(NULL)
     , mRegisterReceivedCallback(NULL)
     , mRegisterReceivedContext(NULL)
+    , mPublishBatch()
+    , mPublishBatchAddress()
+    , mPublishBatchPort(0)
+    , mPublishBatchBytes(0)
+    , mPublishBatchDeadline(0)
+    , mPublishBatchLingerTime(0)
+    , mPublishBatchByteBudget(0)
+    , mPublishTopicStats()
+    , mPublishTopicStatsCount(0)
 {
     ;
 }
@@ -1140,6 +1161,7 @@ exit:
 otError MqttsnClient::Stop()
 {
     mIsRunning = false;
+    DiscardPublishBatch();
     otError error = mSocket.Close();
     // Clear active gateways list because ADVERTISE messages won't be received anymore
     mActiveGateways.Clear();
@@ -1173,6 +1195,13 @@ otError MqttsnClient::Process()
         SuccessOrExit(error = PingGateway());
     }
 
+    // Send batched PUBLISH messages when linger time elapsed or byte budget reached
+    if (mPublishBatch.GetHead() != NULL && (mPublishBatchDeadline <= TimerMilli::GetNow()
+        || (mPublishBatchByteBudget != 0 && mPublishBatchBytes >= mPublishBatchByteBudget)))
+    {
+        FlushPublishBatch();
+    }
+
     // Handle pending messages timeouts
     SuccessOrExit(error = mConnectQueue.HandleTimer());
     SuccessOrExit(error = mSubscribeQueue.HandleTimer());
@@ -1320,12 +1349,10 @@ exit:
 otError MqttsnClient::Publish(const uint8_t* aData, int32_t aLength, Qos aQos, bool aRetained, const Topic &aTopic, otMqttsnPublishedHandler aCallback, void* aContext)
 {
     otError error = OT_ERROR_NONE;
-    int32_t length = -1;
     Message* message = NULL;
     uint16_t messageId = 0;
     if (aQos == kQos1 || aQos == kQos2)
         messageId = GetNextMessageId();
-    unsigned char buffer[MAX_PACKET_SIZE];
     PublishMessage publishMessage(false, aRetained, aQos, messageId, aTopic, aData, aLength);
 
     // Client state must be active or sleeping
@@ -1336,11 +1363,16 @@ otError MqttsnClient::Publish(const uint8_t* aData, int32_t aLength, Qos aQos, b
     }
 
     // Serialize and send PUBLISH message
-    SuccessOrExit(error = publishMessage.Serialize(buffer, MAX_PACKET_SIZE, &length));
-    SuccessOrExit(error = NewMessage(&message, buffer, length));
+    SuccessOrExit(error = NewPublishMessage(&message, publishMessage));
     if (aQos == kQos0 || aQos == kQosm1)
     {
-        SuccessOrExit(error = SendMessage(*message));
+        SuccessOrExit(error = SendOrBatchPublish(*message, aTopic, mConfig.GetAddress(), mConfig.GetPort()));
+    }
+    else
+    {
+        // Keep ordering with previously batched messages
+        FlushPublishBatch();
+        UpdatePublishTopicStats(aTopic, false);
     }
     if (aQos == kQos1)
     {
@@ -1362,16 +1394,12 @@ exit:
 otError MqttsnClient::PublishQosm1(const uint8_t* aData, int32_t aLength, bool aRetained, const Topic &aTopic, const Ip6::Address &aAddress, uint16_t aPort)
 {
     otError error = OT_ERROR_NONE;
-    int32_t length = -1;
     Message* message = NULL;
-    PublishMessage publishMessage;
-    publishMessage = PublishMessage(false, aRetained, kQosm1, 0, aTopic, aData, aLength);
-    unsigned char buffer[MAX_PACKET_SIZE];
+    PublishMessage publishMessage(false, aRetained, kQosm1, 0, aTopic, aData, aLength);
 
     // Serialize and send PUBLISH message
-    SuccessOrExit(error = publishMessage.Serialize(buffer, MAX_PACKET_SIZE, &length));
-    SuccessOrExit(error = NewMessage(&message, buffer, length));
-    SuccessOrExit(error = SendMessage(*message, aAddress, aPort));
+    SuccessOrExit(error = NewPublishMessage(&message, publishMessage));
+    SuccessOrExit(error = SendOrBatchPublish(*message, aTopic, aAddress, aPort));
 
 exit:
     return error;
@@ -1421,6 +1449,9 @@ otError MqttsnClient::Disconnect()
         goto exit;
     }
 
+    // Send batched PUBLISH messages before disconnecting
+    FlushPublishBatch();
+
     // Serialize and send DISCONNECT message
     SuccessOrExit(error = disconnectMessage.Serialize(buffer, MAX_PACKET_SIZE, &length));
     SuccessOrExit(error = NewMessage(&message, buffer, length));
@@ -1460,6 +1491,9 @@ otError MqttsnClient::Sleep(uint16_t aDuration)
         goto exit;
     }
 
+    // Send batched PUBLISH messages before going to sleep
+    FlushPublishBatch();
+
     // Serialize and send DISCONNECT message
     SuccessOrExit(error = disconnectMessage.Serialize(buffer, MAX_PACKET_SIZE, &length));
     SuccessOrExit(error = NewMessage(&message, buffer, length));
@@ -1582,6 +1616,167 @@ exit:
     return error;
 }
 
+otError MqttsnClient::SetPublishBatching(uint32_t aLingerTime, uint16_t aByteBudget)
+{
+    mPublishBatchLingerTime = aLingerTime;
+    mPublishBatchByteBudget = aByteBudget;
+    if (mPublishBatchLingerTime == 0)
+    {
+        FlushPublishBatch();
+    }
+    return OT_ERROR_NONE;
+}
+
+uint16_t MqttsnClient::GetPublishTopicStats(otMqttsnPublishTopicStats *aBuffer, uint16_t aBufferSize) const
+{
+    uint16_t i = 0;
+    TimeMilli now = TimerMilli::GetNow();
+    while (i < mPublishTopicStatsCount && i < aBufferSize)
+    {
+        aBuffer[i] = mPublishTopicStats[i].mStats;
+        // Rate is evaluated when read so that it decays after publishing stops
+        aBuffer[i].mRate = mPublishTopicStats[i].mRateMeter.GetRate(now);
+        i++;
+    }
+    return i;
+}
+
+otError MqttsnClient::SendOrBatchPublish(Message &aMessage, const Topic &aTopic, const Ip6::Address &aAddress, uint16_t aPort)
+{
+    otError error = OT_ERROR_NONE;
+
+    // Batching is bypassed when disabled or when the process task does not run
+    if (mPublishBatchLingerTime == 0 || mClientState == kStateAsleep)
+    {
+        SuccessOrExit(error = SendMessage(aMessage, aAddress, aPort));
+        UpdatePublishTopicStats(aTopic, false);
+        ExitNow();
+    }
+
+    // Batch is kept for a single destination only
+    if (mPublishBatch.GetHead() != NULL && (aAddress != mPublishBatchAddress || aPort != mPublishBatchPort))
+    {
+        FlushPublishBatch();
+    }
+
+    if (mPublishBatch.GetHead() == NULL)
+    {
+        mPublishBatchAddress = aAddress;
+        mPublishBatchPort = aPort;
+        mPublishBatchDeadline = TimerMilli::GetNow() + mPublishBatchLingerTime;
+    }
+    mPublishBatch.Enqueue(aMessage);
+    mPublishBatchBytes += aMessage.GetLength();
+    UpdatePublishTopicStats(aTopic, true);
+
+exit:
+    return error;
+}
+
+void MqttsnClient::FlushPublishBatch(void)
+{
+    Message *message;
+
+    // Messages are sent back-to-back, SendMessage() frees the message on failure
+    while ((message = mPublishBatch.GetHead()) != NULL)
+    {
+        mPublishBatch.Dequeue(*message);
+        if (SendMessage(*message, mPublishBatchAddress, mPublishBatchPort) != OT_ERROR_NONE)
+        {
+            LogWarn("Failed to send batched PUBLISH message");
+        }
+    }
+    mPublishBatchBytes = 0;
+
+    for (uint16_t i = 0; i < mPublishTopicStatsCount; i++)
+    {
+        mPublishTopicStats[i].mStats.mQueueDepth = 0;
+    }
+}
+
+void MqttsnClient::DiscardPublishBatch(void)
+{
+    mPublishBatch.DequeueAndFreeAll();
+    mPublishBatchBytes = 0;
+
+    for (uint16_t i = 0; i < mPublishTopicStatsCount; i++)
+    {
+        mPublishTopicStats[i].mStats.mQueueDepth = 0;
+    }
+}
+
+void MqttsnClient::UpdatePublishTopicStats(const Topic &aTopic, bool aBatched)
+{
+    TimeMilli now = TimerMilli::GetNow();
+    PublishTopicStatsEntry *entry = NULL;
+
+    for (uint16_t i = 0; i < mPublishTopicStatsCount; i++)
+    {
+        const Topic &topic = *static_cast<const Topic *>(&mPublishTopicStats[i].mStats.mTopic);
+        if (topic.GetType() != aTopic.GetType())
+        {
+            continue;
+        }
+        if ((aTopic.HasTopicId() && topic.GetTopicId() == aTopic.GetTopicId())
+            || (aTopic.GetType() == kShortTopicName
+                && strncmp(topic.GetTopicName(), aTopic.GetTopicName(), kShortTopicNameLength) == 0))
+        {
+            entry = &mPublishTopicStats[i];
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        // Statistics are not kept for topics over the limit
+        VerifyOrExit(mPublishTopicStatsCount < kMaxPublishTopicStats);
+        entry = &mPublishTopicStats[mPublishTopicStatsCount++];
+        memset(&entry->mStats, 0, sizeof(entry->mStats));
+        entry->mStats.mTopic = aTopic;
+        entry->mRateMeter.Start(now);
+    }
+
+    entry->mRateMeter.Count(now);
+    entry->mStats.mPublishCount++;
+
+    if (aBatched)
+    {
+        entry->mStats.mQueueDepth++;
+        if (entry->mStats.mQueueDepth > entry->mStats.mMaxQueueDepth)
+        {
+            entry->mStats.mMaxQueueDepth = entry->mStats.mQueueDepth;
+        }
+    }
+
+exit:
+    return;
+}
+
+otError MqttsnClient::NewPublishMessage(Message **aMessage, const PublishMessage &aPublishMessage)
+{
+    otError error = OT_ERROR_NONE;
+    Message *message = NULL;
+    uint8_t header[PublishMessage::kMaxHeaderLength];
+    int32_t headerLength = -1;
+    int32_t payloadLength = aPublishMessage.GetPayloadLength();
+
+    SuccessOrExit(error = aPublishMessage.SerializeHeader(header, sizeof(header), &headerLength));
+    VerifyOrExit(headerLength + payloadLength <= MAX_PACKET_SIZE, error = OT_ERROR_FAILED);
+
+    // Reserve headroom for the header so that prepending it does not move the payload
+    VerifyOrExit((message = mSocket.NewMessage(PublishMessage::kMaxHeaderLength)) != NULL, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = message->AppendBytes(aPublishMessage.GetPayload(), static_cast<uint16_t>(payloadLength)));
+    SuccessOrExit(error = message->PrependBytes(header, static_cast<uint16_t>(headerLength)));
+    *aMessage = message;
+
+exit:
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+    return error;
+}
+
 otError MqttsnClient::SendMessage(Message &aMessage)
 {
     return SendMessage(aMessage, mConfig.GetAddress(), mConfig.GetPort());
@@ -1591,7 +1786,8 @@ template <typename CallbackType>
 otError MqttsnClient::SendMessageWithRetransmission(Message &aMessage, WaitingMessagesQueue<CallbackType> &aQueue, uint16_t aMessageId, CallbackType aCallback, void* aContext)
 {
     otError error = OT_ERROR_NONE;
-    // Make copy of the message before send because send operation appends UDP header to the message
+    // Make copy of the message before send because send operation appends UDP header to the message.
+    // The copy itself is kept in the waiting queue for retransmissions.
     MessageMetadata<CallbackType> metadata;
     Message *messageCopy = aMessage.Clone();
     VerifyOrExit(messageCopy != NULL, error = OT_ERROR_NO_BUFS);
@@ -1601,7 +1797,8 @@ otError MqttsnClient::SendMessageWithRetransmission(Message &aMessage, WaitingMe
             TimerMilli::GetNow().GetValue(),
             mConfig.GetRetransmissionTimeout() * 1000,
             mConfig.GetRetransmissionCount(), aCallback, aContext);
-    SuccessOrExit(error = aQueue.EnqueueCopy(*messageCopy, messageCopy->GetLength(), metadata));
+    SuccessOrExit(error = aQueue.Enqueue(*messageCopy, metadata));
+    messageCopy = NULL;
 exit:
     if (messageCopy)
     {
@@ -1701,6 +1898,8 @@ void MqttsnClient::OnDisconnected()
     mPublishQos2PubrecQueue.ForceTimeout();
     mPingreqQueue.ForceTimeout();
     mDisconnectQueue.ForceTimeout();
+
+    DiscardPublishBatch();
 }
 
 bool MqttsnClient::VerifyGatewayAddress(const Ip6::MessageInfo &aMessageInfo)
@@ -1803,96 +2002,65 @@ void MqttsnClient::HandlePingreqTimeout(const MessageMetadata<void*> &aMetadata,
     client->mTimeoutRaised = true;
 }
 
-void MqttsnClient::HandleMessageRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
+void MqttsnClient::HandleMessageRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
 {
     LogInfo("Message retransmission");
     MqttsnClient* client = static_cast<MqttsnClient*>(aContext);
-    Message* retransmissionMessage = aMessage.Clone(aMessage.GetLength());
-    if (retransmissionMessage != NULL)
-    {
-        client->SendMessage(*retransmissionMessage, aAddress, aPort);
-    }
+    client->SendMessage(aMessage, aAddress, aPort);
 }
 
-void MqttsnClient::HandlePublishRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
+void MqttsnClient::HandlePublishRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
 {
     LogInfo("Publish message retransmission");
     MqttsnClient* client = static_cast<MqttsnClient*>(aContext);
-    unsigned char buffer[MAX_PACKET_SIZE];
-    PublishMessage publishMessage;
 
-    // Read message content
-    uint16_t offset = aMessage.GetOffset();
-    int32_t length = aMessage.GetLength() - aMessage.GetOffset();
-
-    if (length > MAX_PACKET_SIZE || !buffer)
-    {
-        return;
-    }
-    aMessage.ReadBytes(offset, buffer, length);
-    if (publishMessage.Deserialize(buffer, length) != OT_ERROR_NONE)
-    {
-        return;
-    }
-    // Set DUP flag
-    publishMessage.SetDupFlag(true);
-    if (publishMessage.Serialize(buffer, MAX_PACKET_SIZE, &length) != OT_ERROR_NONE)
-    {
-        return;
-    }
-    Message* retransmissionMessage = NULL;
-    if (client->NewMessage(&retransmissionMessage, buffer, length) != OT_ERROR_NONE)
+    // Set DUP flag directly in the message copy
+    if (SetDupFlag(aMessage) != OT_ERROR_NONE)
     {
+        aMessage.Free();
         return;
     }
-    client->SendMessage(*retransmissionMessage, aAddress, aPort);
+    client->SendMessage(aMessage, aAddress, aPort);
 }
 
-void MqttsnClient::HandleSubscribeRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
+void MqttsnClient::HandleSubscribeRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
 {
     LogInfo("Subscribe message retransmission");
     MqttsnClient* client = static_cast<MqttsnClient*>(aContext);
-    unsigned char buffer[MAX_PACKET_SIZE];
-    SubscribeMessage subscribeMessage;
 
-    // Read message content
-    uint16_t offset = aMessage.GetOffset();
-    int32_t length = aMessage.GetLength() - aMessage.GetOffset();
-
-    unsigned char data[MAX_PACKET_SIZE];
-
-    if (length > MAX_PACKET_SIZE || !data)
-    {
-        return;
-    }
-    aMessage.Read(offset, data, length);
-    if (subscribeMessage.Deserialize(buffer, length) != OT_ERROR_NONE)
-    {
-        return;
-    }
-    // Set DUP flag
-    subscribeMessage.SetDupFlag(true);
-    if (subscribeMessage.Serialize(buffer, MAX_PACKET_SIZE, &length) != OT_ERROR_NONE)
-    {
-        return;
-    }
-    Message* retransmissionMessage = NULL;
-    if (client->NewMessage(&retransmissionMessage, buffer, length) != OT_ERROR_NONE)
+    // Set DUP flag directly in the message copy
+    if (SetDupFlag(aMessage) != OT_ERROR_NONE)
     {
+        aMessage.Free();
         return;
     }
-    client->SendMessage(*retransmissionMessage, aAddress, aPort);
+    client->SendMessage(aMessage, aAddress, aPort);
+}
+
+otError MqttsnClient::SetDupFlag(Message &aMessage)
+{
+    // PUBLISH and SUBSCRIBE messages have the flags byte right after the length field and the message type. Length
+    // field is one byte long or three bytes long starting with 0x01.
+    otError error = OT_ERROR_NONE;
+    uint16_t offset = aMessage.GetOffset();
+    uint8_t lengthByte;
+    uint8_t flags;
+
+    SuccessOrExit(error = aMessage.Read(offset, lengthByte));
+    offset += ((lengthByte == 0x01) ? 3 : 1) + PublishMessage::kFlagsOffset;
+    SuccessOrExit(error = aMessage.Read(offset, flags));
+    flags |= PublishMessage::kDupFlag;
+    aMessage.Write(offset, flags);
+
+exit:
+    return error;
 }
 
-void MqttsnClient::HandlePingreqRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
+void MqttsnClient::HandlePingreqRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext)
 {
     LogInfo("Pingreq message retransmission");
     MqttsnClient* client = static_cast<MqttsnClient*>(aContext);
-    Message* retransmissionMessage = aMessage.Clone(aMessage.GetLength());
-    if (retransmissionMessage != NULL)
-    {
-        client->SendMessage(*retransmissionMessage, aAddress, aPort);
-    }
+    client->SendMessage(aMessage, aAddress, aPort);
     client->ResetPingreqTime();
 }
 
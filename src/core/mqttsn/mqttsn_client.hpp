@@ -31,7 +31,9 @@
 
 #include "mqttsn/mqttsn_gateway_list.hpp"
 #include "common/locator.hpp"
+#include "common/rate_meter.hpp"
 #include "common/tasklet.hpp"
+#include "common/time.hpp"
 #include "net/ip6_address.hpp"
 #include "net/udp6.hpp"
 #include <openthread/mqttsn.h>
@@ -138,6 +140,8 @@ typedef String<kCliendIdStringMax> ClientIdString;
 template <typename CallbackType>
 class WaitingMessagesQueue;
 
+class PublishMessage;
+
 /**
  * This class represents topic. Topic is used for subscribing and publishing
  * messages in following situations:
@@ -378,12 +382,14 @@ public:
     /**
      * Declaration of a function pointer for handling message retransmission.
      *
+     * The retransmission function takes ownership of @p aMessage and is responsible for sending or freeing it.
+     *
      * @param[in]  aMessage  A reference to message to be resend.
      * @param[in]  aAddress  A reference to destination gateway address.
      * @param[in]  aPort     Destination port.
      * @param[in]  aContext  A pointer to retransmission callback context object.
      */
-    typedef void (*RetransmissionFunc)(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
+    typedef void (*RetransmissionFunc)(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
 
     /**
      * This constructor initializes the object with specific values.
@@ -415,6 +421,20 @@ public:
      */
     otError EnqueueCopy(const Message &aMessage, uint16_t aLength, const MessageMetadata<CallbackType> &aMetadata);
 
+    /**
+     * Append metadata to the message and enqueue the message itself to waiting queue without copying it.
+     *
+     * On success the queue takes ownership of the message. On failure the message remains owned by the caller.
+     *
+     * @param[in]  aMessage   A reference to message object to be enqueued.
+     * @param[in]  aMetadata  A reference to message metadata.
+     *
+     * @retval OT_ERROR_NONE     Successfully enqueued the message.
+     * @retval OT_ERROR_NO_BUFS  Insufficient available buffers to append the metadata.
+     *
+     */
+    otError Enqueue(Message &aMessage, const MessageMetadata<CallbackType> &aMetadata);
+
     /**
      * Dequeue specific message from waiting queue.
      *
@@ -810,6 +830,29 @@ public:
      */
     otError PublishQosm1(const uint8_t* aData, int32_t aLength, bool aRetained, const Topic &aTopic, const Ip6::Address &aAddress, uint16_t aPort);
 
+    /**
+     * Configure batching of QoS 0 and QoS -1 PUBLISH messages. Held messages are sent back-to-back in a single run
+     * of the process task when the oldest one was held for linger time or when the byte budget is reached.
+     *
+     * @param[in]  aLingerTime  Maximal time in milliseconds a PUBLISH message is held. Zero disables batching.
+     * @param[in]  aByteBudget  Size of held messages in bytes which triggers sending of the batch. Zero for no limit.
+     *
+     * @retval OT_ERROR_NONE  Batching successfully configured.
+     *
+     */
+    otError SetPublishBatching(uint32_t aLingerTime, uint16_t aByteBudget);
+
+    /**
+     * Get PUBLISH statistics of the topics the client published to.
+     *
+     * @param[out]  aBuffer      A pointer to buffer for storing topic statistics.
+     * @param[in]   aBufferSize  Maximal number of items which can be stored in the buffer.
+     *
+     * @returns  Number of topic statistics written in the buffer.
+     *
+     */
+    uint16_t GetPublishTopicStats(otMqttsnPublishTopicStats *aBuffer, uint16_t aBufferSize) const;
+
     /**
      * Unsubscribe from the topic.
      *
@@ -969,6 +1012,23 @@ protected:
      */
     otError NewMessage(Message **aMessage, unsigned char* aBuffer, int32_t aLength);
 
+    /**
+     * Allocate new PUBLISH message.
+     *
+     * The payload is appended to the message once and the header is then written to the headroom reserved in front
+     * of it, so no intermediate serialization buffer is used.
+     *
+     * @param[out]  aMessage         A pointer to message pointer.
+     * @param[in]   aPublishMessage  A reference to PUBLISH message to be serialized.
+     *
+     * @retval OT_ERROR_NONE          New message successfully created.
+     * @retval OT_ERROR_NO_BUFS       Insufficient available buffers to allocate new message.
+     * @retval OT_ERROR_INVALID_ARGS  Invalid PUBLISH message parameters.
+     * @retval OT_ERROR_FAILED        The message exceeds maximum packet size.
+     *
+     */
+    otError NewPublishMessage(Message **aMessage, const PublishMessage &aPublishMessage);
+
     /**
      * Send OT message to configured gateway address.
      *
@@ -1105,10 +1165,32 @@ private:
 
     static void HandlePingreqTimeout(const MessageMetadata<void*> &aMetadata, void* aContext);
 
-    static void HandleMessageRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
-    static void HandlePublishRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
-    static void HandleSubscribeRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
-    static void HandlePingreqRetransmission(const Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
+    static void HandleMessageRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
+    static void HandlePublishRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
+    static void HandleSubscribeRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
+    static void HandlePingreqRetransmission(Message &aMessage, const Ip6::Address &aAddress, uint16_t aPort, void* aContext);
+
+    static otError SetDupFlag(Message &aMessage);
+
+    otError SendOrBatchPublish(Message &aMessage, const Topic &aTopic, const Ip6::Address &aAddress, uint16_t aPort);
+
+    void FlushPublishBatch(void);
+
+    void DiscardPublishBatch(void);
+
+    void UpdatePublishTopicStats(const Topic &aTopic, bool aBatched);
+
+    enum
+    {
+        kMaxPublishTopicStats = OPENTHREAD_CONFIG_MQTTSN_PUBLISH_TOPIC_STATS_MAX,
+        kPublishRateWindow = 1000, // Publish rate measurement window in milliseconds
+    };
+
+    struct PublishTopicStatsEntry
+    {
+        otMqttsnPublishTopicStats mStats;
+        RateMeter<kPublishRateWindow> mRateMeter;
+    };
 
     Ip6::Udp::Socket mSocket;
     MqttsnConfig mConfig;
@@ -1143,6 +1225,15 @@ private:
     void* mDisconnectedContext;
     otMqttsnRegisterReceivedHandler mRegisterReceivedCallback;
     void* mRegisterReceivedContext;
+    MessageQueue mPublishBatch;
+    Ip6::Address mPublishBatchAddress;
+    uint16_t mPublishBatchPort;
+    uint32_t mPublishBatchBytes;
+    TimeMilli mPublishBatchDeadline;
+    uint32_t mPublishBatchLingerTime;
+    uint16_t mPublishBatchByteBudget;
+    PublishTopicStatsEntry mPublishTopicStats[kMaxPublishTopicStats];
+    uint16_t mPublishTopicStatsCount;
 };
 
 /**
@@ -292,6 +292,73 @@ otError PublishMessage::Serialize(uint8_t* aBuffer, uint8_t aBufferLength, int32
     return OT_ERROR_NONE;
 }
 
+otError PublishMessage::SerializeHeader(uint8_t* aBuffer, uint8_t aBufferLength, int32_t* aLength) const
+{
+    // Same encoding as MQTTSNSerialize_publish() without copying the payload
+    uint8_t* cursor = aBuffer;
+    uint8_t flags = 0;
+    int32_t length;
+
+    if (mQos == kQosm1 && (mMessageId != 0 || mTopic.GetType() != kPredefinedTopicId))
+        return OT_ERROR_INVALID_ARGS;
+    if (mPayloadLength < 0 || aBufferLength < kMaxHeaderLength)
+        return OT_ERROR_INVALID_ARGS;
+
+    switch (mTopic.GetType())
+    {
+    case kTopicId:
+        flags = MQTTSN_TOPIC_TYPE_NORMAL;
+        break;
+    case kPredefinedTopicId:
+        flags = MQTTSN_TOPIC_TYPE_PREDEFINED;
+        break;
+    case kShortTopicName:
+        flags = MQTTSN_TOPIC_TYPE_SHORT;
+        break;
+    default:
+        return OT_ERROR_INVALID_STATE;
+    }
+    if (mDupFlag)
+        flags |= kDupFlag;
+    flags |= static_cast<uint8_t>((mQos & 0x03) << 5);
+    if (mRetainedFlag)
+        flags |= 0x10;
+
+    // Message type, flags, topic ID and message ID followed by the payload
+    length = 6 + mPayloadLength;
+    length += (length > 255) ? 3 : 1;
+    if (length > 0xffff)
+        return OT_ERROR_FAILED;
+
+    if (length > 255)
+    {
+        *cursor++ = 0x01;
+        *cursor++ = static_cast<uint8_t>(length >> 8);
+        *cursor++ = static_cast<uint8_t>(length & 0xff);
+    }
+    else
+    {
+        *cursor++ = static_cast<uint8_t>(length);
+    }
+    *cursor++ = MQTTSN_PUBLISH;
+    *cursor++ = flags;
+    if (mTopic.GetType() == kShortTopicName)
+    {
+        memcpy(cursor, mTopic.GetTopicName(), 2);
+    }
+    else
+    {
+        cursor[0] = static_cast<uint8_t>(mTopic.GetTopicId() >> 8);
+        cursor[1] = static_cast<uint8_t>(mTopic.GetTopicId() & 0xff);
+    }
+    cursor += 2;
+    *cursor++ = static_cast<uint8_t>(mMessageId >> 8);
+    *cursor++ = static_cast<uint8_t>(mMessageId & 0xff);
+
+    *aLength = static_cast<int32_t>(cursor - aBuffer);
+    return OT_ERROR_NONE;
+}
+
 otError PublishMessage::Deserialize(const uint8_t* aBuffer, int32_t aBufferLength)
 {
     otError error = OT_ERROR_NONE;
@@ -441,14 +441,26 @@ public:
 
     void SetPayload(const uint8_t* aPayload) { mPayload = aPayload; }
 
-    int32_t GetPayloadLength() { return mPayloadLength; }
+    int32_t GetPayloadLength() const { return mPayloadLength; }
 
     void SetPayloadLenghth(int32_t aPayloadLenght) { mPayloadLength = aPayloadLenght; }
 
     otError Serialize(uint8_t* aBuffer, uint8_t aBufferLength, int32_t* aLength) const;
 
+    // Serialize only the fields preceding the payload. The length field accounts for the payload, which is expected
+    // to be appended right after the header by the caller.
+    otError SerializeHeader(uint8_t* aBuffer, uint8_t aBufferLength, int32_t* aLength) const;
+
     otError Deserialize(const uint8_t* aBuffer, int32_t aBufferLength);
 
+    // Maximum length of the header (3 bytes length, message type, flags, topic ID and message ID).
+    static const uint8_t kMaxHeaderLength = 9;
+
+    // Offset of the flags byte relative to the end of the length field.
+    static const uint8_t kFlagsOffset = 1;
+
+    static const uint8_t kDupFlag = 0x80;
+
 private:
     bool mDupFlag;
     bool mRetainedFlag;
@@ -34,6 +34,7 @@
 #include "checksum.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
 #include "net/ip4_types.hpp"
@@ -70,10 +71,52 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // Big-endian 32-bit words are summed into a 64-bit accumulator
+    // and the carries are folded back only once at the end. Since
+    // 2^16 is congruent to 1 modulo 0xffff, the one's complement sum
+    // of 32-bit words folds to the same result as summing 16-bit
+    // words. A leading byte at an odd index (e.g., when a message
+    // chunk ends at an odd offset) is added as the LSB of the current
+    // word so that the remaining bytes are word-aligned.
+
+    uint64_t sum = mValue;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
+    {
+        sum += *aBuffer++;
+        aLength--;
+        mAtOddIndex = false;
+    }
+
+    for (; aLength >= sizeof(uint32_t); aLength -= sizeof(uint32_t), aBuffer += sizeof(uint32_t))
     {
-        AddUint8(aBuffer[i]);
+        sum += Encoding::BigEndian::ReadUint32(aBuffer);
     }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        sum += Encoding::BigEndian::ReadUint16(aBuffer);
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    if (aLength > 0)
+    {
+        sum += static_cast<uint16_t>(*aBuffer << 8);
+        mAtOddIndex = true;
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    mValue = static_cast<uint16_t>(sum);
+
+exit:
+    return;
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
@@ -37,6 +37,7 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/num_utils.hpp"
 #include "net/udp6.hpp"
 #include "thread/network_data_types.hpp"
 #include "thread/thread_netif.hpp"
@@ -545,6 +546,10 @@ Client::Client(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     , mUserDidSetDefaultAddress(false)
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    , mCacheBytes(0)
+    , mCacheUseCounter(0)
+#endif
 {
     static_assert(kIp6AddressQuery == 0, "kIp6AddressQuery value is not correct");
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
@@ -557,6 +562,15 @@ Client::Client(Instance &aInstance)
     static_assert(kBrowseQuery == 1, "kBrowseQuery value is not correct");
     static_assert(kServiceQuery == 2, "kServiceQuery value is not correct");
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        entry.Clear();
+    }
+
+    memset(&mCacheCounters, 0, sizeof(mCacheCounters));
+#endif
 }
 
 Error Client::Start(void)
@@ -580,6 +594,10 @@ void Client::Stop(void)
     }
 
     IgnoreError(mSocket.Close());
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ClearCache();
+#endif
 }
 
 void Client::SetDefaultConfig(const QueryConfig &aQueryConfig)
@@ -728,6 +746,10 @@ Error Client::StartQuery(QueryInfo         &aInfo,
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
     mQueries.Enqueue(*query);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    VerifyOrExit(!AnswerFromCache(*query, aInfo.mQueryType));
+#endif
+
     SendQuery(*query, aInfo, /* aUpdateTimer */ true);
 
 exit:
@@ -774,6 +796,7 @@ void Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
     Message         *message = nullptr;
     Header           header;
     Ip6::MessageInfo messageInfo;
+    uint16_t         nameOffset;
 
     aInfo.mTransmissionCount++;
     aInfo.mRetransmissionTime = TimerMilli::GetNow() + aInfo.mConfig.GetResponseTimeout();
@@ -807,11 +830,22 @@ void Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
 
     SuccessOrExit(error = message->Append(header));
 
-    // Prepare the question section.
+    // Prepare the question section. All questions use the same name,
+    // so the ones after the first use a pointer label to it.
+
+    nameOffset = message->GetLength() - message->GetOffset();
 
     for (uint8_t num = 0; num < kQuestionCount[aInfo.mQueryType]; num++)
     {
-        SuccessOrExit(error = AppendNameFromQuery(aQuery, *message));
+        if (num == 0)
+        {
+            SuccessOrExit(error = AppendNameFromQuery(aQuery, *message));
+        }
+        else
+        {
+            SuccessOrExit(error = Name::AppendPointerLabel(nameOffset, *message));
+        }
+
         SuccessOrExit(error = message->Append(Question(kQuestionRecordTypes[aInfo.mQueryType][num])));
     }
 
@@ -955,6 +989,14 @@ void Client::ProcessResponse(const Message &aMessage)
     // finalizing the query and invoking the user's callback.
 
     SuccessOrExit(ParseResponse(response, type, responseError));
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    if (responseError == kErrorNone)
+    {
+        SaveInCache(response, type);
+    }
+#endif
+
     FinalizeQuery(response, type, responseError);
 
 exit:
@@ -1106,6 +1148,219 @@ void Client::HandleTimer(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+void Client::ClearCache(void)
+{
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        if (entry.mMessage != nullptr)
+        {
+            RemoveCacheEntry(entry);
+        }
+    }
+}
+
+bool Client::AnswerFromCache(Query &aQuery, QueryType aType)
+{
+    bool        answered = false;
+    CacheEntry *entry    = FindCacheEntry(aQuery, aType);
+    Message    *message  = nullptr;
+    Response    response;
+
+    VerifyOrExit(entry != nullptr);
+
+    // The callback is given a copy of the cached response, so that
+    // the cache can be safely changed (e.g., by starting another
+    // query or clearing the cache) from within the callback.
+
+    message = entry->mMessage->Clone();
+    VerifyOrExit(message != nullptr);
+
+    response.mInstance              = &Get<Instance>();
+    response.mQuery                 = &aQuery;
+    response.mMessage               = message;
+    response.mAnswerOffset          = entry->mAnswerOffset;
+    response.mAnswerRecordCount     = entry->mAnswerRecordCount;
+    response.mAdditionalOffset      = entry->mAdditionalOffset;
+    response.mAdditionalRecordCount = entry->mAdditionalRecordCount;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    response.mIp6QueryResponseRequiresNat64 = entry->mIp6QueryResponseRequiresNat64;
+#endif
+
+    entry->mLastUse = ++mCacheUseCounter;
+    mCacheCounters.mHits++;
+    answered = true;
+
+    FinalizeQuery(response, aType, kErrorNone);
+    message->Free();
+
+exit:
+    if (!answered)
+    {
+        mCacheCounters.mMisses++;
+    }
+
+    return answered;
+}
+
+void Client::SaveInCache(const Response &aResponse, QueryType aType)
+{
+    const Message &message = *aResponse.mMessage;
+    uint16_t       offset  = message.GetOffset();
+    uint16_t       length  = message.GetLength() - offset;
+    uint32_t       ttl     = kMaxCacheTtl;
+    CacheEntry    *entry;
+    Message       *copy;
+    QueryInfo      info;
+
+    VerifyOrExit((aResponse.mAnswerRecordCount > 0) && (length <= kMaxCacheBytes));
+
+    UpdateMinTtl(message, aResponse.mAnswerOffset, aResponse.mAnswerRecordCount, ttl);
+    UpdateMinTtl(message, aResponse.mAdditionalOffset, aResponse.mAdditionalRecordCount, ttl);
+    VerifyOrExit(ttl > 0);
+
+    entry = FindCacheEntry(*aResponse.mQuery, aType);
+
+    if (entry != nullptr)
+    {
+        RemoveCacheEntry(*entry);
+    }
+
+    // Find an unused entry, evicting the least recently used entries
+    // until there is room for the new response. `FindCacheEntry()`
+    // has already removed the expired entries.
+
+    while (true)
+    {
+        CacheEntry *leastRecent = nullptr;
+
+        entry = nullptr;
+
+        for (CacheEntry &cacheEntry : mCacheEntries)
+        {
+            if (cacheEntry.mMessage == nullptr)
+            {
+                entry = &cacheEntry;
+            }
+            else if ((leastRecent == nullptr) ||
+                     (mCacheUseCounter - cacheEntry.mLastUse > mCacheUseCounter - leastRecent->mLastUse))
+            {
+                leastRecent = &cacheEntry;
+            }
+        }
+
+        if ((entry != nullptr) && (mCacheBytes + length <= kMaxCacheBytes))
+        {
+            break;
+        }
+
+        RemoveCacheEntry(*leastRecent);
+    }
+
+    copy = Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrExit(copy != nullptr);
+
+    if (copy->SetLength(length) != kErrorNone)
+    {
+        copy->Free();
+        ExitNow();
+    }
+
+    message.CopyTo(offset, 0, length, *copy);
+
+    info.ReadFrom(*aResponse.mQuery);
+
+    entry->mMessage               = copy;
+    entry->mExpireTime            = TimerMilli::GetNow() + Time::SecToMsec(ttl);
+    entry->mLastUse               = ++mCacheUseCounter;
+    entry->mServerSockAddr        = info.mConfig.GetServerSockAddr();
+    entry->mQueryType             = aType;
+    entry->mAnswerOffset          = aResponse.mAnswerOffset - offset;
+    entry->mAnswerRecordCount     = aResponse.mAnswerRecordCount;
+    entry->mAdditionalOffset      = aResponse.mAdditionalOffset - offset;
+    entry->mAdditionalRecordCount = aResponse.mAdditionalRecordCount;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    entry->mIp6QueryResponseRequiresNat64 = aResponse.mIp6QueryResponseRequiresNat64;
+#endif
+
+    mCacheBytes += length;
+
+exit:
+    return;
+}
+
+Client::CacheEntry *Client::FindCacheEntry(const Query &aQuery, QueryType aType)
+{
+    CacheEntry *matchedEntry = nullptr;
+    Name        queryName(aQuery, kNameOffsetInQuery);
+    QueryInfo   info;
+
+    RemoveExpiredCacheEntries();
+
+    info.ReadFrom(aQuery);
+
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        // The cached message starts with the DNS header followed by
+        // the question section whose name is the query name.
+
+        uint16_t offset = sizeof(Header);
+
+        if ((entry.mMessage == nullptr) || (entry.mQueryType != aType) ||
+            (entry.mServerSockAddr != info.mConfig.GetServerSockAddr()))
+        {
+            continue;
+        }
+
+        if (Name::CompareName(*entry.mMessage, offset, queryName) == kErrorNone)
+        {
+            matchedEntry = &entry;
+            break;
+        }
+    }
+
+    return matchedEntry;
+}
+
+void Client::RemoveCacheEntry(CacheEntry &aEntry)
+{
+    mCacheBytes -= aEntry.mMessage->GetLength();
+    aEntry.mMessage->Free();
+    aEntry.Clear();
+}
+
+void Client::RemoveExpiredCacheEntries(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        if ((entry.mMessage != nullptr) && (now >= entry.mExpireTime))
+        {
+            RemoveCacheEntry(entry);
+        }
+    }
+}
+
+void Client::UpdateMinTtl(const Message &aMessage, uint16_t aOffset, uint16_t aNumRecords, uint32_t &aMinTtl)
+{
+    ResourceRecord record;
+
+    for (; aNumRecords > 0; aNumRecords--)
+    {
+        SuccessOrExit(Name::ParseName(aMessage, aOffset));
+        SuccessOrExit(aMessage.Read(aOffset, record));
+        aMinTtl = Min(aMinTtl, record.GetTtl());
+        aOffset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 } // namespace Dns
 } // namespace ot
 
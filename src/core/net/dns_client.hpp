@@ -586,6 +586,28 @@ public:
      */
     void ResetDefaultConfig(void);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    /**
+     * This type represents the response cache counters.
+     *
+     */
+    typedef otDnsClientCacheCounters CacheCounters;
+
+    /**
+     * This method gets the response cache counters.
+     *
+     * @returns The response cache counters.
+     *
+     */
+    const CacheCounters &GetCacheCounters(void) const { return mCacheCounters; }
+
+    /**
+     * This method removes all the entries from the response cache.
+     *
+     */
+    void ClearCache(void);
+#endif
+
     /**
      * This method sends an address resolution DNS query for AAAA (IPv6) record for a given host name.
      *
@@ -726,6 +748,28 @@ private:
 
     static constexpr uint16_t kNameOffsetInQuery = sizeof(QueryInfo);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    static constexpr uint16_t kMaxCacheEntries = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES;
+    static constexpr uint32_t kMaxCacheBytes   = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_BYTES;
+    static constexpr uint32_t kMaxCacheTtl     = TimerMilli::kMaxDelay / 1000; // in seconds
+
+    struct CacheEntry : public Clearable<CacheEntry> // A cached response.
+    {
+        Message      *mMessage;               // Response message (from DNS header), `nullptr` if entry is unused.
+        TimeMilli     mExpireTime;            // Expire time (using the min TTL of the response records).
+        uint32_t      mLastUse;               // Value of `mCacheUseCounter` when the entry was last saved or used.
+        Ip6::SockAddr mServerSockAddr;        // Server socket address the query was sent to.
+        QueryType     mQueryType;             // Query type.
+        uint16_t      mAnswerOffset;          // Answer section offset in `mMessage`.
+        uint16_t      mAnswerRecordCount;     // Number of records in answer section.
+        uint16_t      mAdditionalOffset;      // Additional data section offset in `mMessage`.
+        uint16_t      mAdditionalRecordCount; // Number of records in additional data section.
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+        bool mIp6QueryResponseRequiresNat64;
+#endif
+    };
+#endif
+
     Error       StartQuery(QueryInfo         &aInfo,
                            const QueryConfig *aConfig,
                            const char        *aLabel,
@@ -747,6 +791,14 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
     Error CheckAddressResponse(Response &aResponse, Error aResponseError) const;
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    bool        AnswerFromCache(Query &aQuery, QueryType aType);
+    void        SaveInCache(const Response &aResponse, QueryType aType);
+    CacheEntry *FindCacheEntry(const Query &aQuery, QueryType aType);
+    void        RemoveCacheEntry(CacheEntry &aEntry);
+    void        RemoveExpiredCacheEntries(void);
+    static void UpdateMinTtl(const Message &aMessage, uint16_t aOffset, uint16_t aNumRecords, uint32_t &aMinTtl);
+#endif
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     void UpdateDefaultConfigAddress(void);
 #endif
@@ -772,6 +824,12 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     bool mUserDidSetDefaultAddress;
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    CacheEntry    mCacheEntries[kMaxCacheEntries];
+    uint32_t      mCacheBytes;
+    uint32_t      mCacheUseCounter;
+    CacheCounters mCacheCounters;
+#endif
 };
 
 } // namespace Dns
@@ -687,6 +687,280 @@ exit:
     return match;
 }
 
+Error NameCompressor::AppendName(const char *aFirstLabel,
+                                 uint8_t     aFirstLabelLength,
+                                 const char *aName,
+                                 Message    &aMessage)
+{
+    // This method walks the labels in `aName` from the last one to
+    // the first one, hashing each suffix and looking it up in the
+    // dictionary. The longest suffix found is replaced by a pointer
+    // label. The suffixes which were not found are remembered so
+    // that they can be added to the dictionary once the name is
+    // appended. Since every suffix of an added name is also added
+    // (shortest first), the lookup stops at the first miss. Shorter
+    // suffixes are found by more names, so they are the last to be
+    // evicted when the dictionary is full.
+
+    Error    error         = kErrorNone;
+    uint16_t startOffset   = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t nameLength    = (aName == nullptr) ? 0 : StringLength(aName, Name::kMaxNameSize);
+    uint16_t nameStart     = (aFirstLabel == nullptr) ? 0 : aFirstLabelLength + sizeof(uint8_t);
+    uint16_t prefixLength  = 0;
+    uint16_t pointerOffset = 0;
+    uint16_t hash          = 0;
+    bool     matching      = true;
+    bool     compressed    = false;
+    uint8_t  numSuffixes   = 0;
+    Suffix   suffixes[kMaxEntries];
+
+    VerifyOrExit(nameLength <= Name::kMaxNameLength, error = kErrorInvalidArgs);
+
+    if ((nameLength > 0) && (aName[nameLength - 1] == Name::kLabelSeperatorChar))
+    {
+        nameLength--;
+    }
+
+    prefixLength = nameLength;
+
+    if (nameLength > 0)
+    {
+        uint16_t labelEnd = nameLength;
+
+        while (true)
+        {
+            uint16_t labelStart = labelEnd;
+            uint16_t offset;
+
+            while ((labelStart > 0) && (aName[labelStart - 1] != Name::kLabelSeperatorChar))
+            {
+                labelStart--;
+            }
+
+            VerifyOrExit((labelStart < labelEnd) && (labelEnd - labelStart <= Name::kMaxLabelLength),
+                         error = kErrorInvalidArgs);
+
+            hash = UpdateHash(hash, &aName[labelStart], static_cast<uint8_t>(labelEnd - labelStart));
+
+            if (matching &&
+                Find(aMessage, hash, nullptr, 0, &aName[labelStart], nameLength - labelStart, offset) == kErrorNone)
+            {
+                prefixLength  = labelStart;
+                pointerOffset = offset;
+                compressed    = true;
+            }
+            else
+            {
+                matching = false;
+
+                if (numSuffixes < kMaxEntries)
+                {
+                    suffixes[numSuffixes].mHash     = hash;
+                    suffixes[numSuffixes].mPosition = nameStart + labelStart;
+                    numSuffixes++;
+                }
+            }
+
+            if (labelStart == 0)
+            {
+                break;
+            }
+
+            labelEnd = labelStart - 1;
+        }
+    }
+
+    if (aFirstLabel != nullptr)
+    {
+        uint16_t offset;
+
+        VerifyOrExit((0 < aFirstLabelLength) && (aFirstLabelLength <= Name::kMaxLabelLength),
+                     error = kErrorInvalidArgs);
+
+        hash = UpdateHash(hash, aFirstLabel, aFirstLabelLength);
+
+        if (matching && Find(aMessage, hash, aFirstLabel, aFirstLabelLength, aName, nameLength, offset) == kErrorNone)
+        {
+            // The full name is already in the message.
+            ExitNow(error = Name::AppendPointerLabel(offset, aMessage));
+        }
+
+        if (numSuffixes < kMaxEntries)
+        {
+            suffixes[numSuffixes].mHash     = hash;
+            suffixes[numSuffixes].mPosition = 0;
+            numSuffixes++;
+        }
+
+        SuccessOrExit(error = Name::AppendLabel(aFirstLabel, aFirstLabelLength, aMessage));
+    }
+
+    SuccessOrExit(error = Name::AppendMultipleLabels(aName, static_cast<uint8_t>(prefixLength), aMessage));
+
+    if (compressed)
+    {
+        SuccessOrExit(error = Name::AppendPointerLabel(pointerOffset, aMessage));
+    }
+    else
+    {
+        SuccessOrExit(error = Name::AppendTerminator(aMessage));
+    }
+
+    for (uint8_t i = 0; i < numSuffixes; i++)
+    {
+        uint32_t offset = static_cast<uint32_t>(startOffset) + suffixes[i].mPosition;
+
+        if (offset <= kMaxOffset)
+        {
+            Add(suffixes[i].mHash, static_cast<uint16_t>(offset));
+        }
+    }
+
+exit:
+    return error;
+}
+
+uint16_t NameCompressor::UpdateHash(uint16_t aHash, uint8_t aByte)
+{
+    return static_cast<uint16_t>((aHash << 5) + aHash + aByte);
+}
+
+uint16_t NameCompressor::UpdateHash(uint16_t aHash, const char *aLabel, uint8_t aLength)
+{
+    // The label length is included in the hash so that a single
+    // label containing dot characters (e.g., a service instance
+    // label) hashes differently from the same text split into
+    // multiple labels.
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        aHash = UpdateHash(aHash, static_cast<uint8_t>(ToLowercase(aLabel[i])));
+    }
+
+    return UpdateHash(aHash, aLength);
+}
+
+bool NameCompressor::Matches(const Message &aMessage,
+                             uint16_t       aOffset,
+                             const char    *aFirstLabel,
+                             uint8_t        aFirstLabelLength,
+                             const char    *aName,
+                             uint16_t       aNameLength)
+{
+    // This method verifies that the encoded name in `aMessage` at
+    // `aOffset` (relative to DNS header) matches the given labels.
+    // Labels are compared one by one as single labels, so a label
+    // containing dot characters never matches multiple labels.
+
+    bool     matches = false;
+    uint16_t offset  = aMessage.GetOffset() + aOffset;
+    uint16_t index   = 0;
+    char     label[Name::kMaxLabelSize];
+
+    if (aFirstLabel != nullptr)
+    {
+        memcpy(label, aFirstLabel, aFirstLabelLength);
+        label[aFirstLabelLength] = kNullChar;
+        VerifyOrExit(Name::CompareLabel(aMessage, offset, label) == kErrorNone);
+    }
+
+    while (index < aNameLength)
+    {
+        uint16_t labelLength = 0;
+
+        while ((index + labelLength < aNameLength) && (aName[index + labelLength] != Name::kLabelSeperatorChar))
+        {
+            labelLength++;
+        }
+
+        memcpy(label, &aName[index], labelLength);
+        label[labelLength] = kNullChar;
+        VerifyOrExit(Name::CompareLabel(aMessage, offset, label) == kErrorNone);
+
+        index += labelLength + sizeof(char);
+    }
+
+    // Ensure the name in the message has no more labels.
+    matches = (Name::CompareName(aMessage, offset, "") == kErrorNone);
+
+exit:
+    return matches;
+}
+
+Error NameCompressor::Find(const Message &aMessage,
+                           uint16_t       aHash,
+                           const char    *aFirstLabel,
+                           uint8_t        aFirstLabelLength,
+                           const char    *aName,
+                           uint16_t       aNameLength,
+                           uint16_t      &aOffset)
+{
+    Error error = kErrorNotFound;
+
+    for (uint8_t index = mBuckets[aHash % kNumBuckets]; index != kNoEntry; index = mEntries[index - 1].mNext)
+    {
+        Entry &entry = mEntries[index - 1];
+
+        if ((entry.mHash == aHash) &&
+            Matches(aMessage, entry.mOffset, aFirstLabel, aFirstLabelLength, aName, aNameLength))
+        {
+            entry.mLastUse = mUseCount++;
+            aOffset        = entry.mOffset;
+            error          = kErrorNone;
+            break;
+        }
+    }
+
+    return error;
+}
+
+void NameCompressor::Add(uint16_t aHash, uint16_t aOffset)
+{
+    uint8_t index  = (mNumEntries < kMaxEntries) ? mNumEntries++ : EvictLeastRecentlyUsed();
+    Entry  &entry  = mEntries[index];
+    uint8_t bucket = aHash % kNumBuckets;
+
+    entry.mOffset  = aOffset;
+    entry.mHash    = aHash;
+    entry.mLastUse = mUseCount++;
+    entry.mNext    = mBuckets[bucket];
+
+    mBuckets[bucket] = index + 1;
+}
+
+uint8_t NameCompressor::EvictLeastRecentlyUsed(void)
+{
+    // Finds the entry unused for the longest time and removes it
+    // from its bucket chain. Ages are computed relative to
+    // `mUseCount` so they stay correct when the count wraps.
+
+    uint8_t  index  = 0;
+    uint16_t maxAge = 0;
+    uint8_t *next;
+
+    for (uint8_t i = 0; i < kMaxEntries; i++)
+    {
+        uint16_t age = static_cast<uint16_t>(mUseCount - mEntries[i].mLastUse);
+
+        if (age > maxAge)
+        {
+            index  = i;
+            maxAge = age;
+        }
+    }
+
+    next = &mBuckets[mEntries[index].mHash % kNumBuckets];
+
+    while (*next != index + 1)
+    {
+        next = &mEntries[*next - 1].mNext;
+    }
+
+    *next = mEntries[index].mNext;
+
+    return index;
+}
+
 Error ResourceRecord::ParseRecords(const Message &aMessage, uint16_t &aOffset, uint16_t aNumRecords)
 {
     Error error = kErrorNone;
@@ -1047,6 +1047,114 @@ private:
     uint16_t       mOffset;  // Offset in `mMessage` to the start of name (used when name is from `mMessage`).
 };
 
+/**
+ * This class implements a DNS name compressor used when appending names to a DNS message.
+ *
+ * The compressor keeps a small dictionary mapping name suffixes (sequences of trailing labels) already appended to a
+ * message to their offsets in it (RFC 1035 - section 4.1.4). When a new name is appended, its longest suffix present
+ * in the dictionary is replaced with a pointer label, and the newly encoded labels are added to the dictionary so
+ * later names can refer to them. Suffixes are looked up by a case-insensitive hash of their labels and every
+ * candidate is verified against the message content, so hash collisions never lead to a wrong pointer.
+ *
+ * When the dictionary is full, the least recently used suffix is replaced. Shared suffixes (e.g., the domain or a
+ * service name) are used by every name which ends with them, so they stay in the dictionary however many names are
+ * appended.
+ *
+ * A `NameCompressor` instance MUST be used with a single message. It MUST be cleared (or re-constructed) before
+ * being used with a new message.
+ *
+ */
+class NameCompressor : public Clearable<NameCompressor>
+{
+public:
+    /**
+     * This constructor initializes the `NameCompressor` with an empty dictionary.
+     *
+     */
+    NameCompressor(void) { Clear(); }
+
+    /**
+     * This method encodes and appends a name to a message, compressing it using previously appended names.
+     *
+     * The @p aName must follow  "<label1>.<label2>.<label3>", i.e., a sequence of labels separated by dot '.' char.
+     *
+     * @param[in] aName           A name string. Can be `nullptr` (then root "." is appended).
+     * @param[in] aMessage        The message to append to. `aMessage.GetOffset()` MUST point to the start of the DNS
+     *                            header.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  Name @p aName is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendName(const char *aName, Message &aMessage) { return AppendName(nullptr, 0, aName, aMessage); }
+
+    /**
+     * This method encodes and appends a name formed by a single label followed by a name to a message, compressing
+     * it using previously appended names.
+     *
+     * The @p aFirstLabel is always appended as one whole label, i.e., it can contain dot '.' characters. This is
+     * useful for "Service Instance Names" where the <Instance> portion is a user-friendly name.
+     *
+     * @param[in] aFirstLabel        A pointer to the first label string (not necessarily null-terminated).
+     * @param[in] aFirstLabelLength  The length of the first label (number of chars).
+     * @param[in] aName              A name string to append after the first label.
+     * @param[in] aMessage           The message to append to. `aMessage.GetOffset()` MUST point to the start of the
+     *                               DNS header.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  Name @p aName or @p aFirstLabel is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendName(const char *aFirstLabel, uint8_t aFirstLabelLength, const char *aName, Message &aMessage);
+
+private:
+    static constexpr uint8_t kMaxEntries = 16;
+    static constexpr uint8_t kNumBuckets = 8;
+    static constexpr uint8_t kNoEntry    = 0; // Entry indexes are stored plus one, so zero marks end of chain.
+
+    // Offsets must fit in the 14-bit offset field of a pointer label.
+    static constexpr uint16_t kMaxOffset = 0x3fff;
+
+    struct Entry
+    {
+        uint16_t mOffset;  // Offset of the suffix relative to the start of DNS header.
+        uint16_t mHash;    // Hash of the suffix labels.
+        uint16_t mLastUse; // Value of `mUseCount` when the entry was last added or found.
+        uint8_t  mNext;    // Index (plus one) of next entry in the same bucket, or `kNoEntry`.
+    };
+
+    struct Suffix
+    {
+        uint16_t mHash;     // Hash of the suffix labels.
+        uint16_t mPosition; // Position in the encoded name (relative to the name start).
+    };
+
+    static uint16_t UpdateHash(uint16_t aHash, uint8_t aByte);
+    static uint16_t UpdateHash(uint16_t aHash, const char *aLabel, uint8_t aLength);
+    static bool     Matches(const Message &aMessage,
+                            uint16_t       aOffset,
+                            const char    *aFirstLabel,
+                            uint8_t        aFirstLabelLength,
+                            const char    *aName,
+                            uint16_t       aNameLength);
+    Error           Find(const Message &aMessage,
+                         uint16_t       aHash,
+                         const char    *aFirstLabel,
+                         uint8_t        aFirstLabelLength,
+                         const char    *aName,
+                         uint16_t       aNameLength,
+                         uint16_t      &aOffset);
+    void            Add(uint16_t aHash, uint16_t aOffset);
+    uint8_t         EvictLeastRecentlyUsed(void);
+
+    uint8_t  mBuckets[kNumBuckets];
+    Entry    mEntries[kMaxEntries];
+    uint8_t  mNumEntries;
+    uint16_t mUseCount;
+};
+
 /**
  * This type represents a TXT record entry representing a key/value pair (RFC 6763 - section 6.3).
  *
@@ -144,7 +144,7 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     Error            error           = kErrorNone;
     Message         *responseMessage = nullptr;
     Header           responseHeader;
-    NameCompressInfo compressInfo(kDefaultDomainName);
+    NameCompressor   compressor;
     Header::Response response                = Header::kResponseSuccess;
     bool             resolveByQueryCallbacks = false;
 
@@ -165,18 +165,18 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     VerifyOrExit(!aRequestHeader.IsTruncationFlagSet(), response = Header::kResponseFormatError);
     VerifyOrExit(aRequestHeader.GetQuestionCount() > 0, response = Header::kResponseFormatError);
 
-    response = AddQuestions(aRequestHeader, aRequestMessage, responseHeader, *responseMessage, compressInfo);
+    response = AddQuestions(aRequestHeader, aRequestMessage, responseHeader, *responseMessage, compressor);
     VerifyOrExit(response == Header::kResponseSuccess);
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
     // Answer the questions
-    response = ResolveBySrp(responseHeader, *responseMessage, compressInfo);
+    response = ResolveBySrp(responseHeader, *responseMessage, compressor);
 #endif
 
     // Resolve the question using query callbacks if SRP server failed to resolve the questions.
     if (responseHeader.GetAnswerCount() == 0)
     {
-        if (kErrorNone == ResolveByQueryCallbacks(responseHeader, *responseMessage, compressInfo, aMessageInfo))
+        if (kErrorNone == ResolveByQueryCallbacks(responseHeader, *responseMessage, compressor, aMessageInfo))
         {
             resolveByQueryCallbacks = true;
         }
@@ -233,11 +233,11 @@ void Server::SendResponse(Header                  aHeader,
     UpdateResponseCounters(aResponseCode);
 }
 
-Header::Response Server::AddQuestions(const Header     &aRequestHeader,
-                                      const Message    &aRequestMessage,
-                                      Header           &aResponseHeader,
-                                      Message          &aResponseMessage,
-                                      NameCompressInfo &aCompressInfo)
+Header::Response Server::AddQuestions(const Header   &aRequestHeader,
+                                      const Message  &aRequestMessage,
+                                      Header         &aResponseHeader,
+                                      Message        &aResponseMessage,
+                                      NameCompressor &aCompressor)
 {
     Question         question;
     uint16_t         readOffset;
@@ -263,7 +263,7 @@ Header::Response Server::AddQuestions(const Header     &aRequestHeader,
                          qtype == ResourceRecord::kTypeTxt || qtype == ResourceRecord::kTypeAaaa,
                      response = Header::kResponseNotImplemented);
 
-        VerifyOrExit(kErrorNone == FindNameComponents(name, aCompressInfo.GetDomainName(), nameComponentsOffsetInfo),
+        VerifyOrExit(kErrorNone == FindNameComponents(name, kDefaultDomainName, nameComponentsOffsetInfo),
                      response = Header::kResponseNameError);
 
         switch (question.GetType())
@@ -284,7 +284,7 @@ Header::Response Server::AddQuestions(const Header     &aRequestHeader,
             ExitNow(response = Header::kResponseNotImplemented);
         }
 
-        VerifyOrExit(AppendQuestion(name, question, aResponseMessage, aCompressInfo) == kErrorNone,
+        VerifyOrExit(AppendQuestion(name, question, aResponseMessage, aCompressor) == kErrorNone,
                      response = Header::kResponseServerFailure);
     }
 
@@ -294,24 +294,24 @@ exit:
     return response;
 }
 
-Error Server::AppendQuestion(const char       *aName,
-                             const Question   &aQuestion,
-                             Message          &aMessage,
-                             NameCompressInfo &aCompressInfo)
+Error Server::AppendQuestion(const char     *aName,
+                             const Question &aQuestion,
+                             Message        &aMessage,
+                             NameCompressor &aCompressor)
 {
     Error error = kErrorNone;
 
     switch (aQuestion.GetType())
     {
     case ResourceRecord::kTypePtr:
-        SuccessOrExit(error = AppendServiceName(aMessage, aName, aCompressInfo));
+        SuccessOrExit(error = AppendServiceName(aMessage, aName, aCompressor));
         break;
     case ResourceRecord::kTypeSrv:
     case ResourceRecord::kTypeTxt:
-        SuccessOrExit(error = AppendInstanceName(aMessage, aName, aCompressInfo));
+        SuccessOrExit(error = AppendInstanceName(aMessage, aName, aCompressor));
         break;
     case ResourceRecord::kTypeAaaa:
-        SuccessOrExit(error = AppendHostName(aMessage, aName, aCompressInfo));
+        SuccessOrExit(error = AppendHostName(aMessage, aName, aCompressor));
         break;
     default:
         OT_ASSERT(false);
@@ -323,11 +323,11 @@ exit:
     return error;
 }
 
-Error Server::AppendPtrRecord(Message          &aMessage,
-                              const char       *aServiceName,
-                              const char       *aInstanceName,
-                              uint32_t          aTtl,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendPtrRecord(Message        &aMessage,
+                              const char     *aServiceName,
+                              const char     *aInstanceName,
+                              uint32_t        aTtl,
+                              NameCompressor &aCompressor)
 {
     Error     error;
     PtrRecord ptrRecord;
@@ -336,12 +336,12 @@ Error Server::AppendPtrRecord(Message          &aMessage,
     ptrRecord.Init();
     ptrRecord.SetTtl(aTtl);
 
-    SuccessOrExit(error = AppendServiceName(aMessage, aServiceName, aCompressInfo));
+    SuccessOrExit(error = AppendServiceName(aMessage, aServiceName, aCompressor));
 
     recordOffset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.SetLength(recordOffset + sizeof(ptrRecord)));
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressor));
 
     ptrRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
     aMessage.Write(recordOffset, ptrRecord);
@@ -350,14 +350,14 @@ exit:
     return error;
 }
 
-Error Server::AppendSrvRecord(Message          &aMessage,
-                              const char       *aInstanceName,
-                              const char       *aHostName,
-                              uint32_t          aTtl,
-                              uint16_t          aPriority,
-                              uint16_t          aWeight,
-                              uint16_t          aPort,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendSrvRecord(Message        &aMessage,
+                              const char     *aInstanceName,
+                              const char     *aHostName,
+                              uint32_t        aTtl,
+                              uint16_t        aPriority,
+                              uint16_t        aWeight,
+                              uint16_t        aPort,
+                              NameCompressor &aCompressor)
 {
     SrvRecord srvRecord;
     Error     error = kErrorNone;
@@ -369,12 +369,12 @@ Error Server::AppendSrvRecord(Message          &aMessage,
     srvRecord.SetWeight(aWeight);
     srvRecord.SetPort(aPort);
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressor));
 
     recordOffset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.SetLength(recordOffset + sizeof(srvRecord)));
 
-    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
+    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressor));
 
     srvRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
     aMessage.Write(recordOffset, srvRecord);
@@ -387,7 +387,7 @@ Error Server::AppendAaaaRecord(Message            &aMessage,
                                const char         *aHostName,
                                const Ip6::Address &aAddress,
                                uint32_t            aTtl,
-                               NameCompressInfo   &aCompressInfo)
+                               NameCompressor     &aCompressor)
 {
     AaaaRecord aaaaRecord;
     Error      error;
@@ -396,118 +396,46 @@ Error Server::AppendAaaaRecord(Message            &aMessage,
     aaaaRecord.SetTtl(aTtl);
     aaaaRecord.SetAddress(aAddress);
 
-    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
+    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressor));
     error = aMessage.Append(aaaaRecord);
 
 exit:
     return error;
 }
 
-Error Server::AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+Error Server::AppendServiceName(Message &aMessage, const char *aName, NameCompressor &aCompressor)
 {
-    Error       error;
-    uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, aName);
-    const char *serviceName;
+    // A sub-type service name (e.g., "_sub1._sub._srv._udp.<domain>")
+    // is a regular multi-label name, so the compressor will find and
+    // point to the base service name if it is already appended.
 
-    // Check whether `aName` is a sub-type service name.
-    serviceName = StringFind(aName, kDnssdSubTypeLabel, kStringCaseInsensitiveMatch);
-
-    if (serviceName != nullptr)
-    {
-        uint8_t subTypeLabelLength = static_cast<uint8_t>(serviceName - aName) + sizeof(kDnssdSubTypeLabel) - 1;
-
-        SuccessOrExit(error = Name::AppendMultipleLabels(aName, subTypeLabelLength, aMessage));
-
-        // Skip over the "._sub." label to get to the root service name.
-        serviceName += sizeof(kDnssdSubTypeLabel) - 1;
-    }
-    else
-    {
-        serviceName = aName;
-    }
-
-    if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(serviceName, Name::kMaxNameSize - 1) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        serviceCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetServiceNameOffset(serviceCompressOffset);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(serviceCompressOffset + domainStart);
-            error = Name::AppendName(serviceName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(serviceName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
-
-exit:
-    return error;
+    return aCompressor.AppendName(aName, aMessage);
 }
 
-Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressor &aCompressor)
 {
-    Error    error;
-    uint16_t instanceCompressOffset = aCompressInfo.GetInstanceNameOffset(aMessage, aName);
-
-    if (instanceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(instanceCompressOffset, aMessage);
-    }
-    else
-    {
-        NameComponentsOffsetInfo nameComponentsInfo;
+    NameComponentsOffsetInfo nameComponentsInfo;
 
-        IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
-        OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
+    IgnoreError(FindNameComponents(aName, kDefaultDomainName, nameComponentsInfo));
+    OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
 
-        aCompressInfo.SetInstanceNameOffset(aMessage.GetLength());
-
-        // Append the instance name as one label
-        SuccessOrExit(error = Name::AppendLabel(aName, nameComponentsInfo.mServiceOffset - 1, aMessage));
-
-        {
-            const char *serviceName           = aName + nameComponentsInfo.mServiceOffset;
-            uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, serviceName);
-
-            if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-            {
-                error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-            }
-            else
-            {
-                aCompressInfo.SetServiceNameOffset(aMessage.GetLength());
-                error = Name::AppendName(serviceName, aMessage);
-            }
-        }
-    }
-
-exit:
-    return error;
+    // Append the instance name as one label followed by the service name.
+    return aCompressor.AppendName(aName, static_cast<uint8_t>(nameComponentsInfo.mServiceOffset - 1),
+                                  aName + nameComponentsInfo.mServiceOffset, aMessage);
 }
 
-Error Server::AppendTxtRecord(Message          &aMessage,
-                              const char       *aInstanceName,
-                              const void       *aTxtData,
-                              uint16_t          aTxtLength,
-                              uint32_t          aTtl,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendTxtRecord(Message        &aMessage,
+                              const char     *aInstanceName,
+                              const void     *aTxtData,
+                              uint16_t        aTxtLength,
+                              uint32_t        aTtl,
+                              NameCompressor &aCompressor)
 {
     Error         error = kErrorNone;
     TxtRecord     txtRecord;
     const uint8_t kEmptyTxt = 0;
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressor));
 
     txtRecord.Init();
     txtRecord.SetTtl(aTtl);
@@ -527,38 +455,9 @@ exit:
     return error;
 }
 
-Error Server::AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+Error Server::AppendHostName(Message &aMessage, const char *aName, NameCompressor &aCompressor)
 {
-    Error    error;
-    uint16_t hostCompressOffset = aCompressInfo.GetHostNameOffset(aMessage, aName);
-
-    if (hostCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(hostCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameLength) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        hostCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetHostNameOffset(hostCompressOffset);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(hostCompressOffset + domainStart);
-            error = Name::AppendName(aName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
-
-exit:
-    return error;
+    return aCompressor.AppendName(aName, aMessage);
 }
 
 void Server::IncResourceRecordCount(Header &aHeader, bool aAdditional)
@@ -658,9 +557,9 @@ exit:
 }
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
-                                      Message                  &aResponseMessage,
-                                      Server::NameCompressInfo &aCompressInfo)
+Header::Response Server::ResolveBySrp(Header         &aResponseHeader,
+                                      Message        &aResponseMessage,
+                                      NameCompressor &aCompressor)
 {
     Question         question;
     uint16_t         readOffset = sizeof(Header);
@@ -673,7 +572,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
         IgnoreError(aResponseMessage.Read(readOffset, question));
         readOffset += sizeof(question);
 
-        response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aCompressInfo,
+        response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aCompressor,
                                         /* aAdditional */ false);
 
         LogInfo("ANSWER: TRANSACTION=0x%04x, QUESTION=[%s %d %d], RCODE=%d", aResponseHeader.GetMessageId(), name,
@@ -691,7 +590,7 @@ Header::Response Server::ResolveBySrp(Header                   &aResponseHeader,
             readOffset += sizeof(question);
 
             VerifyOrExit(Header::kResponseServerFailure != ResolveQuestionBySrp(name, question, aResponseHeader,
-                                                                                aResponseMessage, aCompressInfo,
+                                                                                aResponseMessage, aCompressor,
                                                                                 /* aAdditional */ true),
                          response = Header::kResponseServerFailure);
 
@@ -703,90 +602,94 @@ exit:
     return response;
 }
 
-Header::Response Server::ResolveQuestionBySrp(const char       *aName,
-                                              const Question   &aQuestion,
-                                              Header           &aResponseHeader,
-                                              Message          &aResponseMessage,
-                                              NameCompressInfo &aCompressInfo,
-                                              bool              aAdditional)
+Header::Response Server::ResolveQuestionBySrp(const char     *aName,
+                                              const Question &aQuestion,
+                                              Header         &aResponseHeader,
+                                              Message        &aResponseMessage,
+                                              NameCompressor &aCompressor,
+                                              bool            aAdditional)
 {
-    Error                    error    = kErrorNone;
-    const Srp::Server::Host *host     = nullptr;
-    TimeMilli                now      = TimerMilli::GetNow();
-    uint16_t                 qtype    = aQuestion.GetType();
-    Header::Response         response = Header::kResponseNameError;
+    Error            error    = kErrorNone;
+    TimeMilli        now      = TimerMilli::GetNow();
+    uint16_t         qtype    = aQuestion.GetType();
+    Header::Response response = Header::kResponseNameError;
 
-    while ((host = GetNextSrpHost(host)) != nullptr)
+    // Handle PTR/SRV/TXT query
+    if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
     {
-        bool        needAdditionalAaaaRecord = false;
-        const char *hostName                 = host->GetFullName();
+        // PTR queries are matched against the service name, SRV/TXT
+        // queries against the service instance name.
+
+        const char                 *serviceName       = (qtype == ResourceRecord::kTypePtr) ? aName : nullptr;
+        const char                 *queryInstanceName = (qtype == ResourceRecord::kTypePtr) ? nullptr : aName;
+        const Srp::Server::Service *service           = nullptr;
 
-        // Handle PTR/SRV/TXT query
-        if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
+        while ((service = GetNextSrpService(service, serviceName, queryInstanceName)) != nullptr)
         {
-            const Srp::Server::Service *service = nullptr;
+            const Srp::Server::Host &host            = service->GetHost();
+            uint32_t                 instanceTtl     = TimeMilli::MsecToSec(service->GetExpireTime() - now);
+            const char              *instanceName    = service->GetInstanceName();
+            bool                     ptrQueryMatched = (qtype == ResourceRecord::kTypePtr);
+            bool                     srvQueryMatched = (qtype == ResourceRecord::kTypeSrv);
+            bool                     txtQueryMatched = (qtype == ResourceRecord::kTypeTxt);
+
+            if (!aAdditional && ptrQueryMatched)
+            {
+                SuccessOrExit(error =
+                                  AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressor));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-            while ((service = GetNextSrpService(*host, service)) != nullptr)
+            if ((!aAdditional && srvQueryMatched) ||
+                (aAdditional && ptrQueryMatched &&
+                 !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
             {
-                uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
-                const char *instanceName        = service->GetInstanceName();
-                bool        serviceNameMatched  = service->MatchesServiceName(aName);
-                bool        instanceNameMatched = service->MatchesInstanceName(aName);
-                bool        ptrQueryMatched     = qtype == ResourceRecord::kTypePtr && serviceNameMatched;
-                bool        srvQueryMatched     = qtype == ResourceRecord::kTypeSrv && instanceNameMatched;
-                bool        txtQueryMatched     = qtype == ResourceRecord::kTypeTxt && instanceNameMatched;
-
-                if (ptrQueryMatched || srvQueryMatched)
-                {
-                    needAdditionalAaaaRecord = true;
-                }
+                SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, host.GetFullName(), instanceTtl,
+                                                      service->GetPriority(), service->GetWeight(), service->GetPort(),
+                                                      aCompressor));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-                if (!aAdditional && ptrQueryMatched)
-                {
-                    SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+            if ((!aAdditional && txtQueryMatched) ||
+                (aAdditional && ptrQueryMatched &&
+                 !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
+            {
+                SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
+                                                      service->GetTxtDataLength(), instanceTtl, aCompressor));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-                if ((!aAdditional && srvQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
-                {
-                    SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
-                                                          service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+            if (aAdditional && (ptrQueryMatched || srvQueryMatched))
+            {
+                // The AAAA records of a host are appended only once,
+                // along with the first matching service of the host.
+
+                const Srp::Server::Service *first = host.FindNextService(
+                    nullptr, Srp::Server::kFlagsAnyTypeActiveService, serviceName, queryInstanceName);
 
-                if ((!aAdditional && txtQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
+                if ((first == service) &&
+                    !HasQuestion(aResponseHeader, aResponseMessage, host.GetFullName(), ResourceRecord::kTypeAaaa))
                 {
-                    SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
+                    SuccessOrExit(error = AppendSrpHostAaaaRecords(host, aResponseHeader, aResponseMessage,
+                                                                   aCompressor, aAdditional));
                     response = Header::kResponseSuccess;
                 }
             }
         }
+    }
 
-        // Handle AAAA query
-        if ((!aAdditional && qtype == ResourceRecord::kTypeAaaa && host->Matches(aName)) ||
-            (aAdditional && needAdditionalAaaaRecord &&
-             !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa)))
-        {
-            uint8_t             addrNum;
-            const Ip6::Address *addrs   = host->GetAddresses(addrNum);
-            uint32_t            hostTtl = TimeMilli::MsecToSec(host->GetExpireTime() - now);
-
-            for (uint8_t i = 0; i < addrNum; i++)
-            {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
-                IncResourceRecordCount(aResponseHeader, aAdditional);
-            }
+    // Handle AAAA query
+    if (!aAdditional && qtype == ResourceRecord::kTypeAaaa)
+    {
+        const Srp::Server::Host *host = Get<Srp::Server>().FindHost(aName);
 
+        if ((host != nullptr) && !host->IsDeleted())
+        {
+            SuccessOrExit(error = AppendSrpHostAaaaRecords(*host, aResponseHeader, aResponseMessage, aCompressor,
+                                                           aAdditional));
             response = Header::kResponseSuccess;
         }
     }
@@ -795,28 +698,39 @@ exit:
     return error == kErrorNone ? response : Header::kResponseServerFailure;
 }
 
-const Srp::Server::Host *Server::GetNextSrpHost(const Srp::Server::Host *aHost)
+Error Server::AppendSrpHostAaaaRecords(const Srp::Server::Host &aHost,
+                                       Header                  &aResponseHeader,
+                                       Message                 &aResponseMessage,
+                                       NameCompressor          &aCompressor,
+                                       bool                     aAdditional)
 {
-    const Srp::Server::Host *host = Get<Srp::Server>().GetNextHost(aHost);
+    Error               error = kErrorNone;
+    uint8_t             addrNum;
+    const Ip6::Address *addrs   = aHost.GetAddresses(addrNum);
+    uint32_t            hostTtl = TimeMilli::MsecToSec(aHost.GetExpireTime() - TimerMilli::GetNow());
 
-    while (host != nullptr && host->IsDeleted())
+    for (uint8_t i = 0; i < addrNum; i++)
     {
-        host = Get<Srp::Server>().GetNextHost(host);
+        SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, aHost.GetFullName(), addrs[i], hostTtl, aCompressor));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
     }
 
-    return host;
+exit:
+    return error;
 }
 
-const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host    &aHost,
-                                                      const Srp::Server::Service *aService)
+const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Service *aService,
+                                                      const char                 *aServiceName,
+                                                      const char                 *aInstanceName)
 {
-    return aHost.FindNextService(aService, Srp::Server::kFlagsAnyTypeActiveService);
+    return Get<Srp::Server>().FindNextService(aService, Srp::Server::kFlagsAnyTypeActiveService, aServiceName,
+                                              aInstanceName);
 }
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
 Error Server::ResolveByQueryCallbacks(Header                 &aResponseHeader,
                                       Message                &aResponseMessage,
-                                      NameCompressInfo       &aCompressInfo,
+                                      NameCompressor         &aCompressor,
                                       const Ip6::MessageInfo &aMessageInfo)
 {
     QueryTransaction *query = nullptr;
@@ -830,7 +744,7 @@ Error Server::ResolveByQueryCallbacks(Header                 &aResponseHeader,
     queryType = GetQueryTypeAndName(aResponseHeader, aResponseMessage, name);
     VerifyOrExit(queryType != kDnsQueryNone, error = kErrorNotImplemented);
 
-    query = NewQuery(aResponseHeader, aResponseMessage, aCompressInfo, aMessageInfo);
+    query = NewQuery(aResponseHeader, aResponseMessage, aCompressor, aMessageInfo);
     VerifyOrExit(query != nullptr, error = kErrorNoBufs);
 
     mQuerySubscribe(mQueryCallbackContext, name);
@@ -841,7 +755,7 @@ exit:
 
 Server::QueryTransaction *Server::NewQuery(const Header           &aResponseHeader,
                                            Message                &aResponseMessage,
-                                           const NameCompressInfo &aCompressInfo,
+                                           const NameCompressor   &aCompressor,
                                            const Ip6::MessageInfo &aMessageInfo)
 {
     QueryTransaction *newQuery = nullptr;
@@ -853,7 +767,7 @@ Server::QueryTransaction *Server::NewQuery(const Header           &aResponseHead
             continue;
         }
 
-        query.Init(aResponseHeader, aResponseMessage, aCompressInfo, aMessageInfo, GetInstance());
+        query.Init(aResponseHeader, aResponseMessage, aCompressor, aMessageInfo, GetInstance());
         ExitNow(newQuery = &query);
     }
 
@@ -907,13 +821,13 @@ void Server::AnswerQuery(QueryTransaction                 &aQuery,
     Header           &responseHeader  = aQuery.GetResponseHeader();
     Message          &responseMessage = aQuery.GetResponseMessage();
     Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    NameCompressor &compressor    = aQuery.GetNameCompressor();
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aServiceFullName,
                     ResourceRecord::kTypePtr))
     {
         SuccessOrExit(error = AppendPtrRecord(responseMessage, aServiceFullName, aInstanceInfo.mFullName,
-                                              aInstanceInfo.mTtl, compressInfo));
+                                              aInstanceInfo.mTtl, compressor));
         IncResourceRecordCount(responseHeader, false);
     }
 
@@ -924,7 +838,7 @@ void Server::AnswerQuery(QueryTransaction                 &aQuery,
         {
             SuccessOrExit(error = AppendSrvRecord(responseMessage, aInstanceInfo.mFullName, aInstanceInfo.mHostName,
                                                   aInstanceInfo.mTtl, aInstanceInfo.mPriority, aInstanceInfo.mWeight,
-                                                  aInstanceInfo.mPort, compressInfo));
+                                                  aInstanceInfo.mPort, compressor));
             IncResourceRecordCount(responseHeader, additional);
         }
 
@@ -932,7 +846,7 @@ void Server::AnswerQuery(QueryTransaction                 &aQuery,
                         ResourceRecord::kTypeTxt) == !additional)
         {
             SuccessOrExit(error = AppendTxtRecord(responseMessage, aInstanceInfo.mFullName, aInstanceInfo.mTxtData,
-                                                  aInstanceInfo.mTxtLength, aInstanceInfo.mTtl, compressInfo));
+                                                  aInstanceInfo.mTxtLength, aInstanceInfo.mTtl, compressor));
             IncResourceRecordCount(responseHeader, additional);
         }
 
@@ -947,7 +861,7 @@ void Server::AnswerQuery(QueryTransaction                 &aQuery,
                           !address.IsLoopback());
 
                 SuccessOrExit(error = AppendAaaaRecord(responseMessage, aInstanceInfo.mHostName, address,
-                                                       aInstanceInfo.mTtl, compressInfo));
+                                                       aInstanceInfo.mTtl, compressor));
                 IncResourceRecordCount(responseHeader, additional);
             }
         }
@@ -963,7 +877,7 @@ void Server::AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, co
     Header           &responseHeader  = aQuery.GetResponseHeader();
     Message          &responseMessage = aQuery.GetResponseMessage();
     Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    NameCompressor &compressor    = aQuery.GetNameCompressor();
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aHostFullName, ResourceRecord::kTypeAaaa))
     {
@@ -975,7 +889,7 @@ void Server::AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, co
                       !address.IsLoopback());
 
             SuccessOrExit(error =
-                              AppendAaaaRecord(responseMessage, aHostFullName, address, aHostInfo.mTtl, compressInfo));
+                              AppendAaaaRecord(responseMessage, aHostFullName, address, aHostInfo.mTtl, compressor));
             IncResourceRecordCount(responseHeader, /* aAdditional */ false);
         }
     }
@@ -1199,7 +1113,7 @@ void Server::FinalizeQuery(QueryTransaction &aQuery, Header::Response aResponseC
 
 void Server::QueryTransaction::Init(const Header           &aResponseHeader,
                                     Message                &aResponseMessage,
-                                    const NameCompressInfo &aCompressInfo,
+                                    const NameCompressor   &aCompressor,
                                     const Ip6::MessageInfo &aMessageInfo,
                                     Instance               &aInstance)
 {
@@ -1208,7 +1122,7 @@ void Server::QueryTransaction::Init(const Header           &aResponseHeader,
     InstanceLocatorInit::Init(aInstance);
     mResponseHeader  = aResponseHeader;
     mResponseMessage = &aResponseMessage;
-    mCompressInfo    = aCompressInfo;
+    mCompressor    = aCompressor;
     mMessageInfo     = aMessageInfo;
     mStartTime       = TimerMilli::GetNow();
 }
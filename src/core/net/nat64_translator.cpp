@@ -37,8 +37,11 @@
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "common/hash.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/num_utils.hpp"
 #include "net/checksum.hpp"
 #include "net/ip4_types.hpp"
 #include "net/ip6.hpp"
@@ -48,6 +51,8 @@ namespace Nat64 {
 
 RegisterLogModule("Nat64");
 
+using ot::Encoding::BigEndian::HostSwap16;
+
 const char *StateToString(State aState)
 {
     static const char *const kStateString[] = {
@@ -68,13 +73,17 @@ const char *StateToString(State aState)
 Translator::Translator(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(State::kStateDisabled)
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    , mNextIp4PortOrId(kMinDynamicPortOrId)
+#endif
     , mMappingExpirerTimer(aInstance)
 {
     Random::NonCrypto::FillBuffer(reinterpret_cast<uint8_t *>(&mNextMappingId), sizeof(mNextMappingId));
 
+    ClearMappingIndex();
     mNat64Prefix.Clear();
     mIp4Cidr.Clear();
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
+    mMappingExpirerTimer.Start(kMappingExpirerIntervalMsec);
 }
 
 Message *Translator::NewIp4Message(const Message::Settings &aSettings)
@@ -115,7 +124,9 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
     ErrorCounters::Reason dropReason = ErrorCounters::kUnknown;
     Ip6::Header           ip6Header;
     Ip4::Header           ip4Header;
-    AddressMapping       *mapping = nullptr;
+    AddressMapping       *mapping  = nullptr;
+    uint8_t               protocol = 0;
+    uint16_t              portOrId = 0;
 
     if (mIp4Cidr.mLength == 0 || !mNat64Prefix.IsValidNat64())
     {
@@ -135,7 +146,25 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
         ExitNow(res = kNotTranslated);
     }
 
-    mapping = FindOrAllocateMapping(ip6Header.GetSource());
+    aMessage.RemoveHeader(sizeof(Ip6::Header));
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    protocol = ip6Header.GetNextHeader();
+
+    switch (ReadPortOrId(aMessage, protocol, /* aIsSource */ true, portOrId))
+    {
+    case kErrorNone:
+        break;
+    case kErrorParse:
+        dropReason = ErrorCounters::Reason::kIllegalPacket;
+        ExitNow(res = kDrop);
+    default:
+        dropReason = ErrorCounters::Reason::kUnsupportedProto;
+        ExitNow(res = kDrop);
+    }
+#endif
+
+    mapping = FindOrAllocateMapping(ip6Header.GetSource(), protocol, portOrId);
     if (mapping == nullptr)
     {
         LogWarn("failed to get a mapping for %s (mapping pool full?)", ip6Header.GetSource().ToString().AsCString());
@@ -143,7 +172,9 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
         ExitNow(res = kDrop);
     }
 
-    aMessage.RemoveHeader(sizeof(Ip6::Header));
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    WritePortOrId(aMessage, protocol, /* aIsSource */ true, mapping->mIp4PortOrId);
+#endif
 
     ip4Header.Clear();
     ip4Header.InitVersionIhl();
@@ -202,7 +233,9 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
     ErrorCounters::Reason dropReason = ErrorCounters::kUnknown;
     Ip6::Header           ip6Header;
     Ip4::Header           ip4Header;
-    AddressMapping       *mapping = nullptr;
+    AddressMapping       *mapping  = nullptr;
+    uint8_t               protocol = 0;
+    uint16_t              portOrId = 0;
 
     // Ip6::Header::ParseFrom may return an error value when the incoming message is an IPv4 datagram.
     // If the message is already an IPv6 datagram, forward it directly.
@@ -228,7 +261,26 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
         ExitNow(res = kDrop);
     }
 
-    mapping = FindMapping(ip4Header.GetDestination());
+    aMessage.RemoveHeader(sizeof(Ip4::Header));
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // Mappings are keyed by the IPv6 protocol number, UDP and TCP use the same numbers in IPv4 and IPv6.
+    protocol = (ip4Header.GetProtocol() == Ip4::kProtoIcmp) ? Ip6::kProtoIcmp6 : ip4Header.GetProtocol();
+
+    switch (ReadPortOrId(aMessage, protocol, /* aIsSource */ false, portOrId))
+    {
+    case kErrorNone:
+        break;
+    case kErrorParse:
+        dropReason = ErrorCounters::Reason::kIllegalPacket;
+        ExitNow(res = kDrop);
+    default:
+        dropReason = ErrorCounters::Reason::kUnsupportedProto;
+        ExitNow(res = kDrop);
+    }
+#endif
+
+    mapping = FindMapping(ip4Header.GetDestination(), protocol, portOrId);
     if (mapping == nullptr)
     {
         LogWarn("no mapping found for the IPv4 address");
@@ -236,7 +288,9 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
         ExitNow(res = kDrop);
     }
 
-    aMessage.RemoveHeader(sizeof(Ip4::Header));
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    WritePortOrId(aMessage, protocol, /* aIsSource */ false, mapping->mIp6PortOrId);
+#endif
 
     ip6Header.Clear();
     ip6Header.InitVersionTrafficClassFlow();
@@ -295,11 +349,38 @@ Translator::AddressMapping::InfoString Translator::AddressMapping::ToString(void
 {
     InfoString string;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    string.Append("[%s]:%u -> %s:%u", mIp6.ToString().AsCString(), mIp6PortOrId, mIp4.ToString().AsCString(),
+                  mIp4PortOrId);
+#else
     string.Append("%s -> %s", mIp6.ToString().AsCString(), mIp4.ToString().AsCString());
+#endif
 
     return string;
 }
 
+uint32_t Translator::AddressMapping::GetIdleTimeout(void) const
+{
+    uint32_t timeout = kAddressMappingIdleTimeoutMsec;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    switch (mProtocol)
+    {
+    case Ip6::kProtoUdp:
+        timeout = kUdpMappingIdleTimeoutMsec;
+        break;
+    case Ip6::kProtoTcp:
+        timeout = kTcpMappingIdleTimeoutMsec;
+        break;
+    case Ip6::kProtoIcmp6:
+        timeout = kIcmpMappingIdleTimeoutMsec;
+        break;
+    }
+#endif
+
+    return timeout;
+}
+
 void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMilli aNow) const
 {
     aMapping.mId       = mId;
@@ -307,6 +388,9 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
     aMapping.mIp6      = mIp6;
     aMapping.mCounters = mCounters;
 
+    aMapping.mSrcPortOrId        = mIp6PortOrId;
+    aMapping.mTranslatedPortOrId = mIp4PortOrId;
+
     // We are removing expired mappings lazily, and an expired mapping might become active again before actually
     // removed. Report the mapping to be "just expired" to avoid confusion.
     if (mExpiry < aNow)
@@ -321,7 +405,10 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
 
 void Translator::ReleaseMapping(AddressMapping &aMapping)
 {
+    RemoveFromMappingIndex(aMapping);
+#if !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     IgnoreError(mIp4AddressPool.PushBack(aMapping.mIp4));
+#endif
     mAddressMappingPool.Free(aMapping);
     LogInfo("mapping removed: %s", aMapping.ToString().AsCString());
 }
@@ -348,10 +435,23 @@ uint16_t Translator::ReleaseExpiredMappings(void)
     return ReleaseMappings(idleMappings);
 }
 
-Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6Addr)
+Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6Addr,
+                                                        uint8_t             aProtocol,
+                                                        uint16_t            aPortOrId)
 {
     AddressMapping *mapping = nullptr;
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // The IPv4 addresses are shared by all the mappings, so only the mapping pool can be exhausted.
+    mapping = mAddressMappingPool.Allocate();
+
+    if (mapping == nullptr)
+    {
+        // ReleaseExpiredMappings returns the number of mappings removed.
+        VerifyOrExit(ReleaseExpiredMappings() > 0);
+        mapping = mAddressMappingPool.Allocate();
+    }
+#else
     // The address pool will be no larger than the mapping pool, so checking the address pool is enough.
     if (mIp4AddressPool.IsEmpty())
     {
@@ -359,16 +459,34 @@ Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6
         VerifyOrExit(ReleaseExpiredMappings() > 0);
     }
 
-    mapping = mAddressMappingPool.Allocate();
     // We should get a valid item since address pool is no larger than the mapping pool, and the address pool is not
     // empty.
+    mapping = mAddressMappingPool.Allocate();
+#endif
     VerifyOrExit(mapping != nullptr);
 
-    mActiveAddressMappings.Push(*mapping);
-    mapping->mId  = ++mNextMappingId;
-    mapping->mIp6 = aIp6Addr;
+    mapping->mId          = ++mNextMappingId;
+    mapping->mIp6         = aIp6Addr;
+    mapping->mIp6PortOrId = aPortOrId;
+    mapping->mProtocol    = aProtocol;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // All the mappings of an IPv6 host use the same IPv4 address, the hosts are spread over the address pool.
+    mapping->mIp4 = mIp4AddressPool[GetIp6Bucket(aIp6Addr, 0, 0) % mIp4AddressPool.GetLength()];
+
+    if (AllocateIp4PortOrId(*mapping) != kErrorNone)
+    {
+        mAddressMappingPool.Free(*mapping);
+        ExitNow(mapping = nullptr);
+    }
+#else
     // PopBack must return a valid address since it is not empty.
-    mapping->mIp4 = *mIp4AddressPool.PopBack();
+    mapping->mIp4         = *mIp4AddressPool.PopBack();
+    mapping->mIp4PortOrId = 0;
+#endif
+
+    mActiveAddressMappings.Push(*mapping);
+    AddToMappingIndex(*mapping);
     mapping->Touch(TimerMilli::GetNow());
     LogInfo("mapping created: %s", mapping->ToString().AsCString());
 
@@ -376,22 +494,34 @@ exit:
     return mapping;
 }
 
-Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Address &aIp6Addr)
+Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Address &aIp6Addr,
+                                                              uint8_t             aProtocol,
+                                                              uint16_t            aPortOrId)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp6Addr);
+    AddressMapping *mapping = FindIndexedMapping(aIp6Addr, aProtocol, aPortOrId);
 
-    // Exit if we found a valid mapping.
-    VerifyOrExit(mapping == nullptr);
+    if (mapping != nullptr)
+    {
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        // With port translation, outgoing datagrams also keep the
+        // mapping alive (e.g., a UDP flow with no replies keeps its
+        // port). Otherwise only incoming datagrams refresh it.
+        mapping->Touch(TimerMilli::GetNow());
+#endif
+        ExitNow();
+    }
 
-    mapping = AllocateMapping(aIp6Addr);
+    mapping = AllocateMapping(aIp6Addr, aProtocol, aPortOrId);
 
 exit:
     return mapping;
 }
 
-Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr)
+Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr,
+                                                    uint8_t             aProtocol,
+                                                    uint16_t            aPortOrId)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp4Addr);
+    AddressMapping *mapping = FindIndexedMapping(aIp4Addr, aProtocol, aPortOrId);
 
     if (mapping != nullptr)
     {
@@ -400,6 +530,213 @@ Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr
     return mapping;
 }
 
+uint16_t Translator::GetIp6Bucket(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPortOrId)
+{
+    Hash hash;
+
+    for (uint32_t word : aIp6Addr.mFields.m32)
+    {
+        hash.Update(word);
+    }
+
+    hash.Update((static_cast<uint32_t>(aProtocol) << 16) | aPortOrId);
+
+    return hash.GetBucket(kNumMappingBuckets);
+}
+
+uint16_t Translator::GetIp4Bucket(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPortOrId)
+{
+    Hash hash;
+
+    hash.Update(aIp4Addr.mFields.m32);
+    hash.Update((static_cast<uint32_t>(aProtocol) << 16) | aPortOrId);
+
+    return hash.GetBucket(kNumMappingBuckets);
+}
+
+void Translator::ClearMappingIndex(void)
+{
+    for (uint16_t &index : mIp6MappingBuckets)
+    {
+        index = kInvalidMappingIndex;
+    }
+
+    for (uint16_t &index : mIp4MappingBuckets)
+    {
+        index = kInvalidMappingIndex;
+    }
+}
+
+void Translator::AddToMappingIndex(AddressMapping &aMapping)
+{
+    uint16_t index     = mAddressMappingPool.GetIndexOf(aMapping);
+    uint16_t ip6Bucket = GetIp6Bucket(aMapping.mIp6, aMapping.mProtocol, aMapping.mIp6PortOrId);
+    uint16_t ip4Bucket = GetIp4Bucket(aMapping.mIp4, aMapping.mProtocol, aMapping.mIp4PortOrId);
+
+    aMapping.mNextByIp6           = mIp6MappingBuckets[ip6Bucket];
+    mIp6MappingBuckets[ip6Bucket] = index;
+
+    aMapping.mNextByIp4           = mIp4MappingBuckets[ip4Bucket];
+    mIp4MappingBuckets[ip4Bucket] = index;
+}
+
+void Translator::RemoveFromMappingIndex(AddressMapping &aMapping)
+{
+    uint16_t  index = mAddressMappingPool.GetIndexOf(aMapping);
+    uint16_t *link;
+
+    link = &mIp6MappingBuckets[GetIp6Bucket(aMapping.mIp6, aMapping.mProtocol, aMapping.mIp6PortOrId)];
+
+    while (*link != kInvalidMappingIndex)
+    {
+        if (*link == index)
+        {
+            *link = aMapping.mNextByIp6;
+            break;
+        }
+
+        link = &mAddressMappingPool.GetEntryAt(*link).mNextByIp6;
+    }
+
+    link = &mIp4MappingBuckets[GetIp4Bucket(aMapping.mIp4, aMapping.mProtocol, aMapping.mIp4PortOrId)];
+
+    while (*link != kInvalidMappingIndex)
+    {
+        if (*link == index)
+        {
+            *link = aMapping.mNextByIp4;
+            break;
+        }
+
+        link = &mAddressMappingPool.GetEntryAt(*link).mNextByIp4;
+    }
+}
+
+Translator::AddressMapping *Translator::FindIndexedMapping(const Ip6::Address &aIp6Addr,
+                                                           uint8_t             aProtocol,
+                                                           uint16_t            aPortOrId)
+{
+    AddressMapping *mapping = nullptr;
+    uint16_t        index   = mIp6MappingBuckets[GetIp6Bucket(aIp6Addr, aProtocol, aPortOrId)];
+
+    while (index != kInvalidMappingIndex)
+    {
+        AddressMapping &entry = mAddressMappingPool.GetEntryAt(index);
+
+        if (entry.Matches(aIp6Addr, aProtocol, aPortOrId))
+        {
+            ExitNow(mapping = &entry);
+        }
+
+        index = entry.mNextByIp6;
+    }
+
+exit:
+    return mapping;
+}
+
+Translator::AddressMapping *Translator::FindIndexedMapping(const Ip4::Address &aIp4Addr,
+                                                           uint8_t             aProtocol,
+                                                           uint16_t            aPortOrId)
+{
+    AddressMapping *mapping = nullptr;
+    uint16_t        index   = mIp4MappingBuckets[GetIp4Bucket(aIp4Addr, aProtocol, aPortOrId)];
+
+    while (index != kInvalidMappingIndex)
+    {
+        AddressMapping &entry = mAddressMappingPool.GetEntryAt(index);
+
+        if (entry.Matches(aIp4Addr, aProtocol, aPortOrId))
+        {
+            ExitNow(mapping = &entry);
+        }
+
+        index = entry.mNextByIp4;
+    }
+
+exit:
+    return mapping;
+}
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
+static uint16_t GetPortOrIdOffset(uint8_t aProtocol, bool aIsSource)
+{
+    // The caller consumed the IP header, so the transport header is at offset 0. Echo messages have the same layout
+    // in ICMP and ICMPv6, the identifier follows the type, code and checksum fields.
+
+    return (aProtocol == Ip6::kProtoIcmp6) ? 4 : (aIsSource ? 0 : sizeof(uint16_t));
+}
+
+static bool IsIcmpEcho(uint8_t aType, bool aIsSource)
+{
+    // Source ports are read from outgoing ICMPv6 messages, destination ports from incoming ICMP (v4) messages.
+
+    return aIsSource
+               ? ((aType == Ip6::Icmp::Header::kTypeEchoRequest) || (aType == Ip6::Icmp::Header::kTypeEchoReply))
+               : ((aType == Ip4::Icmp::Header::kTypeEchoRequest) || (aType == Ip4::Icmp::Header::kTypeEchoReply));
+}
+
+Error Translator::ReadPortOrId(const Message &aMessage, uint8_t aProtocol, bool aIsSource, uint16_t &aPortOrId)
+{
+    Error   error;
+    uint8_t icmpType;
+
+    switch (aProtocol)
+    {
+    case Ip6::kProtoUdp:
+    case Ip6::kProtoTcp:
+        break;
+    case Ip6::kProtoIcmp6:
+        // Only echo messages carry an identifier. ICMP error messages would need the embedded datagram to be looked
+        // up and translated, which is not supported, so they are dropped.
+        SuccessOrExit(error = aMessage.Read(0, icmpType));
+        VerifyOrExit(IsIcmpEcho(icmpType, aIsSource), error = kErrorNotImplemented);
+        break;
+    default:
+        ExitNow(error = kErrorNotImplemented);
+    }
+
+    SuccessOrExit(error = aMessage.Read(GetPortOrIdOffset(aProtocol, aIsSource), aPortOrId));
+    aPortOrId = HostSwap16(aPortOrId);
+
+exit:
+    return error;
+}
+
+void Translator::WritePortOrId(Message &aMessage, uint8_t aProtocol, bool aIsSource, uint16_t aPortOrId)
+{
+    aMessage.Write(GetPortOrIdOffset(aProtocol, aIsSource), HostSwap16(aPortOrId));
+}
+
+Error Translator::AllocateIp4PortOrId(AddressMapping &aMapping)
+{
+    // Keeps the port (or ICMP echo identifier) of the IPv6 host when it is not in use on the IPv4 address, otherwise
+    // picks the next one from the dynamic range. At most `kAddressMappingPoolSize - 1` other mappings exist, so one of
+    // the `kAddressMappingPoolSize + 1` candidates (at least `kAddressMappingPoolSize` distinct) is always free.
+
+    Error    error    = kErrorNotFound;
+    uint16_t portOrId = aMapping.mIp6PortOrId;
+
+    for (uint32_t attempt = 0; attempt <= kAddressMappingPoolSize; attempt++)
+    {
+        if (FindIndexedMapping(aMapping.mIp4, aMapping.mProtocol, portOrId) == nullptr)
+        {
+            aMapping.mIp4PortOrId = portOrId;
+            ExitNow(error = kErrorNone);
+        }
+
+        portOrId = mNextIp4PortOrId;
+        mNextIp4PortOrId =
+            (mNextIp4PortOrId == NumericLimits<uint16_t>::kMax) ? kMinDynamicPortOrId : mNextIp4PortOrId + 1;
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+
 Error Translator::TranslateIcmp4(Message &aMessage)
 {
     Error             err = kErrorNone;
@@ -492,6 +829,7 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
 
     mAddressMappingPool.FreeAll();
     mActiveAddressMappings.Clear();
+    ClearMappingIndex();
     mIp4AddressPool.Clear();
 
     for (uint32_t i = 0; i < numberOfHosts; i++)
@@ -540,8 +878,14 @@ exit:
 
 void Translator::HandleMappingExpirerTimer(void)
 {
-    LogInfo("Released %d expired mappings", ReleaseExpiredMappings());
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
+    // `LogInfo()` arguments are not evaluated when the log level is
+    // below info, so release the mappings before logging.
+    uint16_t numReleased = ReleaseExpiredMappings();
+
+    LogInfo("Released %u expired mappings", numReleased);
+    OT_UNUSED_VARIABLE(numReleased);
+
+    mMappingExpirerTimer.Start(kMappingExpirerIntervalMsec);
 }
 
 void Translator::InitAddressMappingIterator(AddressMappingIterator &aIterator)
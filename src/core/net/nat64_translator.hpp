@@ -78,6 +78,14 @@ public:
     static constexpr uint32_t kAddressMappingIdleTimeoutMsec =
         OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
     static constexpr uint32_t kAddressMappingPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static constexpr uint32_t kUdpMappingIdleTimeoutMsec =
+        OPENTHREAD_CONFIG_NAT64_UDP_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
+    static constexpr uint32_t kTcpMappingIdleTimeoutMsec =
+        OPENTHREAD_CONFIG_NAT64_TCP_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
+    static constexpr uint32_t kIcmpMappingIdleTimeoutMsec =
+        OPENTHREAD_CONFIG_NAT64_ICMP_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
+#endif
 
     typedef otNat64AddressMappingIterator AddressMappingIterator; ///< Address mapping Iterator.
 
@@ -344,23 +352,38 @@ private:
         friend class LinkedListEntry<AddressMapping>;
         friend class LinkedList<AddressMapping>;
 
-        typedef String<Ip6::Address::kInfoStringSize + Ip4::Address::kAddressStringSize + 4> InfoString;
+        typedef String<Ip6::Address::kInfoStringSize + Ip4::Address::kAddressStringSize + 20> InfoString;
 
-        void       Touch(TimeMilli aNow) { mExpiry = aNow + kAddressMappingIdleTimeoutMsec; }
+        void       Touch(TimeMilli aNow) { mExpiry = aNow + GetIdleTimeout(); }
+        uint32_t   GetIdleTimeout(void) const;
         InfoString ToString(void) const;
         void       CopyTo(otNat64AddressMapping &aMapping, TimeMilli aNow) const;
 
+        bool Matches(const Ip6::Address &aIp6, uint8_t aProtocol, uint16_t aPortOrId) const
+        {
+            return (mIp6 == aIp6) && (mProtocol == aProtocol) && (mIp6PortOrId == aPortOrId);
+        }
+
+        bool Matches(const Ip4::Address &aIp4, uint8_t aProtocol, uint16_t aPortOrId) const
+        {
+            return (mIp4 == aIp4) && (mProtocol == aProtocol) && (mIp4PortOrId == aPortOrId);
+        }
+
         uint64_t mId; // The unique id for a mapping session.
 
         Ip4::Address mIp4;
         Ip6::Address mIp6;
-        TimeMilli    mExpiry; // The timestamp when this mapping expires, in milliseconds.
+        uint16_t     mIp6PortOrId; // Port (or ICMP echo identifier) of the IPv6 host, zero if ports are not translated.
+        uint16_t     mIp4PortOrId; // Port (or ICMP echo identifier) on the IPv4 side, zero if ports are not translated.
+        uint8_t      mProtocol;    // IPv6 protocol number of the mapping, zero if ports are not translated.
+        TimeMilli    mExpiry;      // The timestamp when this mapping expires, in milliseconds.
 
         ProtocolCounters mCounters;
 
+        uint16_t mNextByIp6; // Index of the next mapping in the same IPv6 hash bucket.
+        uint16_t mNextByIp4; // Index of the next mapping in the same IPv4 hash bucket.
+
     private:
-        bool Matches(const Ip4::Address &aIp4) const { return mIp4 == aIp4; }
-        bool Matches(const Ip6::Address &aIp6) const { return mIp6 == aIp6; }
         bool Matches(const TimeMilli aNow) const { return mExpiry < aNow; }
 
         AddressMapping *mNext;
@@ -372,9 +395,46 @@ private:
     uint16_t        ReleaseMappings(LinkedList<AddressMapping> &aMappings);
     void            ReleaseMapping(AddressMapping &aMapping);
     uint16_t        ReleaseExpiredMappings(void);
-    AddressMapping *AllocateMapping(const Ip6::Address &aIp6Addr);
-    AddressMapping *FindOrAllocateMapping(const Ip6::Address &aIp6Addr);
-    AddressMapping *FindMapping(const Ip4::Address &aIp4Addr);
+    AddressMapping *AllocateMapping(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPortOrId);
+    AddressMapping *FindOrAllocateMapping(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPortOrId);
+    AddressMapping *FindMapping(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPortOrId);
+
+    // With port translation, the expirer runs at the shortest of the
+    // per-protocol idle timeouts. Otherwise it runs at the address
+    // mapping idle timeout.
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static constexpr uint32_t kMinUdpTcpIdleTimeoutMsec = (kUdpMappingIdleTimeoutMsec < kTcpMappingIdleTimeoutMsec)
+                                                              ? kUdpMappingIdleTimeoutMsec
+                                                              : kTcpMappingIdleTimeoutMsec;
+    static constexpr uint32_t kMappingExpirerIntervalMsec = (kIcmpMappingIdleTimeoutMsec < kMinUdpTcpIdleTimeoutMsec)
+                                                                ? kIcmpMappingIdleTimeoutMsec
+                                                                : kMinUdpTcpIdleTimeoutMsec;
+#else
+    static constexpr uint32_t kMappingExpirerIntervalMsec = kAddressMappingIdleTimeoutMsec;
+#endif
+
+    // The active mappings are indexed by both their IPv6 and IPv4 keys. Each bucket holds the pool index of the first
+    // mapping in the chain, the chains are linked through `mNextByIp6` and `mNextByIp4`.
+    static constexpr uint16_t kNumMappingBuckets   = kAddressMappingPoolSize;
+    static constexpr uint16_t kInvalidMappingIndex = 0xffff;
+
+    static_assert(kAddressMappingPoolSize < kInvalidMappingIndex, "NAT64_MAX_MAPPINGS is too large");
+
+    static uint16_t GetIp6Bucket(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPortOrId);
+    static uint16_t GetIp4Bucket(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPortOrId);
+    void            ClearMappingIndex(void);
+    void            AddToMappingIndex(AddressMapping &aMapping);
+    void            RemoveFromMappingIndex(AddressMapping &aMapping);
+    AddressMapping *FindIndexedMapping(const Ip6::Address &aIp6Addr, uint8_t aProtocol, uint16_t aPortOrId);
+    AddressMapping *FindIndexedMapping(const Ip4::Address &aIp4Addr, uint8_t aProtocol, uint16_t aPortOrId);
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static constexpr uint16_t kMinDynamicPortOrId = 1024;
+
+    static Error ReadPortOrId(const Message &aMessage, uint8_t aProtocol, bool aIsSource, uint16_t &aPortOrId);
+    static void  WritePortOrId(Message &aMessage, uint8_t aProtocol, bool aIsSource, uint16_t aPortOrId);
+    Error        AllocateIp4PortOrId(AddressMapping &aMapping);
+#endif
 
     void HandleMappingExpirerTimer(void);
 
@@ -390,6 +450,11 @@ private:
     Array<Ip4::Address, kAddressMappingPoolSize>  mIp4AddressPool;
     Pool<AddressMapping, kAddressMappingPoolSize> mAddressMappingPool;
     LinkedList<AddressMapping>                    mActiveAddressMappings;
+    uint16_t                                      mIp6MappingBuckets[kNumMappingBuckets];
+    uint16_t                                      mIp4MappingBuckets[kNumMappingBuckets];
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    uint16_t mNextIp4PortOrId;
+#endif
 
     Ip6::Prefix mNat64Prefix;
     Ip4::Cidr   mIp4Cidr;
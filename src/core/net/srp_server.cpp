@@ -37,6 +37,7 @@
 
 #include "common/as_core_type.hpp"
 #include "common/const_cast.hpp"
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
@@ -88,6 +89,12 @@ Server::Server(Instance &aInstance)
     , mSocket(aInstance)
     , mLeaseTimer(aInstance)
     , mOutstandingUpdatesTimer(aInstance)
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    , mPendingUpdatesTasklet(aInstance)
+    , mSignatureVerifyRetryTimer(aInstance)
+    , mNumPendingUpdates(0)
+    , mNumSignatureVerifyInFlight(0)
+#endif
     , mServiceUpdateId(Random::NonCrypto::GetUint32())
     , mPort(kUdpPortMin)
     , mState(kStateDisabled)
@@ -99,6 +106,12 @@ Server::Server(Instance &aInstance)
 #endif
 {
     IgnoreError(SetDomain(kDefaultDomain));
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    memset(mHostNameBuckets, 0, sizeof(mHostNameBuckets));
+    memset(mServiceNameBuckets, 0, sizeof(mServiceNameBuckets));
+    memset(mInstanceNameBuckets, 0, sizeof(mInstanceNameBuckets));
+#endif
 }
 
 Error Server::SetAddressMode(AddressMode aMode)
@@ -313,9 +326,23 @@ void Server::AddHost(Host &aHost)
 {
     LogInfo("Add new host %s", aHost.GetFullName());
 
-    OT_ASSERT(mHosts.FindMatching(aHost.GetFullName()) == nullptr);
+    OT_ASSERT(FindHost(aHost.GetFullName()) == nullptr);
     IgnoreError(mHosts.Add(aHost));
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    AddToNameIndex(aHost);
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+    UpdateLeaseQueue(aHost);
+
+    for (Service &service : aHost.mServices)
+    {
+        UpdateLeaseQueue(service);
+    }
+#endif
 }
+
 void Server::RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyServiceHandler)
 {
     VerifyOrExit(aHost != nullptr);
@@ -326,10 +353,19 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyS
     if (aRetainName)
     {
         LogInfo("Remove host %s (but retain its name)", aHost->GetFullName());
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+        UpdateLeaseQueue(*aHost);
+#endif
     }
     else
     {
         aHost->mKeyLease = 0;
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        RemoveFromNameIndex(*aHost);
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+        RemoveFromLeaseQueue(*aHost);
+#endif
         IgnoreError(mHosts.Remove(*aHost));
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
@@ -356,10 +392,94 @@ exit:
     return;
 }
 
+Server::Host *Server::FindHost(const char *aFullName) { return AsNonConst(AsConst(this)->FindHost(aFullName)); }
+
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    const Host *host = mHostNameBuckets[GetNameIndexBucket(aFullName)];
+
+    while ((host != nullptr) && !host->Matches(aFullName))
+    {
+        host = host->mNextInNameBucket;
+    }
+
+    return host;
+#else
+    return mHosts.FindMatching(aFullName);
+#endif
+}
+
+const Server::Service *Server::FindNextService(const Service *aPrevService,
+                                               Service::Flags aFlags,
+                                               const char    *aServiceName,
+                                               const char    *aInstanceName) const
+{
+    const Service *service;
+
+    OT_ASSERT((aServiceName != nullptr) || (aInstanceName != nullptr));
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    // Walks the instance name chain when an instance name is given,
+    // otherwise the service name chain.
+
+    if (aInstanceName != nullptr)
+    {
+        service = (aPrevService == nullptr) ? mInstanceNameBuckets[GetNameIndexBucket(aInstanceName)]
+                                            : aPrevService->mNextInInstanceNameBucket;
+    }
+    else
+    {
+        service = (aPrevService == nullptr) ? mServiceNameBuckets[GetNameIndexBucket(aServiceName)]
+                                            : aPrevService->mNextInServiceNameBucket;
+    }
+
+    for (; service != nullptr;
+         service = (aInstanceName != nullptr) ? service->mNextInInstanceNameBucket : service->mNextInServiceNameBucket)
+    {
+        if (!service->MatchesFlags(aFlags))
+        {
+            continue;
+        }
+
+        if ((aServiceName != nullptr) && !service->MatchesServiceName(aServiceName))
+        {
+            continue;
+        }
+
+        if ((aInstanceName != nullptr) && !service->MatchesInstanceName(aInstanceName))
+        {
+            continue;
+        }
+
+        break;
+    }
+#else
+    const Service *prevService = aPrevService;
+
+    service = nullptr;
+
+    for (const Host *host = (prevService == nullptr) ? mHosts.GetHead() : &prevService->GetHost(); host != nullptr;
+         host             = host->GetNext())
+    {
+        service = host->FindNextService(prevService, aFlags, aServiceName, aInstanceName);
+
+        if (service != nullptr)
+        {
+            break;
+        }
+
+        prevService = nullptr;
+    }
+#endif
+
+    return service;
+}
+
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && aHost.GetKeyRecord()->GetKey() != existingHost->GetKeyRecord()->GetKey())
     {
@@ -369,14 +489,15 @@ bool Server::HasNameConflictsWith(Host &aHost) const
 
     for (const Service &service : aHost.mServices)
     {
-        // Check on all hosts for a matching service with the same
-        // instance name and if found, verify that it has the same
-        // key.
+        // Check on all registered services with the same instance
+        // name and if found, verify that their host has the same key.
+
+        const Service *existingService = nullptr;
 
-        for (const Host &host : mHosts)
+        while ((existingService = FindNextService(existingService, kFlagsAnyService, /* aServiceName */ nullptr,
+                                                  service.GetInstanceName())) != nullptr)
         {
-            if (host.HasServiceInstance(service.GetInstanceName()) &&
-                aHost.GetKeyRecord()->GetKey() != host.GetKeyRecord()->GetKey())
+            if (aHost.GetKeyRecord()->GetKey() != existingService->GetHost().GetKeyRecord()->GetKey())
             {
                 LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
                 ExitNow(hasConflicts = true);
@@ -388,6 +509,105 @@ exit:
     return hasConflicts;
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+
+uint16_t Server::GetNameIndexBucket(const char *aName)
+{
+    // Names are matched case-insensitively, so the hash is computed
+    // over the lowercase characters.
+
+    Hash hash;
+
+    for (; *aName != kNullChar; aName++)
+    {
+        hash.Update(static_cast<uint8_t>(ToLowercase(*aName)));
+    }
+
+    return hash.GetBucket(kNumNameIndexBuckets);
+}
+
+void Server::AddToNameIndex(Host &aHost)
+{
+    Host *&bucket = mHostNameBuckets[GetNameIndexBucket(aHost.GetFullName())];
+
+    OT_ASSERT(!aHost.mIsIndexed);
+
+    aHost.mNextInNameBucket = bucket;
+    bucket                  = &aHost;
+    aHost.mIsIndexed        = true;
+
+    for (Service &service : aHost.mServices)
+    {
+        AddToNameIndex(service);
+    }
+}
+
+void Server::RemoveFromNameIndex(Host &aHost)
+{
+    VerifyOrExit(aHost.mIsIndexed);
+
+    for (Service &service : aHost.mServices)
+    {
+        RemoveFromNameIndex(service);
+    }
+
+    for (Host **link = &mHostNameBuckets[GetNameIndexBucket(aHost.GetFullName())]; *link != nullptr;
+         link        = &(*link)->mNextInNameBucket)
+    {
+        if (*link == &aHost)
+        {
+            *link = aHost.mNextInNameBucket;
+            break;
+        }
+    }
+
+    aHost.mNextInNameBucket = nullptr;
+    aHost.mIsIndexed        = false;
+
+exit:
+    return;
+}
+
+void Server::AddToNameIndex(Service &aService)
+{
+    Service *&serviceNameBucket  = mServiceNameBuckets[GetNameIndexBucket(aService.GetServiceName())];
+    Service *&instanceNameBucket = mInstanceNameBuckets[GetNameIndexBucket(aService.GetInstanceName())];
+
+    aService.mNextInServiceNameBucket = serviceNameBucket;
+    serviceNameBucket                 = &aService;
+
+    aService.mNextInInstanceNameBucket = instanceNameBucket;
+    instanceNameBucket                 = &aService;
+}
+
+void Server::RemoveFromNameIndex(Service &aService)
+{
+    for (Service **link = &mServiceNameBuckets[GetNameIndexBucket(aService.GetServiceName())]; *link != nullptr;
+         link           = &(*link)->mNextInServiceNameBucket)
+    {
+        if (*link == &aService)
+        {
+            *link = aService.mNextInServiceNameBucket;
+            break;
+        }
+    }
+
+    for (Service **link = &mInstanceNameBuckets[GetNameIndexBucket(aService.GetInstanceName())]; *link != nullptr;
+         link           = &(*link)->mNextInInstanceNameBucket)
+    {
+        if (*link == &aService)
+        {
+            *link = aService.mNextInInstanceNameBucket;
+            break;
+        }
+    }
+
+    aService.mNextInServiceNameBucket  = nullptr;
+    aService.mNextInInstanceNameBucket = nullptr;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+
 void Server::HandleServiceUpdateResult(ServiceUpdateId aId, Error aError)
 {
     UpdateMetadata *update = mOutstandingUpdates.FindMatching(aId);
@@ -468,7 +688,7 @@ void Server::CommitSrpUpdate(Error                    aError,
         service.mDescription->mTtl      = grantedTtl;
     }
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
 
     if (aHost.GetLease() == 0)
     {
@@ -669,6 +889,21 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    // The verifications still in flight are reported later with IDs
+    // which no longer match any pending update.
+    while (!mPendingUpdates.IsEmpty())
+    {
+        PendingUpdate *update = mPendingUpdates.Pop();
+
+        update->mHost.Free();
+        update->Free();
+    }
+
+    mNumPendingUpdates = 0;
+    mSignatureVerifyRetryTimer.Stop();
+#endif
+
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -694,9 +929,9 @@ void Server::HandleNetDataPublisherEvent(NetworkData::Publisher::Event aEvent)
     }
 }
 
-const Server::UpdateMetadata *Server::FindOutstandingUpdate(const MessageMetadata &aMessageMetadata) const
+bool Server::HasOutstandingUpdate(const MessageMetadata &aMessageMetadata) const
 {
-    const UpdateMetadata *ret = nullptr;
+    bool ret = false;
 
     VerifyOrExit(aMessageMetadata.IsDirectRxFromClient());
 
@@ -706,10 +941,14 @@ const Server::UpdateMetadata *Server::FindOutstandingUpdate(const MessageMetadat
             aMessageMetadata.mMessageInfo->GetPeerAddr() == update.GetMessageInfo().GetPeerAddr() &&
             aMessageMetadata.mMessageInfo->GetPeerPort() == update.GetMessageInfo().GetPeerPort())
         {
-            ExitNow(ret = &update);
+            ExitNow(ret = true);
         }
     }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    ret = mPendingUpdates.ContainsMatching(aMessageMetadata);
+#endif
+
 exit:
     return ret;
 }
@@ -725,7 +964,7 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
 
     SuccessOrExit(error = ProcessZoneSection(aMessage, aMetadata));
 
-    if (FindOutstandingUpdate(aMetadata) != nullptr)
+    if (HasOutstandingUpdate(aMetadata))
     {
         LogInfo("Drop duplicated SRP update request: MessageId=%u", aMetadata.mDnsHeader.GetMessageId());
 
@@ -742,12 +981,18 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
     VerifyOrExit(host != nullptr, error = kErrorNoBufs);
     SuccessOrExit(error = ProcessUpdateSection(*host, aMessage, aMetadata));
 
-    // Parse lease time and validate signature.
+    // Parse lease time and read signature.
     SuccessOrExit(error = ProcessAdditionalSection(host, aMessage, aMetadata));
 
-    SuccessOrExit(error = ValidateServiceSubTypes(*host, aMetadata));
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    // The update is completed from `HandlePendingUpdatesTasklet()`
+    // once its signature is verified.
+    SuccessOrExit(error = AddPendingUpdate(*host, aMetadata));
+#else
+    CompleteDnsUpdate(VerifySignature(*host, aMetadata), *host, aMetadata);
+#endif
 
-    HandleUpdate(*host, aMetadata);
+    host = nullptr;
 
 exit:
     if (error != kErrorNone)
@@ -764,6 +1009,156 @@ exit:
     }
 }
 
+void Server::CompleteDnsUpdate(Error aError, Host &aHost, const MessageMetadata &aMetadata)
+{
+    Error error = aError;
+
+    SuccessOrExit(error);
+    SuccessOrExit(error = ValidateServiceSubTypes(aHost, aMetadata));
+
+    HandleUpdate(aHost, aMetadata);
+
+exit:
+    if (error != kErrorNone)
+    {
+        aHost.Free();
+
+        if (aMetadata.IsDirectRxFromClient())
+        {
+            SendResponse(aMetadata.mDnsHeader, ErrorToDnsResponseCode(error), *aMetadata.mMessageInfo);
+        }
+    }
+}
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+Error Server::AddPendingUpdate(Host &aHost, const MessageMetadata &aMetadata)
+{
+    Error          error = kErrorNone;
+    PendingUpdate *update;
+
+    VerifyOrExit(mNumPendingUpdates < kMaxPendingUpdates, error = kErrorNoBufs);
+
+    update = PendingUpdate::Allocate(aHost, aMetadata, AllocateId());
+    VerifyOrExit(update != nullptr, error = kErrorNoBufs);
+
+    // Pending updates are completed in the order they are received,
+    // so the new one is appended to the tail.
+    if (mPendingUpdates.IsEmpty())
+    {
+        mPendingUpdates.Push(*update);
+    }
+    else
+    {
+        mPendingUpdates.PushAfter(*update, *mPendingUpdates.GetTail());
+    }
+
+    mNumPendingUpdates++;
+
+    StartSignatureVerifications();
+
+exit:
+    return error;
+}
+
+void Server::StartSignatureVerifications(void)
+{
+    for (PendingUpdate &update : mPendingUpdates)
+    {
+        Error error;
+
+        if (mNumSignatureVerifyInFlight >= kMaxSignatureVerifyInFlight)
+        {
+            break;
+        }
+
+        if (update.mState != PendingUpdate::kStateWaiting)
+        {
+            continue;
+        }
+
+        error = otPlatCryptoEcdsaVerifyAsync(&GetInstance(), update.mId, &update.mHost.GetKeyRecord()->GetKey(),
+                                             &update.mMessageMetadata.mSignedHash,
+                                             &update.mMessageMetadata.mSignature);
+
+        switch (error)
+        {
+        case kErrorNone:
+            update.mState = PendingUpdate::kStateVerifying;
+            mNumSignatureVerifyInFlight++;
+            break;
+
+        case kErrorNoBufs:
+            // The platform cannot take more requests for now. The
+            // update keeps waiting and is submitted again when an
+            // in-flight verification is done, or after a short delay
+            // if there is none.
+            if (mNumSignatureVerifyInFlight == 0)
+            {
+                mSignatureVerifyRetryTimer.Start(kSignatureVerifyRetryInterval);
+            }
+
+            ExitNow();
+
+        case kErrorNotImplemented:
+            // The platform cannot verify the signature asynchronously,
+            // verify it here and complete the update from the tasklet.
+            update.mError = VerifySignature(update.mHost, update.mMessageMetadata);
+            update.mState = PendingUpdate::kStateDone;
+            mPendingUpdatesTasklet.Post();
+            break;
+
+        default:
+            LogWarn("Failed to start signature verification: %s", ErrorToString(error));
+            update.mError = error;
+            update.mState = PendingUpdate::kStateDone;
+            mPendingUpdatesTasklet.Post();
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+void Server::HandleSignatureVerifyDone(ServiceUpdateId aId, Error aError)
+{
+    PendingUpdate *update = mPendingUpdates.FindMatching(aId);
+
+    if (mNumSignatureVerifyInFlight > 0)
+    {
+        mNumSignatureVerifyInFlight--;
+    }
+
+    if ((update != nullptr) && (update->mState == PendingUpdate::kStateVerifying))
+    {
+        if (aError != kErrorNone)
+        {
+            LogWarn("Failed to verify message signature: %s", ErrorToString(aError));
+        }
+
+        update->mError = aError;
+        update->mState = PendingUpdate::kStateDone;
+        mPendingUpdatesTasklet.Post();
+    }
+
+    StartSignatureVerifications();
+}
+
+void Server::HandlePendingUpdatesTasklet(void)
+{
+    while (!mPendingUpdates.IsEmpty() && (mPendingUpdates.GetHead()->mState == PendingUpdate::kStateDone))
+    {
+        PendingUpdate *update = mPendingUpdates.Pop();
+
+        mNumPendingUpdates--;
+        CompleteDnsUpdate(update->mError, update->mHost, update->mMessageMetadata);
+        update->Free();
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 Error Server::ProcessZoneSection(const Message &aMessage, MessageMetadata &aMetadata) const
 {
     Error    error = kErrorNone;
@@ -1160,8 +1555,9 @@ Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, Mes
     VerifyOrExit(sigRecord.GetTypeCovered() == 0, error = kErrorFailed);
     VerifyOrExit(signatureLength == Crypto::Ecdsa::P256::Signature::kSize, error = kErrorParse);
 
-    SuccessOrExit(error = VerifySignature(*aHost->GetKeyRecord(), aMessage, aMetadata.mDnsHeader, sigOffset,
-                                          sigRdataOffset, sigRecord.GetLength(), signerName));
+    SuccessOrExit(error = aMessage.Read(offset - signatureLength, aMetadata.mSignature));
+    SuccessOrExit(error = ComputeSignedHash(aMessage, aMetadata.mDnsHeader, sigOffset, sigRdataOffset, signerName,
+                                            aMetadata.mSignedHash));
 
     aMetadata.mOffset = offset;
 
@@ -1174,23 +1570,17 @@ exit:
     return error;
 }
 
-Error Server::VerifySignature(const Dns::Ecdsa256KeyRecord &aKeyRecord,
-                              const Message                &aMessage,
-                              Dns::UpdateHeader             aDnsHeader,
-                              uint16_t                      aSigOffset,
-                              uint16_t                      aSigRdataOffset,
-                              uint16_t                      aSigRdataLength,
-                              const char                   *aSignerName) const
+Error Server::ComputeSignedHash(const Message        &aMessage,
+                                Dns::UpdateHeader     aDnsHeader,
+                                uint16_t              aSigOffset,
+                                uint16_t              aSigRdataOffset,
+                                const char           *aSignerName,
+                                Crypto::Sha256::Hash &aHash) const
 {
-    Error                          error;
-    uint16_t                       offset = aMessage.GetOffset();
-    uint16_t                       signatureOffset;
-    Crypto::Sha256                 sha256;
-    Crypto::Sha256::Hash           hash;
-    Crypto::Ecdsa::P256::Signature signature;
-    Message                       *signerNameMessage = nullptr;
-
-    VerifyOrExit(aSigRdataLength >= Crypto::Ecdsa::P256::Signature::kSize, error = kErrorInvalidArgs);
+    Error          error  = kErrorNone;
+    uint16_t       offset = aMessage.GetOffset();
+    Crypto::Sha256 sha256;
+    Message       *signerNameMessage = nullptr;
 
     sha256.Start();
 
@@ -1209,20 +1599,22 @@ Error Server::VerifySignature(const Dns::Ecdsa256KeyRecord &aKeyRecord,
     sha256.Update(aDnsHeader);
     sha256.Update(aMessage, offset + sizeof(aDnsHeader), aSigOffset - offset - sizeof(aDnsHeader));
 
-    sha256.Finish(hash);
+    sha256.Finish(aHash);
 
-    signatureOffset = aSigRdataOffset + aSigRdataLength - Crypto::Ecdsa::P256::Signature::kSize;
-    SuccessOrExit(error = aMessage.Read(signatureOffset, signature));
+exit:
+    FreeMessage(signerNameMessage);
+    return error;
+}
 
-    error = aKeyRecord.GetKey().Verify(hash, signature);
+Error Server::VerifySignature(const Host &aHost, const MessageMetadata &aMetadata) const
+{
+    Error error = aHost.GetKeyRecord()->GetKey().Verify(aMetadata.mSignedHash, aMetadata.mSignature);
 
-exit:
     if (error != kErrorNone)
     {
         LogWarn("Failed to verify message signature: %s", ErrorToString(error));
     }
 
-    FreeMessage(signerNameMessage);
     return error;
 }
 
@@ -1263,7 +1655,7 @@ Error Server::ValidateServiceSubTypes(Host &aHost, const MessageMetadata &aMetad
     // message, we add any previously registered service sub-type that
     // does not appear in new Update message as "deleted".
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     for (const Service &baseService : existingHost->GetServices())
@@ -1299,7 +1691,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1522,6 +1914,118 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+
+TimeMilli Server::GetNextLeaseEventTime(const Host &aHost)
+{
+    return aHost.IsDeleted() ? aHost.GetKeyExpireTime() : Min(aHost.GetExpireTime(), aHost.GetKeyExpireTime());
+}
+
+TimeMilli Server::GetNextLeaseEventTime(const Service &aService)
+{
+    return (aService.mIsDeleted || aService.GetHost().IsDeleted())
+               ? aService.GetKeyExpireTime()
+               : Min(aService.GetExpireTime(), aService.GetKeyExpireTime());
+}
+
+void Server::UpdateLeaseQueue(Host &aHost) { mHostLeaseQueue.Add(aHost, GetNextLeaseEventTime(aHost)); }
+
+void Server::UpdateLeaseQueue(Service &aService)
+{
+    mServiceLeaseQueue.Add(aService, GetNextLeaseEventTime(aService));
+}
+
+void Server::HandleLeaseTimer(void)
+{
+    TimeMilli          now                = TimerMilli::GetNow();
+    TimeMilli          earliestExpireTime = now.GetDistantFuture();
+    LeaseQueue::Entry *entry;
+
+    // Only the hosts and services at the head of the lease queues,
+    // whose next lease event is due, are processed. Each one is
+    // either removed from its queue or re-queued with a later time.
+    // Hosts are processed first, so that an expired host removes its
+    // services (notifying the service handler once for the host)
+    // before the lease events of the services themselves are checked.
+
+    while (((entry = mHostLeaseQueue.GetHead()) != nullptr) && (entry->GetLeaseQueueTime() <= now))
+    {
+        Host *host = ToHost(entry);
+
+        if (host->GetKeyExpireTime() <= now)
+        {
+            LogInfo("KEY LEASE of host %s expired", host->GetFullName());
+
+            // Removes the whole host and all services if the KEY RR expired.
+            RemoveHost(host, kDeleteName, kNotifyServiceHandler);
+        }
+        else if (!host->IsDeleted() && (host->GetExpireTime() <= now))
+        {
+            LogInfo("LEASE of host %s expired", host->GetFullName());
+
+            // If the host expired, delete all resources of this host and its services.
+            for (Service &service : host->mServices)
+            {
+                // Don't need to notify the service handler as `RemoveHost` at below will do.
+                host->RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
+            }
+
+            RemoveHost(host, kRetainName, kNotifyServiceHandler);
+        }
+        else
+        {
+            UpdateLeaseQueue(*host);
+        }
+    }
+
+    while (((entry = mServiceLeaseQueue.GetHead()) != nullptr) && (entry->GetLeaseQueueTime() <= now))
+    {
+        Service *service = ToService(entry);
+        Host    *host    = service->mDescription->mHost;
+
+        if (service->GetKeyExpireTime() <= now)
+        {
+            service->Log(Service::kKeyLeaseExpired);
+            host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
+        }
+        else if (!service->mIsDeleted && !host->IsDeleted() && (service->GetExpireTime() <= now))
+        {
+            service->Log(Service::kLeaseExpired);
+
+            // The service is expired, delete it.
+            host->RemoveService(service, kRetainName, kNotifyServiceHandler);
+        }
+        else
+        {
+            UpdateLeaseQueue(*service);
+        }
+    }
+
+    if (!mHostLeaseQueue.IsEmpty())
+    {
+        earliestExpireTime = Min(earliestExpireTime, mHostLeaseQueue.GetHead()->GetLeaseQueueTime());
+    }
+
+    if (!mServiceLeaseQueue.IsEmpty())
+    {
+        earliestExpireTime = Min(earliestExpireTime, mServiceLeaseQueue.GetHead()->GetLeaseQueueTime());
+    }
+
+    if (earliestExpireTime != now.GetDistantFuture())
+    {
+        OT_ASSERT(earliestExpireTime > now);
+        LogInfo("Lease timer is scheduled for %lu seconds", ToUlong(Time::MsecToSec(earliestExpireTime - now)));
+        mLeaseTimer.FireAt(earliestExpireTime);
+    }
+    else
+    {
+        LogInfo("Lease timer is stopped");
+        mLeaseTimer.Stop();
+    }
+}
+
+#else // OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+
 void Server::HandleLeaseTimer(void)
 {
     TimeMilli now                = TimerMilli::GetNow();
@@ -1636,6 +2140,8 @@ void Server::HandleLeaseTimer(void)
     }
 }
 
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+
 void Server::HandleOutstandingUpdatesTimer(void)
 {
     while (!mOutstandingUpdates.IsEmpty() && mOutstandingUpdates.GetTail()->GetExpireTime() <= TimerMilli::GetNow())
@@ -1694,6 +2200,10 @@ Error Server::Service::Init(const char *aServiceName, Description &aDescription,
     mIsDeleted   = false;
     mIsSubType   = aIsSubType;
     mIsCommitted = false;
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    mNextInServiceNameBucket  = nullptr;
+    mNextInInstanceNameBucket = nullptr;
+#endif
 
     return mServiceName.Set(aServiceName);
 }
@@ -1905,6 +2415,10 @@ exit:
 Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     : InstanceLocator(aInstance)
     , mNext(nullptr)
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    , mNextInNameBucket(nullptr)
+    , mIsIndexed(false)
+#endif
     , mTtl(0)
     , mLease(0)
     , mKeyLease(0)
@@ -2046,6 +2560,13 @@ Server::Service *Server::Host::AddNewService(const char *aServiceName,
 
     mServices.Push(*service);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    if (mIsIndexed)
+    {
+        Get<Server>().AddToNameIndex(*service);
+    }
+#endif
+
 exit:
     return service;
 }
@@ -2075,9 +2596,25 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
 
     if (!aRetainName)
     {
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        if (mIsIndexed)
+        {
+            server.RemoveFromNameIndex(*aService);
+        }
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+        server.RemoveFromLeaseQueue(*aService);
+#endif
         IgnoreError(mServices.Remove(*aService));
         aService->Free();
     }
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+    else if (this->IsInLeaseQueue())
+    {
+        // Check the host: services are only queued once their host is registered.
+        server.UpdateLeaseQueue(*aService);
+    }
+#endif
 
 exit:
     return;
@@ -2165,6 +2702,18 @@ Error Server::Host::MergeServicesAndResourcesFrom(Host &aHost)
     }
 
 exit:
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+    // The leases of the host and its services may have changed (also
+    // when the merge failed part way), so they are all re-queued.
+
+    Get<Server>().UpdateLeaseQueue(*this);
+
+    for (Service &service : mServices)
+    {
+        Get<Server>().UpdateLeaseQueue(service);
+    }
+#endif
+
     return error;
 }
 
@@ -2260,7 +2809,48 @@ Server::UpdateMetadata::UpdateMetadata(Instance &aInstance, Host &aHost, const M
     }
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::PendingUpdate
+
+Server::PendingUpdate::PendingUpdate(Host &aHost, const MessageMetadata &aMessageMetadata, ServiceUpdateId aId)
+    : mNext(nullptr)
+    , mHost(aHost)
+    , mMessageMetadata(aMessageMetadata)
+    , mId(aId)
+    , mError(kErrorNone)
+    , mState(kStateWaiting)
+{
+    if (aMessageMetadata.IsDirectRxFromClient())
+    {
+        mMessageInfo                  = *aMessageMetadata.mMessageInfo;
+        mMessageMetadata.mMessageInfo = &mMessageInfo;
+    }
+}
+
+bool Server::PendingUpdate::Matches(const MessageMetadata &aMessageMetadata) const
+{
+    return mMessageMetadata.IsDirectRxFromClient() && aMessageMetadata.IsDirectRxFromClient() &&
+           (aMessageMetadata.mDnsHeader.GetMessageId() == mMessageMetadata.mDnsHeader.GetMessageId()) &&
+           (aMessageMetadata.mMessageInfo->GetPeerAddr() == mMessageInfo.GetPeerAddr()) &&
+           (aMessageMetadata.mMessageInfo->GetPeerPort() == mMessageInfo.GetPeerPort());
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 } // namespace Srp
 } // namespace ot
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+using namespace ot;
+
+extern "C" void otPlatCryptoEcdsaVerifyAsyncDone(otInstance *aInstance, uint32_t aRequestId, otError aError)
+{
+    AsCoreType(aInstance).Get<Srp::Server>().HandleSignatureVerifyDone(aRequestId, aError);
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
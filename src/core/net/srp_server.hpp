@@ -68,9 +68,12 @@
 #include "common/notifier.hpp"
 #include "common/num_utils.hpp"
 #include "common/numeric_limits.hpp"
+#include "common/pairing_heap.hpp"
 #include "common/retain_ptr.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/sha256.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
 #include "net/ip6_address.hpp"
@@ -87,6 +90,8 @@ struct otSrpServerService
 
 namespace ot {
 
+class UnitTester;
+
 namespace Dns {
 namespace ServiceDiscovery {
 class Server;
@@ -101,6 +106,121 @@ class RoutingManager;
 
 namespace Srp {
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+
+/**
+ * This class implements a queue of SRP server entries (hosts or services) ordered by the time of their next lease
+ * event.
+ *
+ * The entries are kept in a `PairingHeap`: O(1) insert and peek of the earliest entry, O(log n) amortized remove.
+ *
+ */
+class LeaseQueue : private NonCopyable
+{
+public:
+    /**
+     * This class represents an entry in a `LeaseQueue`.
+     *
+     */
+    class Entry
+    {
+        friend class LeaseQueue;
+        friend class PairingHeap<Entry>;
+
+    public:
+        /**
+         * This constructor initializes the entry as not being in any queue.
+         *
+         */
+        Entry(void)
+            : mNext(this)
+            , mChild(nullptr)
+            , mPrev(nullptr)
+        {
+        }
+
+        /**
+         * This method indicates whether the entry is in a queue.
+         *
+         * @retval TRUE   The entry is in a queue.
+         * @retval FALSE  The entry is not in a queue.
+         *
+         */
+        bool IsInLeaseQueue(void) const { return PairingHeap<Entry>::IsInHeap(*this); }
+
+        /**
+         * This method returns the time of the entry in its queue.
+         *
+         * @returns The time of the entry.
+         *
+         */
+        TimeMilli GetLeaseQueueTime(void) const { return mLeaseQueueTime; }
+
+    private:
+        TimeMilli mLeaseQueueTime;
+        Entry    *mNext;
+        Entry    *mChild;
+        Entry    *mPrev;
+    };
+
+    /**
+     * This method indicates whether the queue is empty.
+     *
+     * @retval TRUE   The queue is empty.
+     * @retval FALSE  The queue is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return mHeap.IsEmpty(); }
+
+    /**
+     * This method returns the entry with the earliest time.
+     *
+     * @returns A pointer to the entry with the earliest time, or `nullptr` if the queue is empty.
+     *
+     */
+    Entry *GetHead(void) { return mHeap.GetHead(); }
+
+    /**
+     * This method adds an entry to the queue with a given time.
+     *
+     * If the entry is already in the queue, it is first removed (i.e., its time is updated).
+     *
+     * @param[in] aEntry  The entry to add.
+     * @param[in] aTime   The time of the entry.
+     *
+     */
+    void Add(Entry &aEntry, TimeMilli aTime)
+    {
+        Remove(aEntry);
+        aEntry.mLeaseQueueTime = aTime;
+        mHeap.Add(aEntry, TimeOrder());
+    }
+
+    /**
+     * This method removes an entry from the queue.
+     *
+     * This method does nothing if the entry is not in the queue.
+     *
+     * @param[in] aEntry  The entry to remove.
+     *
+     */
+    void Remove(Entry &aEntry) { mHeap.Remove(aEntry, TimeOrder()); }
+
+private:
+    class TimeOrder
+    {
+    public:
+        bool IsBefore(const Entry &aFirstEntry, const Entry &aSecondEntry) const
+        {
+            return aFirstEntry.GetLeaseQueueTime() < aSecondEntry.GetLeaseQueueTime();
+        }
+    };
+
+    PairingHeap<Entry> mHeap;
+};
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+
 /**
  * This class implements the SRP server.
  *
@@ -115,6 +235,7 @@ class Server : public InstanceLocator, private NonCopyable
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     friend class BorderRouter::RoutingManager;
 #endif
+    friend class ot::UnitTester;
 
     enum RetainName : bool
     {
@@ -179,6 +300,9 @@ public:
     class Service : public otSrpServerService,
                     public LinkedListEntry<Service>,
                     private Heap::Allocatable<Service>,
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+                    private LeaseQueue::Entry,
+#endif
                     private NonCopyable
     {
         friend class Server;
@@ -437,6 +561,10 @@ public:
         Heap::String           mServiceName;
         RetainPtr<Description> mDescription;
         Service               *mNext;
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        Service *mNextInServiceNameBucket;  // Next service in the same bucket of the service name index.
+        Service *mNextInInstanceNameBucket; // Next service in the same bucket of the instance name index.
+#endif
         TimeMilli              mUpdateTime;
         bool                   mIsDeleted : 1;
         bool                   mIsSubType : 1;
@@ -451,6 +579,9 @@ public:
                  public InstanceLocator,
                  public LinkedListEntry<Host>,
                  private Heap::Allocatable<Host>,
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+                 private LeaseQueue::Entry,
+#endif
                  private NonCopyable
     {
         friend class Server;
@@ -615,6 +746,10 @@ public:
         const Service                        *FindBaseService(const char *aInstanceName) const;
 
         Host                     *mNext;
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        Host *mNextInNameBucket; // Next host in the same bucket of the host name index.
+        bool  mIsIndexed;        // Whether the host (and its services) are in the name indices.
+#endif
         Heap::String              mFullName;
         Heap::Array<Ip6::Address> mAddresses;
 
@@ -914,6 +1049,17 @@ public:
      */
     void HandleServiceUpdateResult(ServiceUpdateId aId, Error aError);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    /**
+     * This method receives the result of a signature verification started by `otPlatCryptoEcdsaVerifyAsync()`.
+     *
+     * @param[in]  aId     The ID of the verification request.
+     * @param[in]  aError  The signature verification result.
+     *
+     */
+    void HandleSignatureVerifyDone(ServiceUpdateId aId, Error aError);
+#endif
+
 private:
     static constexpr uint16_t kUdpPayloadSize = Ip6::kMaxDatagramLength - sizeof(Ip6::Udp::Header);
 
@@ -937,13 +1083,15 @@ private:
         // client or from an SRPL partner.
         bool IsDirectRxFromClient(void) const { return (mMessageInfo != nullptr); }
 
-        Dns::UpdateHeader       mDnsHeader;
-        Dns::Zone               mDnsZone;
-        uint16_t                mOffset;
-        TimeMilli               mRxTime;
-        TtlConfig               mTtlConfig;
-        LeaseConfig             mLeaseConfig;
-        const Ip6::MessageInfo *mMessageInfo; // Set to `nullptr` when from SRPL.
+        Dns::UpdateHeader              mDnsHeader;
+        Dns::Zone                      mDnsZone;
+        uint16_t                       mOffset;
+        TimeMilli                      mRxTime;
+        TtlConfig                      mTtlConfig;
+        LeaseConfig                    mLeaseConfig;
+        const Ip6::MessageInfo        *mMessageInfo; // Set to `nullptr` when from SRPL.
+        Crypto::Sha256::Hash           mSignedHash;  // The hash of the message covered by the SIG(0) signature.
+        Crypto::Ecdsa::P256::Signature mSignature;
     };
 
     // This class includes metadata for processing a SRP update (register, deregister)
@@ -980,6 +1128,49 @@ private:
         bool              mIsDirectRxFromClient;
     };
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    // A received SRP update waiting for the verification of its
+    // signature. The `PendingUpdate` owns the parsed `Host` until the
+    // update is completed.
+    class PendingUpdate : public LinkedListEntry<PendingUpdate>, public Heap::Allocatable<PendingUpdate>
+    {
+        friend class LinkedListEntry<PendingUpdate>;
+        friend class Heap::Allocatable<PendingUpdate>;
+
+    public:
+        enum State : uint8_t
+        {
+            kStateWaiting,   // Not yet submitted to the platform.
+            kStateVerifying, // Submitted to the platform.
+            kStateDone,      // Verified, `mError` gives the result.
+        };
+
+        bool Matches(ServiceUpdateId aId) const { return mId == aId; }
+        bool Matches(const MessageMetadata &aMessageMetadata) const;
+
+        PendingUpdate   *mNext;
+        Host            &mHost;
+        MessageMetadata  mMessageMetadata; // `mMessageInfo` points to `mMessageInfo` below, or is `nullptr`.
+        Ip6::MessageInfo mMessageInfo;
+        ServiceUpdateId  mId;
+        Error            mError;
+        State            mState;
+
+    private:
+        PendingUpdate(Host &aHost, const MessageMetadata &aMessageMetadata, ServiceUpdateId aId);
+    };
+
+    static constexpr uint16_t kMaxSignatureVerifyInFlight =
+        OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_IN_FLIGHT;
+    static constexpr uint16_t kMaxPendingUpdates = OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_PENDING;
+
+    static constexpr uint32_t kSignatureVerifyRetryInterval = 100; // in msec
+
+    Error AddPendingUpdate(Host &aHost, const MessageMetadata &aMetadata);
+    void  StartSignatureVerifications(void);
+    void  HandlePendingUpdatesTasklet(void);
+#endif
+
     void              Enable(void);
     void              Disable(void);
     void              Start(void);
@@ -1013,15 +1204,16 @@ private:
                          const LeaseConfig      &aLeaseConfig,
                          const Ip6::MessageInfo *aMessageInfo);
     void  ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata);
+    void  CompleteDnsUpdate(Error aError, Host &aHost, const MessageMetadata &aMetadata);
     Error ProcessUpdateSection(Host &aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
-    Error VerifySignature(const Dns::Ecdsa256KeyRecord &aKeyRecord,
-                          const Message                &aMessage,
-                          Dns::UpdateHeader             aDnsHeader,
-                          uint16_t                      aSigOffset,
-                          uint16_t                      aSigRdataOffset,
-                          uint16_t                      aSigRdataLength,
-                          const char                   *aSignerName) const;
+    Error ComputeSignedHash(const Message        &aMessage,
+                            Dns::UpdateHeader     aDnsHeader,
+                            uint16_t              aSigOffset,
+                            uint16_t              aSigRdataOffset,
+                            const char           *aSignerName,
+                            Crypto::Sha256::Hash &aHash) const;
+    Error VerifySignature(const Host &aHost, const MessageMetadata &aMetadata) const;
     Error ValidateServiceSubTypes(Host &aHost, const MessageMetadata &aMetadata);
     Error ProcessZoneSection(const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessHostDescriptionInstruction(Host                  &aHost,
@@ -1037,7 +1229,42 @@ private:
     void        HandleUpdate(Host &aHost, const MessageMetadata &aMetadata);
     void        AddHost(Host &aHost);
     void        RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyServiceHandler);
+    Host       *FindHost(const char *aFullName);
+    const Host *FindHost(const char *aFullName) const;
     bool        HasNameConflictsWith(Host &aHost) const;
+
+    // Finds the next service (across all hosts) matching `aFlags`, `aServiceName` and `aInstanceName`. At least one
+    // of the names must be given. The order of the returned services is unspecified.
+    const Service *FindNextService(const Service *aPrevService,
+                                   Service::Flags aFlags,
+                                   const char    *aServiceName,
+                                   const char    *aInstanceName) const;
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    static constexpr uint16_t kNumNameIndexBuckets = 64;
+
+    static uint16_t GetNameIndexBucket(const char *aName);
+    void            AddToNameIndex(Host &aHost);
+    void            RemoveFromNameIndex(Host &aHost);
+    void            AddToNameIndex(Service &aService);
+    void            RemoveFromNameIndex(Service &aService);
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+    // Hosts and services are kept in two lease queues by the time of
+    // their next lease event, which is the expiration of their KEY
+    // LEASE once they are deleted, otherwise the expiration of their
+    // LEASE.
+
+    static TimeMilli GetNextLeaseEventTime(const Host &aHost);
+    static TimeMilli GetNextLeaseEventTime(const Service &aService);
+    static Host     *ToHost(LeaseQueue::Entry *aEntry) { return static_cast<Host *>(aEntry); }
+    static Service  *ToService(LeaseQueue::Entry *aEntry) { return static_cast<Service *>(aEntry); }
+    void             UpdateLeaseQueue(Host &aHost);
+    void             UpdateLeaseQueue(Service &aService);
+    void             RemoveFromLeaseQueue(Host &aHost) { mHostLeaseQueue.Remove(aHost); }
+    void             RemoveFromLeaseQueue(Service &aService) { mServiceLeaseQueue.Remove(aService); }
+#endif
     void        SendResponse(const Dns::UpdateHeader    &aHeader,
                              Dns::UpdateHeader::Response aResponseCode,
                              const Ip6::MessageInfo     &aMessageInfo);
@@ -1051,14 +1278,18 @@ private:
     static void HandleOutstandingUpdatesTimer(Timer &aTimer);
     void        HandleOutstandingUpdatesTimer(void);
 
-    void                  HandleServiceUpdateResult(UpdateMetadata *aUpdate, Error aError);
-    const UpdateMetadata *FindOutstandingUpdate(const MessageMetadata &aMessageMetadata) const;
-    static const char    *AddressModeToString(AddressMode aMode);
+    void               HandleServiceUpdateResult(UpdateMetadata *aUpdate, Error aError);
+    bool               HasOutstandingUpdate(const MessageMetadata &aMessageMetadata) const;
+    static const char *AddressModeToString(AddressMode aMode);
 
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
 
     using LeaseTimer  = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    using PendingUpdatesTasklet     = TaskletIn<Server, &Server::HandlePendingUpdatesTasklet>;
+    using SignatureVerifyRetryTimer = TimerMilliIn<Server, &Server::StartSignatureVerifications>;
+#endif
 
     Ip6::Udp::Socket mSocket;
 
@@ -1072,9 +1303,28 @@ private:
     LinkedList<Host> mHosts;
     LeaseTimer       mLeaseTimer;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    Host    *mHostNameBuckets[kNumNameIndexBuckets];
+    Service *mServiceNameBuckets[kNumNameIndexBuckets];
+    Service *mInstanceNameBuckets[kNumNameIndexBuckets];
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+    LeaseQueue mHostLeaseQueue;
+    LeaseQueue mServiceLeaseQueue;
+#endif
+
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    PendingUpdatesTasklet     mPendingUpdatesTasklet;
+    SignatureVerifyRetryTimer mSignatureVerifyRetryTimer;
+    LinkedList<PendingUpdate> mPendingUpdates;
+    uint16_t                  mNumPendingUpdates;
+    uint16_t                  mNumSignatureVerifyInFlight;
+#endif
+
     ServiceUpdateId mServiceUpdateId;
     uint16_t        mPort;
     State           mState;
@@ -85,6 +85,7 @@
 #include "config/misc.h"
 #include "config/mle.h"
 #include "config/mqttsn.h"
+#include "config/nat64.h"
 #include "config/netdata_publisher.h"
 #include "config/parent_search.h"
 #include "config/ping_sender.h"
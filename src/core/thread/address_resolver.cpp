@@ -38,6 +38,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
@@ -60,6 +61,8 @@ AddressResolver::AddressResolver(Instance &aInstance)
 #endif
 {
 #if OPENTHREAD_FTD
+    memset(&mCacheCounters, 0, sizeof(mCacheCounters));
+    ClearCacheIndex();
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -84,6 +87,8 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    ClearCacheIndex();
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -203,11 +208,120 @@ void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
     }
 }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
+void AddressResolver::ClearCacheIndex(void)
+{
+    for (uint16_t &slot : mCacheIndex)
+    {
+        slot = kCacheIndexEmptySlot;
+    }
+}
+
+uint16_t AddressResolver::GetCacheIndexSlot(const Ip6::Address &aEid)
+{
+    // Mixes all the 32-bit words of the address (EIDs often share
+    // the same prefix and differ only in their IID).
+
+    Hash hash;
+
+    for (uint32_t word : aEid.mFields.m32)
+    {
+        hash.Update(word);
+    }
+
+    return hash.GetBucket(kCacheIndexSize);
+}
+
+void AddressResolver::AddToCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t slot = GetCacheIndexSlot(aEntry.GetTarget());
+
+    while (mCacheIndex[slot] != kCacheIndexEmptySlot)
+    {
+        slot = GetNextCacheIndexSlot(slot);
+    }
+
+    mCacheIndex[slot] = mCacheEntryPool.GetIndexOf(aEntry);
+}
+
+void AddressResolver::RemoveFromCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t entryIndex = mCacheEntryPool.GetIndexOf(aEntry);
+    uint16_t slot       = GetCacheIndexSlot(aEntry.GetTarget());
+    uint16_t next;
+
+    while (mCacheIndex[slot] != entryIndex)
+    {
+        VerifyOrExit(mCacheIndex[slot] != kCacheIndexEmptySlot);
+        slot = GetNextCacheIndexSlot(slot);
+    }
+
+    // Emptying `slot` may break the probe sequence of the entries
+    // following it, so we shift back any such entry whose home slot
+    // is not cyclically within (`slot`, `next`].
+
+    next = GetNextCacheIndexSlot(slot);
+
+    while (mCacheIndex[next] != kCacheIndexEmptySlot)
+    {
+        uint16_t home = GetCacheIndexSlot(mCacheEntryPool.GetEntryAt(mCacheIndex[next]).GetTarget());
+        bool     stay = (slot < next) ? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next));
+
+        if (!stay)
+        {
+            mCacheIndex[slot] = mCacheIndex[next];
+            slot              = next;
+        }
+
+        next = GetNextCacheIndexSlot(next);
+    }
+
+    mCacheIndex[slot] = kCacheIndexEmptySlot;
+
+exit:
+    return;
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindInCacheIndex(const Ip6::Address &aEid)
+{
+    CacheEntry *entry = nullptr;
+    uint16_t    slot  = GetCacheIndexSlot(aEid);
+
+    while (mCacheIndex[slot] != kCacheIndexEmptySlot)
+    {
+        CacheEntry &candidate = mCacheEntryPool.GetEntryAt(mCacheIndex[slot]);
+
+        if (candidate.Matches(aEid))
+        {
+            ExitNow(entry = &candidate);
+        }
+
+        slot = GetNextCacheIndexSlot(slot);
+    }
+
+exit:
+    return entry;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
 AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid,
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
-    CacheEntry     *entry   = nullptr;
+    CacheEntry *entry = nullptr;
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // The index tells whether (and which) entry matches `aEid`. An
+    // entry in the index is always in one of the lists, and it
+    // tracks its list and its previous entry in that list.
+
+    entry = FindInCacheIndex(aEid);
+
+    aList      = (entry != nullptr) ? entry->GetList() : &mCachedList;
+    aPrevEntry = (entry != nullptr) ? entry->GetPrev() : nullptr;
+#else
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
     for (CacheEntryList *list : lists)
@@ -218,6 +332,7 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
     }
 
 exit:
+#endif
     return entry;
 }
 
@@ -280,6 +395,7 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
         if (newEntry != nullptr)
         {
             RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            mCacheCounters.mEvictions++;
             ExitNow();
         }
 
@@ -311,6 +427,7 @@ void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
                                        Reason          aReason)
 {
     aList.PopAfter(aPrevEntry);
+    RemoveFromCacheIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -415,6 +532,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
     }
 
     mSnoopedList.Push(*entry);
+    AddToCacheIndex(*entry);
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -425,31 +543,35 @@ exit:
 void AddressResolver::RestartAddressQueries(void)
 {
     CacheEntry *tail;
+    CacheEntry *entry;
 
     // We move all entries from `mQueryRetryList` at the tail of
-    // `mQueryList` and then (re)send Address Query for all entries in
-    // the updated `mQueryList`.
+    // `mQueryList` (keeping their order) and then (re)send Address
+    // Query for all entries in the updated `mQueryList`.
 
     tail = mQueryList.GetTail();
 
-    if (tail == nullptr)
-    {
-        mQueryList.SetHead(mQueryRetryList.GetHead());
-    }
-    else
+    while ((entry = mQueryRetryList.Pop()) != nullptr)
     {
-        tail->SetNext(mQueryRetryList.GetHead());
-    }
+        if (tail == nullptr)
+        {
+            mQueryList.Push(*entry);
+        }
+        else
+        {
+            mQueryList.PushAfter(*entry, *tail);
+        }
 
-    mQueryRetryList.Clear();
+        tail = entry;
+    }
 
-    for (CacheEntry &entry : mQueryList)
+    for (CacheEntry &queryEntry : mQueryList)
     {
-        IgnoreError(SendAddressQuery(entry.GetTarget()));
+        IgnoreError(SendAddressQuery(queryEntry.GetTarget()));
 
-        entry.SetTimeout(kAddressQueryTimeout);
-        entry.SetRetryDelay(kAddressQueryInitialRetryDelay);
-        entry.SetCanEvict(false);
+        queryEntry.SetTimeout(kAddressQueryTimeout);
+        queryEntry.SetRetryDelay(kAddressQueryInitialRetryDelay);
+        queryEntry.SetCanEvict(false);
     }
 }
 
@@ -481,6 +603,8 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         // allow first-time address query entries to be evicted till
         // timeout.
 
+        mCacheCounters.mMisses++;
+
         VerifyOrExit(aAllowAddressQuery, error = kErrorNotFound);
 
         entry = NewCacheEntry(/* aSnoopedEntry */ false);
@@ -507,6 +631,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 
         mCachedList.Push(*entry);
         aRloc16 = entry->GetRloc16();
+        mCacheCounters.mHits++;
         ExitNow();
     }
 
@@ -536,10 +661,19 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+
+    if (error != kErrorNone)
+    {
+        // A newly allocated `entry` (`list` is `nullptr`) is not yet
+        // in the index, in which case this is a no-op.
+        RemoveFromCacheIndex(*entry);
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
+        AddToCacheIndex(*entry);
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
     }
 
@@ -1076,6 +1210,10 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
     mNextIndex = kNoNextIndex;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    mPrevIndex = kNoNextIndex;
+    mList      = nullptr;
+#endif
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1097,6 +1235,74 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return (mPrevIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
+void AddressResolver::CacheEntry::SetPrev(CacheEntry *aEntry)
+{
+    VerifyOrExit(aEntry != nullptr, mPrevIndex = kNoNextIndex);
+    mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryList
+
+void AddressResolver::CacheEntryList::Push(CacheEntry &aEntry)
+{
+    CacheEntry *next = GetHead();
+
+    LinkedList<CacheEntry>::Push(aEntry);
+    aEntry.SetPrev(nullptr);
+    aEntry.SetList(this);
+
+    if (next != nullptr)
+    {
+        next->SetPrev(&aEntry);
+    }
+}
+
+void AddressResolver::CacheEntryList::PushAfter(CacheEntry &aEntry, CacheEntry &aPrevEntry)
+{
+    CacheEntry *next = aPrevEntry.GetNext();
+
+    LinkedList<CacheEntry>::PushAfter(aEntry, aPrevEntry);
+    aEntry.SetPrev(&aPrevEntry);
+    aEntry.SetList(this);
+
+    if (next != nullptr)
+    {
+        next->SetPrev(&aEntry);
+    }
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntryList::PopAfter(CacheEntry *aPrevEntry)
+{
+    CacheEntry *entry = LinkedList<CacheEntry>::PopAfter(aPrevEntry);
+
+    VerifyOrExit(entry != nullptr);
+
+    // The popped entry keeps its next pointer.
+
+    if (entry->GetNext() != nullptr)
+    {
+        entry->GetNext()->SetPrev(aPrevEntry);
+    }
+
+    entry->SetList(nullptr);
+
+exit:
+    return entry;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -51,6 +51,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 /**
  * @addtogroup core-arp
  *
@@ -68,6 +70,7 @@ class AddressResolver : public InstanceLocator, private NonCopyable
 {
     friend class TimeTicker;
     friend class Tmf::Agent;
+    friend class ot::UnitTester;
 
     class CacheEntry;
     class CacheEntryList;
@@ -133,6 +136,26 @@ public:
      */
     Error GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const;
 
+    /**
+     * This type represents the EID-to-RLOC cache counters.
+     *
+     */
+    typedef otAddressCacheCounters CacheCounters;
+
+    /**
+     * This method gets the EID-to-RLOC cache counters.
+     *
+     * @returns The EID-to-RLOC cache counters.
+     *
+     */
+    const CacheCounters &GetCacheCounters(void) const { return mCacheCounters; }
+
+    /**
+     * This method resets the EID-to-RLOC cache counters.
+     *
+     */
+    void ResetCacheCounters(void) { memset(&mCacheCounters, 0, sizeof(mCacheCounters)); }
+
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -251,6 +274,14 @@ private:
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        CacheEntry *GetPrev(void);
+        void        SetPrev(CacheEntry *aEntry);
+
+        CacheEntryList *GetList(void) const { return mList; }
+        void            SetList(CacheEntryList *aList) { mList = aList; }
+#endif
+
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
 
@@ -285,6 +316,10 @@ private:
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        uint16_t        mPrevIndex; // Uses `kNoNextIndex` when at head of list.
+        CacheEntryList *mList;      // The list containing the entry, `nullptr` if none.
+#endif
 
         union
         {
@@ -306,8 +341,32 @@ private:
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // The cache index is an open-addressing (linear probing) hash
+    // table mapping an EID to the index of its entry in the
+    // `mCacheEntryPool`. It has twice as many slots as there are
+    // entries so that a probe sequence always ends on an empty slot.
+
+    static constexpr uint16_t kCacheIndexSize      = 2 * kCacheEntries;
+    static constexpr uint16_t kCacheIndexEmptySlot = 0xffff;
+
+    static_assert(kCacheIndexSize < kCacheIndexEmptySlot, "OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES is too large");
+#endif
+
     class CacheEntryList : public LinkedList<CacheEntry>
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        // With the cache index, every entry also tracks its previous
+        // entry and its list, so that an entry found through the index
+        // can be unlinked without walking the list. The methods below
+        // hide the `LinkedList` ones to keep this information updated.
+
+    public:
+        void        Push(CacheEntry &aEntry);
+        void        PushAfter(CacheEntry &aEntry, CacheEntry &aPrevEntry);
+        CacheEntry *Pop(void) { return PopAfter(nullptr); }
+        CacheEntry *PopAfter(CacheEntry *aPrevEntry);
+#endif
     };
 
     enum EntryChange : uint8_t
@@ -339,6 +398,20 @@ private:
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
     Error       SendAddressQuery(const Ip6::Address &aEid);
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    void        ClearCacheIndex(void);
+    void        AddToCacheIndex(const CacheEntry &aEntry);
+    void        RemoveFromCacheIndex(const CacheEntry &aEntry);
+    CacheEntry *FindInCacheIndex(const Ip6::Address &aEid);
+
+    static uint16_t GetCacheIndexSlot(const Ip6::Address &aEid);
+    static uint16_t GetNextCacheIndexSlot(uint16_t aSlot) { return (aSlot + 1) % kCacheIndexSize; }
+#else
+    void ClearCacheIndex(void) {}
+    void AddToCacheIndex(const CacheEntry &) {}
+    void RemoveFromCacheIndex(const CacheEntry &) {}
+#endif
 #if OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
     Error ResolveUsingNetDataServices(const Ip6::Address &aEid, Mac::ShortAddress &aRloc16);
 #endif
@@ -373,7 +446,11 @@ private:
     CacheEntryList     mSnoopedList;
     CacheEntryList     mQueryList;
     CacheEntryList     mQueryRetryList;
+    CacheCounters      mCacheCounters;
     Ip6::Icmp::Handler mIcmpHandler;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    uint16_t mCacheIndex[kCacheIndexSize];
+#endif
 
 #endif // OPENTHREAD_FTD
 };
@@ -36,6 +36,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/code_utils.hpp"
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 
@@ -77,6 +78,10 @@ ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    ClearIndex();
+#endif
+
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
@@ -118,6 +123,13 @@ const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
     const Child *child = mChildren;
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (CanUseIndex(aMatcher))
+    {
+        ExitNow(child = FindIndexedChild(aMatcher));
+    }
+#endif
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->Matches(aMatcher))
@@ -319,18 +331,228 @@ bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) cons
     bool         hasChild = false;
     const Child *child    = &mChildren[0];
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // Mesh-local addresses are tracked by their IID in each child
+    // entry and are not part of the index.
+
+    if (!Get<Mle::MleRouter>().IsMeshLocalAddress(aIp6Address))
+    {
+        ExitNow(hasChild = HasIndexedSleepyChildWithAddress(aIp6Address));
+    }
+#endif
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->IsStateValidOrRestoring() && !child->IsRxOnWhenIdle() && child->HasIp6Address(aIp6Address))
         {
-            hasChild = true;
-            break;
+            ExitNow(hasChild = true);
+        }
+    }
+
+exit:
+    return hasChild;
+}
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+void ChildTable::ClearIndex(void)
+{
+    memset(mRloc16Buckets, 0xff, sizeof(mRloc16Buckets));
+    memset(mExtAddressBuckets, 0xff, sizeof(mExtAddressBuckets));
+    memset(mAddressBuckets, 0xff, sizeof(mAddressBuckets));
+}
+
+void ChildTable::AddToIndex(const Child &aChild)
+{
+    uint16_t childIndex = GetChildIndex(aChild);
+
+    VerifyOrExit(!aChild.IsStateInvalid());
+
+    AddToChain(mRloc16Buckets[GetRloc16Bucket(aChild.GetRloc16())], mNextByRloc16, childIndex);
+    AddToChain(mExtAddressBuckets[GetExtAddressBucket(aChild.GetExtAddress())], mNextByExtAddress, childIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::RemoveFromIndex(const Child &aChild)
+{
+    uint16_t childIndex = GetChildIndex(aChild);
+
+    VerifyOrExit(!aChild.IsStateInvalid());
+
+    RemoveFromChain(mRloc16Buckets[GetRloc16Bucket(aChild.GetRloc16())], mNextByRloc16, childIndex);
+    RemoveFromChain(mExtAddressBuckets[GetExtAddressBucket(aChild.GetExtAddress())], mNextByExtAddress, childIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::AddAddressToIndex(const Child &aChild, uint16_t aAddressIndex)
+{
+    uint16_t entry = GetChildIndex(aChild) * Child::kNumIp6Addresses + aAddressIndex;
+
+    AddToChain(mAddressBuckets[GetAddressBucket(aChild.mIp6Address[aAddressIndex])], mNextByAddress, entry);
+}
+
+void ChildTable::AddAddressesToIndex(const Child &aChild)
+{
+    for (uint16_t index = 0; index < Child::kNumIp6Addresses; index++)
+    {
+        VerifyOrExit(!aChild.mIp6Address[index].IsUnspecified());
+        AddAddressToIndex(aChild, index);
+    }
+
+exit:
+    return;
+}
+
+void ChildTable::RemoveAddressesFromIndex(const Child &aChild)
+{
+    uint16_t entry = GetChildIndex(aChild) * Child::kNumIp6Addresses;
+
+    for (const Ip6::Address &address : aChild.mIp6Address)
+    {
+        VerifyOrExit(!address.IsUnspecified());
+        RemoveFromChain(mAddressBuckets[GetAddressBucket(address)], mNextByAddress, entry);
+        entry++;
+    }
+
+exit:
+    return;
+}
+
+bool ChildTable::CanUseIndex(const Child::AddressMatcher &aMatcher) const
+{
+    // The index only contains children which are not in
+    // `kStateInvalid`. Filters which can match an invalid child, or
+    // a matcher without any address, need a scan of the table.
+
+    bool canUse = false;
+
+    switch (aMatcher.mStateFilter)
+    {
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        ExitNow();
+
+    default:
+        break;
+    }
+
+    canUse = (aMatcher.mShortAddress != Mac::kShortAddrInvalid) || (aMatcher.mExtAddress != nullptr);
+
+exit:
+    return canUse;
+}
+
+const Child *ChildTable::FindIndexedChild(const Child::AddressMatcher &aMatcher) const
+{
+    // The entries in a chain are in no particular order. The matching
+    // child with the lowest table index is returned, i.e., the same
+    // entry a scan of the table would find.
+
+    const Child    *child = nullptr;
+    const uint16_t *next;
+    uint16_t        entry;
+
+    if (aMatcher.mShortAddress != Mac::kShortAddrInvalid)
+    {
+        entry = mRloc16Buckets[GetRloc16Bucket(aMatcher.mShortAddress)];
+        next  = mNextByRloc16;
+    }
+    else
+    {
+        entry = mExtAddressBuckets[GetExtAddressBucket(*aMatcher.mExtAddress)];
+        next  = mNextByExtAddress;
+    }
+
+    for (; entry != kNoEntry; entry = next[entry])
+    {
+        const Child &candidate = mChildren[entry];
+
+        if ((entry < mMaxChildrenAllowed) && candidate.Matches(aMatcher) &&
+            ((child == nullptr) || (&candidate < child)))
+        {
+            child = &candidate;
+        }
+    }
+
+    return child;
+}
+
+bool ChildTable::HasIndexedSleepyChildWithAddress(const Ip6::Address &aIp6Address) const
+{
+    bool     hasChild = false;
+    uint16_t entry;
+
+    VerifyOrExit(!aIp6Address.IsUnspecified());
+
+    for (entry = mAddressBuckets[GetAddressBucket(aIp6Address)]; entry != kNoEntry; entry = mNextByAddress[entry])
+    {
+        uint16_t     childIndex = entry / Child::kNumIp6Addresses;
+        const Child &child      = mChildren[childIndex];
+
+        if ((childIndex < mMaxChildrenAllowed) && child.IsStateValidOrRestoring() && !child.IsRxOnWhenIdle() &&
+            (child.mIp6Address[entry % Child::kNumIp6Addresses] == aIp6Address))
+        {
+            ExitNow(hasChild = true);
         }
     }
 
+exit:
     return hasChild;
 }
 
+void ChildTable::AddToChain(uint16_t &aHead, uint16_t *aNext, uint16_t aEntry)
+{
+    aNext[aEntry] = aHead;
+    aHead         = aEntry;
+}
+
+void ChildTable::RemoveFromChain(uint16_t &aHead, uint16_t *aNext, uint16_t aEntry)
+{
+    uint16_t *link = &aHead;
+
+    while (*link != kNoEntry)
+    {
+        if (*link == aEntry)
+        {
+            *link = aNext[aEntry];
+            break;
+        }
+
+        link = &aNext[*link];
+    }
+}
+
+uint16_t ChildTable::GetExtAddressBucket(const Mac::ExtAddress &aExtAddress)
+{
+    Hash hash;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        hash.Update(byte);
+    }
+
+    return hash.GetBucket(kNumExtAddressBuckets);
+}
+
+uint16_t ChildTable::GetAddressBucket(const Ip6::Address &aAddress)
+{
+    Hash hash;
+
+    for (uint32_t word : aAddress.mFields.m32)
+    {
+        hash.Update(word);
+    }
+
+    return hash.GetBucket(kNumAddressBuckets);
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
@@ -53,6 +53,10 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    friend class Neighbor;
+    friend class Child;
+#endif
     class IteratorBuilder;
 
 public:
@@ -344,8 +348,48 @@ private:
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // The index maps the RLOC16 and extended address of every child
+    // not in `kStateInvalid`, and every registered (non-mesh-local)
+    // IPv6 address of all children, to the child entries. Each index
+    // is a hash table with chaining, where the chains are linked
+    // through `mNext*` arrays indexed by child table index (or by
+    // IPv6 address entry, i.e., child index and address slot). The
+    // RLOC16 index uses the Child ID as bucket index.
+
+    static constexpr uint16_t kNumRloc16Buckets     = Mle::kMaxChildId + 1;
+    static constexpr uint16_t kNumExtAddressBuckets = kMaxChildren;
+    static constexpr uint16_t kNumAddressBuckets    = kMaxChildren;
+    static constexpr uint16_t kNumAddressEntries    = kMaxChildren * Child::kNumIp6Addresses;
+    static constexpr uint16_t kNoEntry              = 0xffff;
+
+    void            ClearIndex(void);
+    void            AddToIndex(const Child &aChild);
+    void            RemoveFromIndex(const Child &aChild);
+    void            AddAddressToIndex(const Child &aChild, uint16_t aAddressIndex);
+    void            AddAddressesToIndex(const Child &aChild);
+    void            RemoveAddressesFromIndex(const Child &aChild);
+    bool            CanUseIndex(const Child::AddressMatcher &aMatcher) const;
+    const Child    *FindIndexedChild(const Child::AddressMatcher &aMatcher) const;
+    bool            HasIndexedSleepyChildWithAddress(const Ip6::Address &aIp6Address) const;
+    static void     AddToChain(uint16_t &aHead, uint16_t *aNext, uint16_t aEntry);
+    static void     RemoveFromChain(uint16_t &aHead, uint16_t *aNext, uint16_t aEntry);
+    static uint16_t GetRloc16Bucket(uint16_t aRloc16) { return Mle::ChildIdFromRloc16(aRloc16); }
+    static uint16_t GetExtAddressBucket(const Mac::ExtAddress &aExtAddress);
+    static uint16_t GetAddressBucket(const Ip6::Address &aAddress);
+#endif
+
     uint16_t mMaxChildrenAllowed;
     Child    mChildren[kMaxChildren];
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    uint16_t mRloc16Buckets[kNumRloc16Buckets];
+    uint16_t mExtAddressBuckets[kNumExtAddressBuckets];
+    uint16_t mAddressBuckets[kNumAddressBuckets];
+    uint16_t mNextByRloc16[kMaxChildren];
+    uint16_t mNextByExtAddress[kMaxChildren];
+    uint16_t mNextByAddress[kNumAddressEntries];
+#endif
 };
 
 } // namespace ot
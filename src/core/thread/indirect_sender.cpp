@@ -68,6 +68,9 @@ IndirectSender::IndirectSender(Instance &aInstance)
     , mCslTxScheduler(aInstance)
 #endif
 {
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    ClearAllChildQueues();
+#endif
 }
 
 void IndirectSender::Stop(void)
@@ -84,6 +87,9 @@ void IndirectSender::Stop(void)
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     mCslTxScheduler.Clear();
 #endif
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    ClearAllChildQueues();
+#endif
 
 exit:
     mEnabled = false;
@@ -99,6 +105,9 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
     VerifyOrExit(!aMessage.GetChildMask(childIndex));
 
     aMessage.SetChildMask(childIndex);
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    AddToChildQueue(aMessage, childIndex);
+#endif
     mSourceMatchController.IncrementMessageCount(aChild);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
@@ -126,6 +135,9 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
     VerifyOrExit(aMessage.GetChildMask(childIndex), error = kErrorNotFound);
 
     aMessage.ClearChildMask(childIndex);
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    RemoveFromChildQueue(aMessage, childIndex);
+#endif
     mSourceMatchController.DecrementMessageCount(aChild);
 
     RequestMessageUpdate(aChild);
@@ -136,15 +148,36 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
+    uint16_t childIndex;
+
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    if (!mChildQueues[childIndex].mOverflowed)
+    {
+        for (QueueEntry *entry = mChildQueues[childIndex].mHead; entry != nullptr; entry = entry->GetNext())
+        {
+            entry->mMessage->ClearChildMask(childIndex);
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*entry->mMessage);
+        }
+    }
+    else
+#endif
     {
-        message.ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        for (Message &message : Get<MeshForwarder>().mSendQueue)
+        {
+            message.ClearChildMask(childIndex);
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+        }
     }
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    ClearChildQueue(childIndex);
+#endif
+
     aChild.SetIndirectMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
 
@@ -181,15 +214,32 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-        for (Message &message : Get<MeshForwarder>().mSendQueue)
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+        if (!mChildQueues[childIndex].mOverflowed)
         {
-            if (message.GetChildMask(childIndex))
+            for (QueueEntry *entry = mChildQueues[childIndex].mHead; entry != nullptr; entry = entry->GetNext())
             {
-                message.ClearChildMask(childIndex);
-                message.SetDirectTransmission();
+                entry->mMessage->ClearChildMask(childIndex);
+                entry->mMessage->SetDirectTransmission();
+            }
+        }
+        else
+#endif
+        {
+            for (Message &message : Get<MeshForwarder>().mSendQueue)
+            {
+                if (message.GetChildMask(childIndex))
+                {
+                    message.ClearChildMask(childIndex);
+                    message.SetDirectTransmission();
+                }
             }
         }
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+        ClearChildQueue(childIndex);
+#endif
+
         aChild.SetIndirectMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
 
@@ -212,6 +262,22 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
     Message *msg        = nullptr;
     uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    if (!mChildQueues[childIndex].mOverflowed)
+    {
+        for (QueueEntry *entry = mChildQueues[childIndex].mHead; entry != nullptr; entry = entry->GetNext())
+        {
+            if (!aSupervisionTypeOnly || (entry->mMessage->GetType() == Message::kTypeSupervision))
+            {
+                msg = entry->mMessage;
+                break;
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     for (Message &message : Get<MeshForwarder>().mSendQueue)
     {
         if (message.GetChildMask(childIndex) &&
@@ -222,6 +288,16 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
         }
     }
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    if ((msg == nullptr) && !aSupervisionTypeOnly)
+    {
+        // The send queue has no more messages for the child, so
+        // its (empty) queue can be used again.
+        mChildQueues[childIndex].mOverflowed = false;
+    }
+
+exit:
+#endif
     return msg;
 }
 
@@ -535,6 +611,9 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         if (message->GetChildMask(childIndex))
         {
             message->ClearChildMask(childIndex);
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+            RemoveFromChildQueue(*message, childIndex);
+#endif
             mSourceMatchController.DecrementMessageCount(aChild);
         }
 
@@ -563,6 +642,139 @@ void IndirectSender::ClearMessagesForRemovedChildren(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+
+void IndirectSender::RemoveMessageFromChildQueues(Message &aMessage)
+{
+    for (uint16_t childIndex = 0; childIndex < GetArrayLength(mChildQueues); childIndex++)
+    {
+        if (aMessage.GetChildMask(childIndex))
+        {
+            aMessage.ClearChildMask(childIndex);
+            RemoveFromChildQueue(aMessage, childIndex);
+        }
+    }
+}
+
+void IndirectSender::AddToChildQueue(Message &aMessage, uint16_t aChildIndex)
+{
+    ChildQueue &queue = mChildQueues[aChildIndex];
+    QueueEntry *entry;
+    QueueEntry *prev;
+
+    VerifyOrExit(!queue.mOverflowed);
+
+    entry = mQueueEntryPool.Allocate();
+
+    if (entry == nullptr)
+    {
+        ClearChildQueue(aChildIndex);
+        queue.mOverflowed = true;
+        ExitNow();
+    }
+
+    entry->mMessage = &aMessage;
+
+    // Entries are kept in the same order as their messages in the
+    // send queue, i.e., higher priority first and FIFO within the
+    // same priority. A new message is normally appended at the tail.
+
+    prev = queue.mTail;
+
+    if ((prev != nullptr) && (prev->mMessage->GetPriority() < aMessage.GetPriority()))
+    {
+        QueueEntry *cur = queue.mHead;
+
+        prev = nullptr;
+
+        while (cur->mMessage->GetPriority() >= aMessage.GetPriority())
+        {
+            prev = cur;
+            cur  = cur->GetNext();
+        }
+    }
+
+    if (prev == nullptr)
+    {
+        entry->SetNext(queue.mHead);
+        queue.mHead = entry;
+    }
+    else
+    {
+        entry->SetNext(prev->GetNext());
+        prev->SetNext(entry);
+    }
+
+    if (entry->GetNext() == nullptr)
+    {
+        queue.mTail = entry;
+    }
+
+exit:
+    return;
+}
+
+void IndirectSender::RemoveFromChildQueue(const Message &aMessage, uint16_t aChildIndex)
+{
+    ChildQueue &queue = mChildQueues[aChildIndex];
+    QueueEntry *prev  = nullptr;
+    QueueEntry *entry;
+
+    VerifyOrExit(!queue.mOverflowed);
+
+    for (entry = queue.mHead; entry != nullptr; prev = entry, entry = entry->GetNext())
+    {
+        if (entry->mMessage == &aMessage)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(entry != nullptr);
+
+    if (prev == nullptr)
+    {
+        queue.mHead = entry->GetNext();
+    }
+    else
+    {
+        prev->SetNext(entry->GetNext());
+    }
+
+    if (queue.mTail == entry)
+    {
+        queue.mTail = prev;
+    }
+
+    mQueueEntryPool.Free(*entry);
+
+exit:
+    return;
+}
+
+void IndirectSender::ClearChildQueue(uint16_t aChildIndex)
+{
+    ChildQueue &queue = mChildQueues[aChildIndex];
+    QueueEntry *entry;
+
+    while ((entry = queue.mHead) != nullptr)
+    {
+        queue.mHead = entry->GetNext();
+        mQueueEntryPool.Free(*entry);
+    }
+
+    queue.mTail       = nullptr;
+    queue.mOverflowed = false;
+}
+
+void IndirectSender::ClearAllChildQueues(void)
+{
+    mQueueEntryPool.FreeAll();
+    memset(mChildQueues, 0, sizeof(mChildQueues));
+}
+
+#endif // OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // #if OPENTHREAD_FTD
@@ -41,6 +41,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "mac/data_poll_handler.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/csl_tx_scheduler.hpp"
@@ -60,6 +61,7 @@ namespace ot {
  */
 
 class Child;
+class UnitTester;
 
 /**
  * This class implements indirect transmission.
@@ -68,6 +70,7 @@ class Child;
 class IndirectSender : public InstanceLocator, public IndirectSenderBase, private NonCopyable
 {
     friend class Instance;
+    friend class ot::UnitTester;
     friend class DataPollHandler::Callbacks;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     friend class CslTxScheduler::Callbacks;
@@ -202,6 +205,19 @@ public:
      */
     void HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMode);
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    /**
+     * This method clears the child mask of a message and removes the message from the indirect queues of all children.
+     *
+     * This method MUST be used before freeing a message from the send queue which may still be queued for sleepy
+     * children, including children which are no longer valid.
+     *
+     * @param[in] aMessage  The message to remove.
+     *
+     */
+    void RemoveMessageFromChildQueues(Message &aMessage);
+#endif
+
 private:
     /**
      * Indicates whether to set/enable 15.4 ack request in the MAC header of a supervision message.
@@ -221,12 +237,53 @@ private:
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    // Each `QueueEntry` references a message in the send queue which
+    // is destined to a sleepy child. The entries of a child form a
+    // list (`ChildQueue`) in the same order as their messages in the
+    // send queue (i.e., by priority, then FIFO). Queues are tracked
+    // by child index (same as the message child mask) so they are
+    // not affected by a `Child` entry being cleared.
+    //
+    // When a `QueueEntry` cannot be allocated, the child queue is
+    // marked as overflowed and its entries are freed. Messages for
+    // the child are then found by searching the send queue until it
+    // has no more messages for the child.
+
+    static constexpr uint16_t kQueueEntries = OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENTRIES;
+
+    class QueueEntry : public LinkedListEntry<QueueEntry>
+    {
+        friend class LinkedListEntry<QueueEntry>;
+
+    public:
+        Message    *mMessage;
+        QueueEntry *mNext;
+    };
+
+    struct ChildQueue
+    {
+        QueueEntry *mHead;
+        QueueEntry *mTail;
+        bool        mOverflowed;
+    };
+
+    void AddToChildQueue(Message &aMessage, uint16_t aChildIndex);
+    void RemoveFromChildQueue(const Message &aMessage, uint16_t aChildIndex);
+    void ClearChildQueue(uint16_t aChildIndex);
+    void ClearAllChildQueues(void);
+#endif
+
     bool                  mEnabled;
     SourceMatchController mSourceMatchController;
     DataPollHandler       mDataPollHandler;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     CslTxScheduler mCslTxScheduler;
 #endif
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    Pool<QueueEntry, kQueueEntries> mQueueEntryPool;
+    ChildQueue                      mChildQueues[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+#endif
 };
 
 /**
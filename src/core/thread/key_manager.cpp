@@ -166,6 +166,7 @@ exit:
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+    , mTemporaryKeyCacheHits(0)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
     , mStoredMleFrameCounter(0)
@@ -328,11 +329,21 @@ void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey)
 
 void KeyManager::UpdateKeyMaterial(void)
 {
-    HashKeys hashKeys;
+    // The keys of the previous and next key sequences are computed
+    // here as well, so that frames and messages received around a
+    // key rotation do not need a key derivation each.
 
-    ComputeKeys(mKeySequence, hashKeys);
+    HashKeys curHashKeys;
+    HashKeys prevHashKeys;
+    HashKeys nextHashKeys;
 
-    mMleKey.SetFrom(hashKeys.GetMleKey());
+    ComputeKeys(mKeySequence, curHashKeys);
+    ComputeKeys(mKeySequence - 1, prevHashKeys);
+    ComputeKeys(mKeySequence + 1, nextHashKeys);
+
+    mMleKey.SetFrom(curHashKeys.GetMleKey());
+    mPrevMleKey.SetFrom(prevHashKeys.GetMleKey());
+    mNextMleKey.SetFrom(nextHashKeys.GetMleKey());
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     {
@@ -340,13 +351,9 @@ void KeyManager::UpdateKeyMaterial(void)
         Mac::KeyMaterial prevKey;
         Mac::KeyMaterial nextKey;
 
-        curKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
-
-        ComputeKeys(mKeySequence - 1, hashKeys);
-        prevKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
-
-        ComputeKeys(mKeySequence + 1, hashKeys);
-        nextKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+        curKey.SetFrom(curHashKeys.GetMacKey(), kExportableMacKeys);
+        prevKey.SetFrom(prevHashKeys.GetMacKey(), kExportableMacKeys);
+        nextKey.SetFrom(nextHashKeys.GetMacKey(), kExportableMacKeys);
 
         Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prevKey, curKey, nextKey);
     }
@@ -358,6 +365,12 @@ void KeyManager::UpdateKeyMaterial(void)
 
         ComputeTrelKey(mKeySequence, key);
         mTrelKey.SetFrom(key);
+
+        ComputeTrelKey(mKeySequence - 1, key);
+        mPrevTrelKey.SetFrom(key);
+
+        ComputeTrelKey(mKeySequence + 1, key);
+        mNextTrelKey.SetFrom(key);
     }
 #endif
 }
@@ -392,23 +405,55 @@ exit:
 
 const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const Mle::KeyMaterial *key;
 
-    ComputeKeys(aKeySequence, hashKeys);
-    mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+    if (aKeySequence == mKeySequence - 1)
+    {
+        key = &mPrevMleKey;
+        mTemporaryKeyCacheHits++;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        key = &mNextMleKey;
+        mTemporaryKeyCacheHits++;
+    }
+    else
+    {
+        HashKeys hashKeys;
 
-    return mTemporaryMleKey;
+        ComputeKeys(aKeySequence, hashKeys);
+        mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+        key = &mTemporaryMleKey;
+    }
+
+    return *key;
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
-    Mac::Key key;
+    const Mac::KeyMaterial *key;
+
+    if (aKeySequence == mKeySequence - 1)
+    {
+        key = &mPrevTrelKey;
+        mTemporaryKeyCacheHits++;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        key = &mNextTrelKey;
+        mTemporaryKeyCacheHits++;
+    }
+    else
+    {
+        Mac::Key macKey;
 
-    ComputeTrelKey(aKeySequence, key);
-    mTemporaryTrelKey.SetFrom(key);
+        ComputeTrelKey(aKeySequence, macKey);
+        mTemporaryTrelKey.SetFrom(macKey);
+        key = &mTemporaryTrelKey;
+    }
 
-    return mTemporaryTrelKey;
+    return *key;
 }
 #endif
 
@@ -338,6 +338,9 @@ public:
     /**
      * This method returns a temporary MAC key for TREL radio link computed from the given key sequence.
      *
+     * The keys for the previous and next key sequences (relative to the current one) are cached and returned without
+     * being computed again.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary TREL MAC key.
@@ -357,6 +360,9 @@ public:
     /**
      * This method returns a temporary MLE key Material computed from the given key sequence.
      *
+     * The keys for the previous and next key sequences (relative to the current one) are cached and returned without
+     * being computed again.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary MLE key.
@@ -364,6 +370,21 @@ public:
      */
     const Mle::KeyMaterial &GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the number of temporary (MLE or TREL MAC) key requests served from the cached keys of the
+     * previous and next key sequences.
+     *
+     * @returns The number of temporary key cache hits.
+     *
+     */
+    uint32_t GetTemporaryKeyCacheHits(void) const { return mTemporaryKeyCacheHits; }
+
+    /**
+     * This method resets the temporary key cache hits counter.
+     *
+     */
+    void ResetTemporaryKeyCacheHits(void) { mTemporaryKeyCacheHits = 0; }
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     /**
      * This method returns the current MAC Frame Counter value for 15.4 radio link.
@@ -602,13 +623,19 @@ private:
 
     uint32_t         mKeySequence;
     Mle::KeyMaterial mMleKey;
+    Mle::KeyMaterial mPrevMleKey;
+    Mle::KeyMaterial mNextMleKey;
     Mle::KeyMaterial mTemporaryMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     Mac::KeyMaterial mTrelKey;
+    Mac::KeyMaterial mPrevTrelKey;
+    Mac::KeyMaterial mNextTrelKey;
     Mac::KeyMaterial mTemporaryTrelKey;
 #endif
 
+    uint32_t mTemporaryKeyCacheHits;
+
     Mac::LinkFrameCounters mMacFrameCounters;
     uint32_t               mMleFrameCounter;
     uint32_t               mStoredMacFrameCounter;
@@ -225,6 +225,11 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
         {
             IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(aMessage, child));
         }
+
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+        // Covers the children which are no longer valid.
+        mIndirectSender.RemoveMessageFromChildQueues(aMessage);
+#endif
 #endif
 
         if (mSendMessage == &aMessage)
@@ -608,7 +613,15 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
 
         default:
             LogMessage(kMessageDrop, *curMessage, error);
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+            // The message may still be referenced by the per-child
+            // indirect queues (e.g., multicast to sleepy children), so
+            // only its direct tx is dropped.
+            curMessage->ClearDirectTransmission();
+            RemoveMessageIfNoPendingTx(*curMessage);
+#else
             mSendQueue.DequeueAndFree(*curMessage);
+#endif
             continue;
         }
     }
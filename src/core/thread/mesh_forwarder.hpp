@@ -57,6 +57,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 namespace Mle {
 class DiscoverScanner;
 }
@@ -171,6 +173,7 @@ class MeshForwarder : public InstanceLocator, private NonCopyable
     friend class Ip6::Ip6;
     friend class Mle::DiscoverScanner;
     friend class TimeTicker;
+    friend class ot::UnitTester;
 
 public:
     /**
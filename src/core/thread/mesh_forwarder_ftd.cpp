@@ -168,6 +168,9 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
         if (aError != kErrorNone)
         {
             LogMessage(kMessageDrop, message, kErrorAddressQuery);
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+            mIndirectSender.RemoveMessageFromChildQueues(message);
+#endif
             mSendQueue.DequeueAndFree(message);
             continue;
         }
@@ -337,6 +340,12 @@ void MeshForwarder::RemoveDataResponseMessages(void)
             }
         }
 
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+        // A multicast message (or one queued for a child which is no
+        // longer valid) may still be in the child queues.
+        mIndirectSender.RemoveMessageFromChildQueues(message);
+#endif
+
         if (mSendMessage == &message)
         {
             mSendMessage = nullptr;
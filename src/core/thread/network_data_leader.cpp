@@ -60,6 +60,18 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     SetLength(0);
+    SignalNetDataChanged();
+}
+
+void LeaderBase::SignalNetDataChanged(void)
+{
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    mFib.Build(GetTlvsStart(), GetTlvsEnd());
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    mContextTable.Build(GetTlvsStart(), GetTlvsEnd());
+#endif
+
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -141,6 +153,14 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         GetContextForMeshLocalPrefix(aContext);
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    if (mContextTable.IsValid())
+    {
+        mContextTable.FindContext(aAddress, aContext);
+        ExitNow();
+    }
+#endif
+
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         contextTlv = prefix->FindSubTlv<ContextTlv>();
@@ -159,6 +179,9 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         }
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+exit:
+#endif
     return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
 }
 
@@ -174,6 +197,13 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
         ExitNow(error = kErrorNone);
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    if (mContextTable.IsValid())
+    {
+        ExitNow(error = mContextTable.FindContext(aContextId, aContext));
+    }
+#endif
+
     while ((prefix = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
     {
         const ContextTlv *contextTlv = prefix->FindSubTlv<ContextTlv>();
@@ -203,12 +233,29 @@ void LeaderBase::GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const
 }
 
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
+{
+    bool rval = true;
+
+    VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress));
+
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    if (mFib.IsValid())
+    {
+        ExitNow(rval = mFib.IsOnMesh(aAddress));
+    }
+#endif
+
+    rval = IsOnMeshInTlvs(aAddress);
+
+exit:
+    return rval;
+}
+
+bool LeaderBase::IsOnMeshInTlvs(const Ip6::Address &aAddress) const
 {
     const PrefixTlv *prefix = nullptr;
     bool             rval   = false;
 
-    VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), rval = true);
-
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         // check both stable and temporary Border Router TLVs
@@ -237,6 +284,26 @@ exit:
 }
 
 Error LeaderBase::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+{
+    Error error;
+
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    if (mFib.IsValid())
+    {
+        error = mFib.RouteLookup(aSource, aDestination, aRloc16);
+    }
+    else
+#endif
+    {
+        error = RouteLookupInTlvs(aSource, aDestination, aRloc16);
+    }
+
+    return error;
+}
+
+Error LeaderBase::RouteLookupInTlvs(const Ip6::Address &aSource,
+                                    const Ip6::Address &aDestination,
+                                    uint16_t           &aRloc16) const
 {
     Error            error  = kErrorNoRoute;
     const PrefixTlv *prefix = nullptr;
@@ -409,7 +476,7 @@ Error LeaderBase::SetNetworkData(uint8_t        aVersion,
 
     DumpDebg("SetNetworkData", GetBytes(), GetLength());
 
-    Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
+    SignalNetDataChanged();
 
 exit:
     return error;
@@ -434,7 +501,7 @@ Error LeaderBase::SetCommissioningData(const uint8_t *aValue, uint8_t aValueLeng
     }
 
     mVersion++;
-    Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
+    SignalNetDataChanged();
 
 exit:
     return error;
@@ -529,5 +596,371 @@ Error LeaderBase::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDisce
     return SteeringDataCheck(filterIndexes);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// LeaderBase::Fib
+
+LeaderBase::Fib::Fib(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mNumEntries(0)
+    , mNumExternalRouteEntries(0)
+    , mNumRlocs(0)
+    , mIsValid(true)
+{
+}
+
+void LeaderBase::Fib::Build(const NetworkDataTlv *aStart, const NetworkDataTlv *aEnd)
+{
+    TlvIterator      tlvIterator(aStart, aEnd);
+    const PrefixTlv *prefixTlv;
+
+    mNumEntries              = 0;
+    mNumExternalRouteEntries = 0;
+    mNumRlocs                = 0;
+    mIsValid                 = false;
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        SuccessOrExit(AddEntry(*prefixTlv));
+    }
+
+    SortExternalRoutes();
+    mIsValid = true;
+
+exit:
+    if (!mIsValid)
+    {
+        LogInfo("Network Data does not fit in forwarding table, using TLV lookups");
+    }
+}
+
+Error LeaderBase::Fib::AddEntry(const PrefixTlv &aPrefixTlv)
+{
+    Error                  error = kErrorNone;
+    Entry                 *entry;
+    TlvIterator            hasRouteIterator(aPrefixTlv);
+    TlvIterator            borderRouterIterator(aPrefixTlv);
+    const HasRouteTlv     *hasRoute;
+    const BorderRouterTlv *borderRouter;
+
+    VerifyOrExit(mNumEntries < kMaxPrefixes, error = kErrorNoBufs);
+
+    entry = &mEntries[mNumEntries++];
+    entry->mPrefix.Set(aPrefixTlv.GetPrefix(), aPrefixTlv.GetPrefixLength());
+    entry->mDomainId = aPrefixTlv.GetDomainId();
+    entry->mIsOnMesh = false;
+
+    // Same as `IsOnMeshInTlvs()`, check the first stable and the
+    // first temporary Border Router TLVs.
+
+    for (int i = 0; i < 2; i++)
+    {
+        borderRouter = aPrefixTlv.FindSubTlv<BorderRouterTlv>(/* aStable */ (i == 0));
+
+        if (borderRouter == nullptr)
+        {
+            continue;
+        }
+
+        for (const BorderRouterEntry *brEntry = borderRouter->GetFirstEntry(); brEntry <= borderRouter->GetLastEntry();
+             brEntry                          = brEntry->GetNext())
+        {
+            entry->mIsOnMesh |= brEntry->IsOnMesh();
+        }
+    }
+
+    entry->mExternalRoutes.mIndex  = mNumRlocs;
+    entry->mExternalRoutes.mLength = 0;
+
+    while ((hasRoute = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+    {
+        for (const HasRouteEntry *routeEntry = hasRoute->GetFirstEntry(); routeEntry <= hasRoute->GetLastEntry();
+             routeEntry                      = routeEntry->GetNext())
+        {
+            SuccessOrExit(error = AddRoute(entry->mExternalRoutes, routeEntry->GetPreference(), routeEntry->GetRloc()));
+        }
+    }
+
+    entry->mDefaultRoutes.mIndex  = mNumRlocs;
+    entry->mDefaultRoutes.mLength = 0;
+
+    while ((borderRouter = borderRouterIterator.Iterate<BorderRouterTlv>()) != nullptr)
+    {
+        for (const BorderRouterEntry *brEntry = borderRouter->GetFirstEntry(); brEntry <= borderRouter->GetLastEntry();
+             brEntry                          = brEntry->GetNext())
+        {
+            if (brEntry->IsDefaultRoute())
+            {
+                SuccessOrExit(error = AddRoute(entry->mDefaultRoutes, brEntry->GetPreference(), brEntry->GetRloc()));
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error LeaderBase::Fib::AddRoute(Routes &aRoutes, int8_t aPreference, uint16_t aRloc16)
+{
+    // `aRoutes` is always the last range in `mRlocs`. Only the
+    // routes with the highest preference are kept, so a route with
+    // a higher preference replaces all the earlier ones.
+
+    Error error = kErrorNone;
+
+    if ((aRoutes.mLength == 0) || (aPreference > aRoutes.mPreference))
+    {
+        mNumRlocs           = aRoutes.mIndex;
+        aRoutes.mLength     = 0;
+        aRoutes.mPreference = aPreference;
+    }
+
+    VerifyOrExit(aPreference == aRoutes.mPreference);
+    VerifyOrExit(mNumRlocs < kMaxRoutes, error = kErrorNoBufs);
+
+    mRlocs[mNumRlocs++] = aRloc16;
+    aRoutes.mLength++;
+
+exit:
+    return error;
+}
+
+void LeaderBase::Fib::SortExternalRoutes(void)
+{
+    // Stable insertion sort of the entries with external routes by
+    // prefix length (longest first). Among entries with the same
+    // prefix length, the earlier one in the Network Data is used by
+    // the lookup (same as `ExternalRouteLookup()` parsing the TLVs).
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        uint8_t prefixLength = mEntries[index].mPrefix.GetLength();
+        uint8_t pos          = mNumExternalRouteEntries;
+
+        if (mEntries[index].mExternalRoutes.mLength == 0)
+        {
+            continue;
+        }
+
+        while ((pos > 0) && (mEntries[mExternalRouteOrder[pos - 1]].mPrefix.GetLength() < prefixLength))
+        {
+            mExternalRouteOrder[pos] = mExternalRouteOrder[pos - 1];
+            pos--;
+        }
+
+        mExternalRouteOrder[pos] = index;
+        mNumExternalRouteEntries++;
+    }
+}
+
+bool LeaderBase::Fib::IsOnMesh(const Ip6::Address &aAddress) const
+{
+    bool rval = false;
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        const Entry &entry = mEntries[index];
+
+        if (entry.mIsOnMesh && aAddress.MatchesPrefix(entry.mPrefix))
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+Error LeaderBase::Fib::RouteLookup(const Ip6::Address &aSource,
+                                   const Ip6::Address &aDestination,
+                                   uint16_t           &aRloc16) const
+{
+    Error error = kErrorNoRoute;
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        const Entry &entry = mEntries[index];
+
+        if (!aSource.MatchesPrefix(entry.mPrefix))
+        {
+            continue;
+        }
+
+        if (ExternalRouteLookup(entry.mDomainId, aDestination, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+
+        if (entry.mDefaultRoutes.mLength > 0)
+        {
+            aRloc16 = SelectRoute(entry.mDefaultRoutes);
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error LeaderBase::Fib::ExternalRouteLookup(uint8_t             aDomainId,
+                                           const Ip6::Address &aDestination,
+                                           uint16_t           &aRloc16) const
+{
+    Error error = kErrorNoRoute;
+
+    for (uint8_t i = 0; i < mNumExternalRouteEntries; i++)
+    {
+        const Entry &entry = mEntries[mExternalRouteOrder[i]];
+
+        if ((entry.mDomainId == aDomainId) && aDestination.MatchesPrefix(entry.mPrefix))
+        {
+            aRloc16 = SelectRoute(entry.mExternalRoutes);
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+uint16_t LeaderBase::Fib::SelectRoute(const Routes &aRoutes) const
+{
+    // All routes in `aRoutes` have the same preference, select the
+    // one with the lowest mesh path cost (the earlier one on a tie).
+
+    uint16_t rloc16 = mRlocs[aRoutes.mIndex];
+    uint8_t  cost   = Get<Mle::MleRouter>().GetPathCost(rloc16);
+
+    for (uint8_t index = aRoutes.mIndex + 1; index < aRoutes.mIndex + aRoutes.mLength; index++)
+    {
+        uint8_t newCost = Get<Mle::MleRouter>().GetPathCost(mRlocs[index]);
+
+        if (newCost < cost)
+        {
+            rloc16 = mRlocs[index];
+            cost   = newCost;
+        }
+    }
+
+    return rloc16;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// LeaderBase::ContextTable
+
+LeaderBase::ContextTable::ContextTable(void)
+    : mNumEntries(0)
+    , mIsValid(false)
+{
+}
+
+void LeaderBase::ContextTable::Build(const NetworkDataTlv *aStart, const NetworkDataTlv *aEnd)
+{
+    TlvIterator      tlvIterator(aStart, aEnd);
+    const PrefixTlv *prefixTlv;
+
+    memset(mIdIndexes, kInvalidIndex, sizeof(mIdIndexes));
+    mNumEntries = 0;
+    mIsValid    = false;
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        uint8_t           prefixLength;
+        uint8_t           pos;
+
+        if (contextTlv == nullptr)
+        {
+            continue;
+        }
+
+        VerifyOrExit(mNumEntries < kMaxEntries);
+
+        // Insert the new entry after all the entries with the same or
+        // a longer prefix, so the earlier Prefix TLV is matched first
+        // among the ones with the same prefix length.
+
+        prefixLength = prefixTlv->GetPrefixLength();
+        pos          = mNumEntries;
+
+        while ((pos > 0) && (mEntries[pos - 1].mPrefix.GetLength() < prefixLength))
+        {
+            mEntries[pos] = mEntries[pos - 1];
+            pos--;
+        }
+
+        for (uint8_t &index : mIdIndexes)
+        {
+            if ((index != kInvalidIndex) && (index >= pos))
+            {
+                index++;
+            }
+        }
+
+        mEntries[pos].mPrefix.Set(prefixTlv->GetPrefix(), prefixLength);
+        mEntries[pos].mContextId    = contextTlv->GetContextId();
+        mEntries[pos].mCompressFlag = contextTlv->IsCompress();
+        mNumEntries++;
+
+        if (mIdIndexes[contextTlv->GetContextId()] == kInvalidIndex)
+        {
+            mIdIndexes[contextTlv->GetContextId()] = pos;
+        }
+    }
+
+    mIsValid = true;
+
+exit:
+    return;
+}
+
+void LeaderBase::ContextTable::FindContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+{
+    // Finds the longest matching prefix which is longer than the one
+    // already in `aContext` (mesh-local prefix or empty).
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        VerifyOrExit(mEntries[index].mPrefix.GetLength() > aContext.mPrefix.GetLength());
+
+        if (aAddress.MatchesPrefix(mEntries[index].mPrefix))
+        {
+            CopyEntryTo(index, aContext);
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+Error LeaderBase::ContextTable::FindContext(uint8_t aContextId, Lowpan::Context &aContext) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((aContextId < kNumContextIds) && (mIdIndexes[aContextId] != kInvalidIndex), error = kErrorNotFound);
+    CopyEntryTo(mIdIndexes[aContextId], aContext);
+
+exit:
+    return error;
+}
+
+void LeaderBase::ContextTable::CopyEntryTo(uint8_t aIndex, Lowpan::Context &aContext) const
+{
+    const Entry &entry = mEntries[aIndex];
+
+    aContext.mPrefix       = entry.mPrefix;
+    aContext.mContextId    = entry.mContextId;
+    aContext.mCompressFlag = entry.mCompressFlag;
+    aContext.mIsValid      = true;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+
 } // namespace NetworkData
 } // namespace ot
@@ -74,6 +74,9 @@ public:
      */
     explicit LeaderBase(Instance &aInstance)
         : MutableNetworkData(aInstance, mTlvBuffer, 0, sizeof(mTlvBuffer))
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+        , mFib(aInstance)
+#endif
     {
         Reset();
     }
@@ -280,12 +283,143 @@ public:
     Error GetPreferredNat64Prefix(ExternalRouteConfig &aConfig) const;
 
 protected:
+    /**
+     * This method signals that the Network Data has changed.
+     *
+     * This method updates the compiled forwarding and context tables (if enabled) and then signals
+     * `kEventThreadNetdataChanged`.
+     * It MUST be called after any change to the Network Data TLVs.
+     *
+     */
+    void SignalNetDataChanged(void);
+
+    /**
+     * This method indicates whether or not the given IPv6 address is on-mesh by parsing the Network Data TLVs.
+     *
+     * Unlike `IsOnMesh()`, this method does not check the mesh-local prefix or use the compiled forwarding table.
+     *
+     * @param[in]  aAddress  A reference to an IPv6 address.
+     *
+     * @retval TRUE   If @p aAddress matches an on-mesh prefix in the Network Data.
+     * @retval FALSE  If @p aAddress does not match an on-mesh prefix in the Network Data.
+     *
+     */
+    bool IsOnMeshInTlvs(const Ip6::Address &aAddress) const;
+
+    /**
+     * This method performs a route lookup by parsing the Network Data TLVs (without using the forwarding table).
+     *
+     * @param[in]   aSource             A reference to the IPv6 source address.
+     * @param[in]   aDestination        A reference to the IPv6 destination address.
+     * @param[out]  aRloc16             A reference to return the RLOC16 for the selected route.
+     *
+     * @retval kErrorNone      Successfully found a route. @p aRloc16 is updated.
+     * @retval kErrorNoRoute   No valid route was found.
+     *
+     */
+    Error RouteLookupInTlvs(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
     using FilterIndexes = MeshCoP::SteeringData::HashBitIndexes;
 
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    // The forwarding table (FIB) is compiled from the Network Data
+    // TLVs whenever they change. It keeps one entry per Prefix TLV
+    // (in the same order as in the Network Data) along with the
+    // RLOC16s of its most preferred external and default routes.
+    // Ties between these routes are broken by the mesh path cost
+    // during lookup, since path costs change independently of the
+    // Network Data. Any Network Data which does not fit in the table
+    // marks it invalid and lookups then parse the TLVs instead.
+
+    class Fib : public InstanceLocator
+    {
+    public:
+        explicit Fib(Instance &aInstance);
+
+        void  Build(const NetworkDataTlv *aStart, const NetworkDataTlv *aEnd);
+        bool  IsValid(void) const { return mIsValid; }
+        bool  IsOnMesh(const Ip6::Address &aAddress) const;
+        Error RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
+
+    private:
+        static constexpr uint8_t kMaxPrefixes = OPENTHREAD_CONFIG_NETDATA_FIB_MAX_PREFIXES;
+        static constexpr uint8_t kMaxRoutes   = OPENTHREAD_CONFIG_NETDATA_FIB_MAX_ROUTES;
+
+        struct Routes // Range of most preferred route RLOC16s in `mRlocs`.
+        {
+            uint8_t mIndex;
+            uint8_t mLength;
+            int8_t  mPreference;
+        };
+
+        struct Entry
+        {
+            Ip6::Prefix mPrefix;
+            uint8_t     mDomainId;
+            bool        mIsOnMesh;
+            Routes      mExternalRoutes;
+            Routes      mDefaultRoutes;
+        };
+
+        Error    AddEntry(const PrefixTlv &aPrefixTlv);
+        Error    AddRoute(Routes &aRoutes, int8_t aPreference, uint16_t aRloc16);
+        void     SortExternalRoutes(void);
+        Error    ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
+        uint16_t SelectRoute(const Routes &aRoutes) const;
+
+        Entry    mEntries[kMaxPrefixes];
+        uint8_t  mExternalRouteOrder[kMaxPrefixes]; // Indexes of entries with external routes, longest prefix first.
+        uint16_t mRlocs[kMaxRoutes];
+        uint8_t  mNumEntries;
+        uint8_t  mNumExternalRouteEntries;
+        uint8_t  mNumRlocs;
+        bool     mIsValid;
+    };
+#endif // OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    // The context table is compiled from the Context sub-TLVs in the
+    // Network Data whenever it changes (along with the FIB). The
+    // entries are sorted by prefix length (longest first) and also
+    // indexed by Context ID. The mesh-local prefix context is not
+    // part of the table since the mesh-local prefix can change
+    // independently of the Network Data.
+
+    class ContextTable
+    {
+    public:
+        ContextTable(void);
+
+        void  Build(const NetworkDataTlv *aStart, const NetworkDataTlv *aEnd);
+        bool  IsValid(void) const { return mIsValid; }
+        void  FindContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const;
+        Error FindContext(uint8_t aContextId, Lowpan::Context &aContext) const;
+
+    private:
+        static constexpr uint8_t kNumContextIds = 16; // Context ID is a 4-bit value.
+        static constexpr uint8_t kMaxEntries    = kNumContextIds;
+        static constexpr uint8_t kInvalidIndex  = 0xff;
+
+        struct Entry
+        {
+            Ip6::Prefix mPrefix;
+            uint8_t     mContextId;
+            bool        mCompressFlag;
+        };
+
+        void CopyEntryTo(uint8_t aIndex, Lowpan::Context &aContext) const;
+
+        Entry   mEntries[kMaxEntries];
+        uint8_t mIdIndexes[kNumContextIds]; // Index in `mEntries` of the first Context TLV with the ID.
+        uint8_t mNumEntries;
+        bool    mIsValid;
+    };
+#endif // OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+
     const PrefixTlv *FindNextMatchingPrefix(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
 
     void RemoveCommissioningData(void);
@@ -302,6 +436,12 @@ private:
     void  GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const;
 
     uint8_t mTlvBuffer[kMaxSize];
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    Fib mFib;
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    ContextTable mContextTable;
+#endif
 };
 
 /**
@@ -91,6 +91,68 @@ void Neighbor::Init(Instance &aInstance)
     SetState(kStateInvalid);
 }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+void Neighbor::SetState(State aState)
+{
+    Child *child = RemoveFromChildTableIndex();
+
+    mState = static_cast<uint8_t>(aState);
+    AddToChildTableIndex(child);
+}
+
+void Neighbor::ClearExtAddress(void)
+{
+    Child *child = RemoveFromChildTableIndex();
+
+    memset(&mMacAddr, 0, sizeof(mMacAddr));
+    AddToChildTableIndex(child);
+}
+
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+    Child *child = RemoveFromChildTableIndex();
+
+    mMacAddr = aAddress;
+    AddToChildTableIndex(child);
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+    Child *child = RemoveFromChildTableIndex();
+
+    mRloc16 = aRloc16;
+    AddToChildTableIndex(child);
+}
+
+Child *Neighbor::RemoveFromChildTableIndex(void)
+{
+    // Removes the neighbor from the child table index if it is one of
+    // the child table entries, so that one of its indexed fields can be
+    // changed. Returns the child entry which then needs to be passed to
+    // `AddToChildTableIndex()` once the change is done.
+
+    Child *child = nullptr;
+
+    VerifyOrExit(Get<ChildTable>().Contains(*this));
+
+    child = static_cast<Child *>(this);
+    Get<ChildTable>().RemoveFromIndex(*child);
+
+exit:
+    return child;
+}
+
+void Neighbor::AddToChildTableIndex(Child *aChild)
+{
+    if (aChild != nullptr)
+    {
+        Get<ChildTable>().AddToIndex(*aChild);
+    }
+}
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
 bool Neighbor::IsStateValidOrAttaching(void) const
 {
     bool rval = false;
@@ -303,12 +365,27 @@ void Child::Clear(void)
 {
     Instance &instance = GetInstance();
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (Get<ChildTable>().Contains(*this))
+    {
+        Get<ChildTable>().RemoveFromIndex(*this);
+        Get<ChildTable>().RemoveAddressesFromIndex(*this);
+    }
+#endif
+
     memset(reinterpret_cast<void *>(this), 0, sizeof(Child));
     Init(instance);
 }
 
 void Child::ClearIp6Addresses(void)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (Get<ChildTable>().Contains(*this))
+    {
+        Get<ChildTable>().RemoveAddressesFromIndex(*this);
+    }
+#endif
+
     mMeshLocalIid.Clear();
     memset(mIp6Address, 0, sizeof(mIp6Address));
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
@@ -361,6 +438,13 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
         if (ip6Address.IsUnspecified())
         {
             ip6Address = aAddress;
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+            if (Get<ChildTable>().Contains(*this))
+            {
+                Get<ChildTable>().AddAddressToIndex(*this, static_cast<uint16_t>(&ip6Address - mIp6Address));
+            }
+#endif
             ExitNow();
         }
 
@@ -404,6 +488,13 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
 
     SuccessOrExit(error);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (Get<ChildTable>().Contains(*this))
+    {
+        Get<ChildTable>().RemoveAddressesFromIndex(*this);
+    }
+#endif
+
     for (; index < kNumIp6Addresses - 1; index++)
     {
         mIp6Address[index] = mIp6Address[index + 1];
@@ -411,6 +502,13 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
 
     mIp6Address[kNumIp6Addresses - 1].Clear();
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (Get<ChildTable>().Contains(*this))
+    {
+        Get<ChildTable>().AddAddressesToIndex(*this);
+    }
+#endif
+
 exit:
     return error;
 }
@@ -63,6 +63,9 @@
 
 namespace ot {
 
+class Child;
+class ChildTable;
+
 /**
  * This class represents a Thread neighbor.
  *
@@ -119,6 +122,8 @@ public:
      */
     class AddressMatcher
     {
+        friend class ChildTable;
+
     public:
         /**
          * This constructor initializes the `AddressMatcher` with a given MAC short address (RCOC16) and state filter.
@@ -224,7 +229,11 @@ public:
      * @param[in]  aState  The state value.
      *
      */
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void SetState(State aState);
+#else
     void SetState(State aState) { mState = static_cast<uint8_t>(aState); }
+#endif
 
     /**
      * This method indicates whether the neighbor is in the Invalid state.
@@ -367,7 +376,11 @@ public:
      * This method sets all bytes of the Extended Address to zero.
      *
      */
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void ClearExtAddress(void);
+#else
     void ClearExtAddress(void) { memset(&mMacAddr, 0, sizeof(mMacAddr)); }
+#endif
 
     /**
      * This method returns the Extended Address.
@@ -383,7 +396,11 @@ public:
      * @param[in]  aAddress  The Extended Address value to set.
      *
      */
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
+#else
     void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+#endif
 
     /**
      * This method gets the key sequence value.
@@ -496,7 +513,11 @@ public:
      * @param[in]  aRloc16  The RLOC16 value.
      *
      */
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void SetRloc16(uint16_t aRloc16);
+#else
     void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+#endif
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -792,6 +813,11 @@ private:
         kLastRxFragmentTagTimeout = OPENTHREAD_CONFIG_MULTI_RADIO_FRAG_TAG_TIMEOUT, ///< Frag tag timeout in msec.
     };
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Child *RemoveFromChildTableIndex(void);
+    void   AddToChildTableIndex(Child *aChild);
+#endif
+
     Mac::ExtAddress mMacAddr;   ///< The IEEE 802.15.4 Extended Address
     TimeMilli       mLastHeard; ///< Time when last heard.
     union
@@ -854,6 +880,7 @@ class Child : public Neighbor,
               public CslTxScheduler::ChildInfo
 #endif
 {
+    friend class ChildTable;
     class AddressIteratorBuilder;
 
 public:
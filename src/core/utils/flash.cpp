@@ -84,6 +84,10 @@ void Flash::Init(void)
 
     SanitizeFreeSpace();
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    BuildIndex();
+#endif
+
 exit:
     return;
 }
@@ -118,45 +122,68 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
 {
     Error        error       = kErrorNotFound;
     uint16_t     valueLength = 0;
-    int          index       = 0; // This must be initialized to 0. See [Note] in Delete().
-    uint32_t     offset;
+    uint32_t     matchOffset = 0;
     RecordHeader record;
 
-    for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    if (mIndexValid)
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+        const IndexEntry *entry = FindIndexEntry(aKey, aIndex);
 
-        if ((record.GetKey() != aKey) || !record.IsValid())
-        {
-            continue;
-        }
+        VerifyOrExit(entry != nullptr);
+        matchOffset = entry->mOffset;
+    }
+    else
+#endif
+    {
+        int index = 0; // This must be initialized to 0. See [Note] in Delete().
 
-        if (record.IsFirst())
-        {
-            index = 0;
-        }
+        // The last matching record wins, since a later record marked as
+        // first restarts the indexes of the key.
 
-        if (index == aIndex)
+        for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
         {
-            if (aValue && aValueLength)
+            otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+
+            if ((record.GetKey() != aKey) || !record.IsValid())
             {
-                uint16_t readLength = *aValueLength;
+                continue;
+            }
 
-                if (readLength > record.GetLength())
-                {
-                    readLength = record.GetLength();
-                }
+            if (record.IsFirst())
+            {
+                index = 0;
+            }
 
-                otPlatFlashRead(&GetInstance(), mSwapIndex, offset + sizeof(record), aValue, readLength);
+            if (index == aIndex)
+            {
+                matchOffset = offset;
             }
 
-            valueLength = record.GetLength();
-            error       = kErrorNone;
+            index++;
         }
 
-        index++;
+        VerifyOrExit(matchOffset != 0);
     }
 
+    otPlatFlashRead(&GetInstance(), mSwapIndex, matchOffset, &record, sizeof(record));
+
+    if (aValue && aValueLength)
+    {
+        uint16_t readLength = *aValueLength;
+
+        if (readLength > record.GetLength())
+        {
+            readLength = record.GetLength();
+        }
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, matchOffset + sizeof(record), aValue, readLength);
+    }
+
+    valueLength = record.GetLength();
+    error       = kErrorNone;
+
+exit:
     if (aValueLength)
     {
         *aValueLength = valueLength;
@@ -198,6 +225,10 @@ Error Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aVa
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    AddToIndex(mSwapUsed, aKey, aFirst);
+#endif
+
     mSwapUsed += record.GetSize();
 
 exit:
@@ -209,6 +240,25 @@ bool Flash::DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const
     RecordHeader record;
     bool         rval = false;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    if (mIndexValid)
+    {
+        uint16_t end;
+
+        for (uint16_t i = FindIndexRange(aKey, end); i < end; i++)
+        {
+            const IndexEntry &entry = mIndexEntries[i];
+
+            if ((entry.mOffset >= aOffset) && entry.mFirst)
+            {
+                ExitNow(rval = true);
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     for (; aOffset < mSwapUsed; aOffset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
@@ -253,6 +303,10 @@ exit:
 
     mSwapIndex = dstIndex;
     mSwapUsed  = dstOffset;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    BuildIndex();
+#endif
 }
 
 Error Flash::Delete(uint16_t aKey, int aIndex)
@@ -261,6 +315,62 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
     int          index = 0; // This must be initialized to 0. See [Note] below.
     RecordHeader record;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    if (mIndexValid)
+    {
+        // Same as the scan below, but only visiting the valid records of
+        // the key through the index. Deleted entries are removed from the
+        // index while iterating.
+
+        uint16_t end;
+        uint16_t start  = FindIndexRange(aKey, end);
+        uint16_t length = start;
+
+        for (uint16_t i = start; i < end; i++)
+        {
+            IndexEntry &entry   = mIndexEntries[i];
+            bool        deleted = false;
+
+            if (entry.mFirst)
+            {
+                index = 0;
+            }
+
+            if ((aIndex == index) || (aIndex == -1) || ((index == 1) && (aIndex == 0)))
+            {
+                otPlatFlashRead(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+            }
+
+            if ((aIndex == index) || (aIndex == -1))
+            {
+                record.SetDeleted();
+                otPlatFlashWrite(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+                deleted = true;
+                error   = kErrorNone;
+            }
+
+            if ((index == 1) && (aIndex == 0))
+            {
+                record.SetFirst();
+                otPlatFlashWrite(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+                entry.mFirst = true;
+            }
+
+            index++;
+
+            if (!deleted)
+            {
+                mIndexEntries[length++] = entry;
+            }
+        }
+
+        memmove(&mIndexEntries[length], &mIndexEntries[end], (mIndexLength - end) * sizeof(IndexEntry));
+        mIndexLength -= end - length;
+        UpdateIndexes(aKey);
+        ExitNow();
+    }
+#endif
+
     for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -295,6 +405,9 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
         index++;
     }
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+exit:
+#endif
     return error;
 }
 
@@ -305,8 +418,158 @@ void Flash::Wipe(void)
 
     mSwapIndex = 0;
     mSwapUsed  = sizeof(sSwapActive);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    ClearIndex();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+
+void Flash::ClearIndex(void)
+{
+    mIndexValid  = true;
+    mIndexLength = 0;
+}
+
+void Flash::BuildIndex(void)
+{
+    RecordHeader record;
+
+    ClearIndex();
+
+    for (uint32_t offset = kSwapMarkerSize; (offset < mSwapUsed) && mIndexValid; offset += record.GetSize())
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+
+        if (record.IsValid())
+        {
+            AddToIndex(offset, record.GetKey(), record.IsFirst());
+        }
+    }
+}
+
+void Flash::AddToIndex(uint32_t aOffset, uint16_t aKey, bool aFirst)
+{
+    IndexEntry *entry;
+    uint16_t    start;
+    uint16_t    end;
+
+    VerifyOrExit(mIndexValid);
+
+    if (mIndexLength >= OT_ARRAY_LENGTH(mIndexEntries))
+    {
+        // Out of budget, fall back to scanning the flash until the
+        // index is rebuilt on the next `Swap()` or `Wipe()`.
+        mIndexValid = false;
+        ExitNow();
+    }
+
+    // Records are always appended at increasing offsets, so the new
+    // entry goes at the end of the range of its key.
+
+    start = FindIndexRange(aKey, end);
+    memmove(&mIndexEntries[end + 1], &mIndexEntries[end], (mIndexLength - end) * sizeof(IndexEntry));
+    mIndexLength++;
+
+    entry          = &mIndexEntries[end];
+    entry->mOffset = aOffset;
+    entry->mKey    = aKey;
+    entry->mFirst  = aFirst;
+    entry->mIndex  = (aFirst || (start == end)) ? 0 : mIndexEntries[end - 1].mIndex + 1;
+
+exit:
+    return;
+}
+
+void Flash::UpdateIndexes(uint16_t aKey)
+{
+    uint16_t index = 0;
+    uint16_t end;
+
+    for (uint16_t i = FindIndexRange(aKey, end); i < end; i++)
+    {
+        IndexEntry &entry = mIndexEntries[i];
+
+        if (entry.mFirst)
+        {
+            index = 0;
+        }
+
+        entry.mIndex = index++;
+    }
 }
 
+uint16_t Flash::FindIndexRange(uint16_t aKey, uint16_t &aEnd) const
+{
+    // The entries are sorted by key, and by offset for the same key.
+    // Binary search for the first entry of the key, then for the first
+    // entry past it.
+
+    uint16_t low  = 0;
+    uint16_t high = mIndexLength;
+    uint16_t start;
+
+    while (low < high)
+    {
+        uint16_t mid = low + (high - low) / 2;
+
+        if (mIndexEntries[mid].mKey < aKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    start = low;
+    high  = mIndexLength;
+
+    while (low < high)
+    {
+        uint16_t mid = low + (high - low) / 2;
+
+        if (mIndexEntries[mid].mKey <= aKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    aEnd = low;
+
+    return start;
+}
+
+const Flash::IndexEntry *Flash::FindIndexEntry(uint16_t aKey, int aIndex) const
+{
+    const IndexEntry *match = nullptr;
+    uint16_t          end;
+    uint16_t          start = FindIndexRange(aKey, end);
+
+    // Search backwards since the last matching record wins (see `Get()`).
+
+    for (uint16_t i = end; i > start; i--)
+    {
+        const IndexEntry &entry = mIndexEntries[i - 1];
+
+        if (entry.mIndex == aIndex)
+        {
+            match = &entry;
+            break;
+        }
+    }
+
+    return match;
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+
 } // namespace ot
 
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
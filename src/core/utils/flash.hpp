@@ -213,14 +213,39 @@ private:
         uint8_t mData[kMaxDataSize];
     } OT_TOOL_PACKED_END;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    struct IndexEntry
+    {
+        uint32_t mOffset;     // Offset of the record in the active swap area.
+        uint16_t mKey;        // Key of the record.
+        uint16_t mIndex : 15; // Index of the record as computed when scanning the records of the key in order.
+        uint16_t mFirst : 1;  // Whether the record is marked as the first record of the key.
+    };
+#endif
+
     Error Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
     bool  DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
     void  SanitizeFreeSpace(void);
     void  Swap(void);
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    void              BuildIndex(void);
+    void              ClearIndex(void);
+    void              AddToIndex(uint32_t aOffset, uint16_t aKey, bool aFirst);
+    void              UpdateIndexes(uint16_t aKey);
+    uint16_t          FindIndexRange(uint16_t aKey, uint16_t &aEnd) const;
+    const IndexEntry *FindIndexEntry(uint16_t aKey, int aIndex) const;
+#endif
+
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES > 0
+    bool       mIndexValid;
+    uint16_t   mIndexLength;
+    IndexEntry mIndexEntries[OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES]; // Sorted by key, then offset.
+#endif
 };
 
 } // namespace ot
@@ -33,6 +33,8 @@
 #ifndef HDLC_HPP_
 #define HDLC_HPP_
 
+#include "openthread-hdlc-config.h"
+
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -99,6 +101,30 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in] aBytes   A pointer to the bytes to write.
+     * @param[in] aLength  The number of bytes in @p aBytes.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write all the bytes (nothing is written).
+     *
+     */
+    otError WriteBytes(const uint8_t *aBytes, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(CanWrite(aLength), error = OT_ERROR_NO_BUFS);
+
+        memcpy(mWritePointer, aBytes, aLength);
+        mWritePointer += aLength;
+        mRemainingLength -= aLength;
+
+    exit:
+        return error;
+    }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -581,6 +607,8 @@ private:
         kStateEscaped,
     };
 
+    void DecodeByte(uint8_t aByte);
+
     State              mState;
     FrameWritePointer &mWritePointer;
     FrameHandler       mFrameHandler;
@@ -55,4 +55,14 @@
 #define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 0
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+ *
+ * Define 1 to collect latency histograms of spinel requests, radio transmissions and the RCP interface on the host.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE 0
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
@@ -37,6 +37,7 @@
 #include <openthread/platform/radio.h>
 
 #include "openthread-spinel-config.h"
+#include "radio_spinel_latency.hpp"
 #include "radio_spinel_metrics.h"
 #include "spinel.h"
 #include "spinel_interface.hpp"
@@ -886,6 +887,16 @@ public:
      */
     const otRadioSpinelMetrics *GetRadioSpinelMetrics(void) const { return &mRadioSpinelMetrics; }
 
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    /**
+     * This method returns the radio Spinel latency statistics.
+     *
+     * @returns The radio Spinel latency statistics.
+     *
+     */
+    LatencyStats &GetLatencyStats(void) { return mLatencyStats; }
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE
     /**
      * Add a calibrated power of the specificed channel to the power calibration table.
@@ -1133,6 +1144,13 @@ private:
     MaxPowerTable mMaxPowerTable;
 
     otRadioSpinelMetrics mRadioSpinelMetrics;
+
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    LatencyStats mLatencyStats;
+    uint32_t     mRequestCommand;   ///< The spinel command of current transaction.
+    uint64_t     mRequestStartUs;   ///< When current transaction was sent.
+    uint64_t     mTxRequestStartUs; ///< When the radio frame being transmitted was sent.
+#endif
 };
 
 } // namespace Spinel
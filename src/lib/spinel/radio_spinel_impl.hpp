@@ -219,6 +219,11 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mTxRadioEndUs(UINT64_MAX)
     , mRadioTimeRecalcStart(UINT64_MAX)
     , mRadioTimeOffset(UINT64_MAX)
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    , mRequestCommand(0)
+    , mRequestStartUs(0)
+    , mTxRequestStartUs(0)
+#endif
 {
     mVersion[0] = '\0';
     memset(&mRadioSpinelMetrics, 0, sizeof(mRadioSpinelMetrics));
@@ -583,6 +588,9 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
 
     if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
     {
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+        mLatencyStats.RecordCommand(mRequestCommand, mWaitingKey, otPlatTimeGet() - mRequestStartUs);
+#endif
         HandleWaitingResponse(cmd, key, data, static_cast<uint16_t>(len));
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
@@ -591,6 +599,9 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
     {
         if (mState == kStateTransmitting)
         {
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+            LatencyStats::Record(mLatencyStats.mTxDone, otPlatTimeGet() - mTxRequestStartUs);
+#endif
             HandleTransmitDone(cmd, key, data, static_cast<uint16_t>(len));
         }
 
@@ -1790,9 +1801,16 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::RequestV(uint32_t
 {
     otError      error = OT_ERROR_NONE;
     spinel_tid_t tid   = GetNextTid();
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    uint64_t startUs;
+#endif
 
     VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
 
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    startUs = otPlatTimeGet();
+#endif
+
     error = SendCommand(command, aKey, tid, aFormat, aArgs);
     SuccessOrExit(error);
 
@@ -1802,12 +1820,19 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::RequestV(uint32_t
         assert(mTxRadioTid == 0);
         VerifyOrExit(mTxRadioTid == 0, error = OT_ERROR_BUSY);
         mTxRadioTid = tid;
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+        mTxRequestStartUs = startUs;
+#endif
     }
     else
     {
         mWaitingKey = aKey;
         mWaitingTid = tid;
-        error       = WaitResponse();
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+        mRequestCommand = command;
+        mRequestStartUs = startUs;
+#endif
+        error = WaitResponse();
     }
 
 exit:
@@ -0,0 +1,137 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file includes definitions for the radio spinel latency statistics.
+ *
+ */
+
+#ifndef RADIO_SPINEL_LATENCY_HPP_
+#define RADIO_SPINEL_LATENCY_HPP_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "openthread-spinel-config.h"
+#include "radio_spinel_metrics.h"
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Spinel {
+
+/**
+ * This class collects the radio spinel latency histograms.
+ *
+ * The statistics live in a fixed-size structure: recording a sample never allocates and never takes a lock. All
+ * samples are recorded from the host mainloop.
+ *
+ */
+class LatencyStats : public otRadioSpinelLatencyStats
+{
+public:
+    /**
+     * This constructor initializes the object with all histograms empty.
+     *
+     */
+    LatencyStats(void) { Clear(); }
+
+    /**
+     * This method clears all histograms.
+     *
+     */
+    void Clear(void) { memset(static_cast<otRadioSpinelLatencyStats *>(this), 0, sizeof(otRadioSpinelLatencyStats)); }
+
+    /**
+     * This method records the latency of a request for a spinel command and property.
+     *
+     * If the command/property pair is not yet tracked and the table is full, the sample is only counted in
+     * `mUntrackedCount`.
+     *
+     * @param[in] aCommand    The spinel command.
+     * @param[in] aKey        The spinel property key.
+     * @param[in] aLatencyUs  The request to response latency in microseconds.
+     *
+     */
+    void RecordCommand(uint32_t aCommand, uint32_t aKey, uint64_t aLatencyUs)
+    {
+        uint8_t index;
+
+        for (index = 0; index < mNumCommands; index++)
+        {
+            if ((mCommands[index].mCommand == aCommand) && (mCommands[index].mKey == aKey))
+            {
+                break;
+            }
+        }
+
+        if (index == mNumCommands)
+        {
+            VerifyOrExit(mNumCommands < OT_RADIO_SPINEL_LATENCY_MAX_COMMANDS, mUntrackedCount++);
+
+            mCommands[index].mCommand = aCommand;
+            mCommands[index].mKey     = aKey;
+            mNumCommands++;
+        }
+
+        Record(mCommands[index].mHistogram, aLatencyUs);
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method records a sample in a histogram.
+     *
+     * @param[in] aHistogram  The histogram.
+     * @param[in] aValue      The sample value.
+     *
+     */
+    static void Record(otRadioSpinelLatencyHistogram &aHistogram, uint64_t aValue)
+    {
+        uint8_t bucket = 0;
+
+        for (uint64_t value = aValue; (value != 0) && (bucket < OT_RADIO_SPINEL_LATENCY_BUCKETS - 1); value >>= 1)
+        {
+            bucket++;
+        }
+
+        aHistogram.mCount++;
+        aHistogram.mSum += aValue;
+        aHistogram.mBuckets[bucket]++;
+
+        if (aValue > aHistogram.mMax)
+        {
+            aHistogram.mMax = (aValue > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(aValue);
+        }
+    }
+};
+
+} // namespace Spinel
+} // namespace ot
+
+#endif // RADIO_SPINEL_LATENCY_HPP_
@@ -51,6 +51,58 @@ typedef struct otRadioSpinelMetrics
     uint32_t mSpinelParseErrorCount;   ///< The number of spinel frame parse errors.
 } otRadioSpinelMetrics;
 
+/**
+ * This constant defines the number of buckets in a radio spinel latency histogram.
+ *
+ */
+#define OT_RADIO_SPINEL_LATENCY_BUCKETS 24
+
+/**
+ * This constant defines the maximum number of spinel command/property pairs tracked in `otRadioSpinelLatencyStats`.
+ *
+ */
+#define OT_RADIO_SPINEL_LATENCY_MAX_COMMANDS 32
+
+/**
+ * This structure represents a log-scale latency histogram.
+ *
+ * Bucket 0 counts samples with value zero. Bucket `i` (for `i > 0`) counts samples in `[2^(i-1), 2^i)`, and the last
+ * bucket also counts all larger samples. The unit of the samples is given by the containing field.
+ *
+ */
+typedef struct otRadioSpinelLatencyHistogram
+{
+    uint32_t mCount;                                   ///< The number of samples.
+    uint32_t mMax;                                     ///< The largest sample.
+    uint64_t mSum;                                     ///< The sum of all samples.
+    uint32_t mBuckets[OT_RADIO_SPINEL_LATENCY_BUCKETS]; ///< The number of samples in each bucket.
+} otRadioSpinelLatencyHistogram;
+
+/**
+ * This structure represents the latency of requests for a spinel command and property.
+ *
+ */
+typedef struct otRadioSpinelCommandLatency
+{
+    uint32_t                      mCommand;   ///< The spinel command (`SPINEL_CMD_*`).
+    uint32_t                      mKey;       ///< The spinel property key (`SPINEL_PROP_*`).
+    otRadioSpinelLatencyHistogram mHistogram; ///< Request to response latency in microseconds.
+} otRadioSpinelCommandLatency;
+
+/**
+ * This structure represents the radio spinel latency statistics.
+ *
+ */
+typedef struct otRadioSpinelLatencyStats
+{
+    otRadioSpinelCommandLatency   mCommands[OT_RADIO_SPINEL_LATENCY_MAX_COMMANDS]; ///< Per command/property latency.
+    uint8_t                       mNumCommands;     ///< The number of valid entries in `mCommands`.
+    uint32_t                      mUntrackedCount;  ///< The number of samples dropped as `mCommands` was full.
+    otRadioSpinelLatencyHistogram mTxDone;          ///< Transmit request to `TxDone` in microseconds.
+    otRadioSpinelLatencyHistogram mWriteToReadable; ///< Interface write to interface readable in microseconds.
+    otRadioSpinelLatencyHistogram mHdlcDecode;      ///< HDLC decoding time per received chunk in nanoseconds.
+} otRadioSpinelLatencyStats;
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
@@ -69,6 +69,7 @@
 #include <openthread/platform/misc.h>
 
 #include "lib/platform/reset_util.h"
+#include "lib/spinel/openthread-spinel-config.h"
 
 /**
  * This function initializes NCP app.
@@ -332,14 +333,119 @@ void otPlatReset(otInstance *aInstance)
 static otError ProcessNetif(void *aContext, uint8_t aArgsLength, char *aArgs[])
 {
     OT_UNUSED_VARIABLE(aContext);
-    OT_UNUSED_VARIABLE(aArgsLength);
-    OT_UNUSED_VARIABLE(aArgs);
 
-    otCliOutputFormat("%s:%u\r\n", otSysGetThreadNetifName(), otSysGetThreadNetifIndex());
+    otError error = OT_ERROR_NONE;
+
+    if (aArgsLength == 0)
+    {
+        otCliOutputFormat("%s:%u\r\n", otSysGetThreadNetifName(), otSysGetThreadNetifIndex());
+    }
+    else if ((aArgsLength == 1) && (strcmp(aArgs[0], "counters") == 0))
+    {
+        const otSysNetifCounters *counters = otSysGetThreadNetifCounters();
+
+        otCliOutputFormat("TxPackets: %llu\r\n", (unsigned long long)counters->mTxPackets);
+        otCliOutputFormat("TxDrops: %llu\r\n", (unsigned long long)counters->mTxDrops);
+        otCliOutputFormat("TxBatches: %llu\r\n", (unsigned long long)counters->mTxBatches);
+        otCliOutputFormat("TxMaxBatchSize: %lu\r\n", (unsigned long)counters->mTxMaxBatchSize);
+        otCliOutputFormat("TxBatchSizeLimit: %u\r\n", OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE);
+        otCliOutputFormat("RxPackets: %llu\r\n", (unsigned long long)counters->mRxPackets);
+        otCliOutputFormat("RxDrops: %llu\r\n", (unsigned long long)counters->mRxDrops);
+    }
+    else if ((aArgsLength == 2) && (strcmp(aArgs[0], "counters") == 0) && (strcmp(aArgs[1], "reset") == 0))
+    {
+        otSysResetThreadNetifCounters();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+static uint32_t GetLatencyPercentile(const otRadioSpinelLatencyHistogram *aHistogram, uint8_t aPercent)
+{
+    uint64_t threshold = ((uint64_t)aHistogram->mCount * aPercent + 99) / 100;
+    uint64_t count     = 0;
+    uint32_t rval      = aHistogram->mMax;
+
+    for (uint8_t i = 0; i < OT_RADIO_SPINEL_LATENCY_BUCKETS - 1; i++)
+    {
+        count += aHistogram->mBuckets[i];
+
+        if (count >= threshold)
+        {
+            // Upper bound of bucket `i`, but no larger than the max.
+            uint32_t bound = (i == 0) ? 0 : (uint32_t)((1ULL << i) - 1);
+
+            rval = (bound < rval) ? bound : rval;
+            break;
+        }
+    }
+
+    return rval;
+}
+
+static void OutputLatency(const char *aName, const otRadioSpinelLatencyHistogram *aHistogram, const char *aUnit)
+{
+    otCliOutputFormat("%s: count:%lu", aName, (unsigned long)aHistogram->mCount);
 
-    return OT_ERROR_NONE;
+    if (aHistogram->mCount > 0)
+    {
+        otCliOutputFormat(" avg:%lu%s max:%lu%s p50:<=%lu%s p90:<=%lu%s p99:<=%lu%s",
+                          (unsigned long)(aHistogram->mSum / aHistogram->mCount), aUnit,
+                          (unsigned long)aHistogram->mMax, aUnit,
+                          (unsigned long)GetLatencyPercentile(aHistogram, 50), aUnit,
+                          (unsigned long)GetLatencyPercentile(aHistogram, 90), aUnit,
+                          (unsigned long)GetLatencyPercentile(aHistogram, 99), aUnit);
+    }
+
+    otCliOutputFormat("\r\n");
 }
 
+static otError ProcessRcpLatency(void *aContext, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    otError                          error = OT_ERROR_NONE;
+    const otRadioSpinelLatencyStats *stats;
+
+    if (aArgsLength == 0)
+    {
+        char name[40];
+
+        stats = otSysGetRadioSpinelLatencyStats();
+        VerifyOrExit(stats != NULL, error = OT_ERROR_NOT_IMPLEMENTED);
+
+        OutputLatency("txdone", &stats->mTxDone, "us");
+        OutputLatency("write-to-readable", &stats->mWriteToReadable, "us");
+        OutputLatency("hdlc-decode", &stats->mHdlcDecode, "ns");
+
+        for (uint8_t i = 0; i < stats->mNumCommands; i++)
+        {
+            snprintf(name, sizeof(name), "cmd %lu prop 0x%lx", (unsigned long)stats->mCommands[i].mCommand,
+                     (unsigned long)stats->mCommands[i].mKey);
+            OutputLatency(name, &stats->mCommands[i].mHistogram, "us");
+        }
+
+        otCliOutputFormat("untracked: %lu\r\n", (unsigned long)stats->mUntrackedCount);
+    }
+    else if ((aArgsLength == 1) && (strcmp(aArgs[0], "reset") == 0))
+    {
+        otSysResetRadioSpinelLatencyStats();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+
 #if !OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
 static otError ProcessExit(void *aContext, uint8_t aArgsLength, char *aArgs[])
 {
@@ -356,6 +462,9 @@ static const otCliCommand kCommands[] = {
     {"exit", ProcessExit},
 #endif
     {"netif", ProcessNetif},
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    {"rcplatency", ProcessRcpLatency},
+#endif
 };
 
 int main(int argc, char *argv[])
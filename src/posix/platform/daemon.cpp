@@ -94,8 +94,7 @@ int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
     if (rval < 0)
     {
         otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSessionSocket();
     }
 
 exit:
@@ -128,11 +127,10 @@ void Daemon::InitializeSessionSocket(void)
 #endif
 #endif // __linux__
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-    }
+    CloseSessionSocket();
     mSessionSocket = newSessionSocket;
+    Mainloop::Manager::Get().AddFd(*this, mSessionSocket,
+                                   Mainloop::Manager::kEventRead | Mainloop::Manager::kEventError);
 
 exit:
     if (rval == -1)
@@ -149,6 +147,18 @@ exit:
     }
 }
 
+void Daemon::CloseSessionSocket(void)
+{
+    VerifyOrExit(mSessionSocket != -1);
+
+    Mainloop::Manager::Get().RemoveFd(mSessionSocket);
+    close(mSessionSocket);
+    mSessionSocket = -1;
+
+exit:
+    return;
+}
+
 void Daemon::SetUp(void)
 {
     struct sockaddr_un sockname;
@@ -244,6 +254,8 @@ void Daemon::SetUp(void)
         this);
 
     Mainloop::Manager::Get().Add(*this);
+    Mainloop::Manager::Get().AddFd(*this, mListenSocket,
+                                   Mainloop::Manager::kEventRead | Mainloop::Manager::kEventError);
 
 exit:
     return;
@@ -253,11 +265,7 @@ void Daemon::TearDown(void)
 {
     Mainloop::Manager::Get().Remove(*this);
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-        mSessionSocket = -1;
-    }
+    CloseSessionSocket();
 
     if (mListenSocket != -1)
     {
@@ -282,33 +290,6 @@ void Daemon::TearDown(void)
     }
 }
 
-void Daemon::Update(otSysMainloopContext &aContext)
-{
-    if (mListenSocket != -1)
-    {
-        FD_SET(mListenSocket, &aContext.mReadFdSet);
-        FD_SET(mListenSocket, &aContext.mErrorFdSet);
-
-        if (aContext.mMaxFd < mListenSocket)
-        {
-            aContext.mMaxFd = mListenSocket;
-        }
-    }
-
-    if (mSessionSocket != -1)
-    {
-        FD_SET(mSessionSocket, &aContext.mReadFdSet);
-        FD_SET(mSessionSocket, &aContext.mErrorFdSet);
-
-        if (aContext.mMaxFd < mSessionSocket)
-        {
-            aContext.mMaxFd = mSessionSocket;
-        }
-    }
-
-    return;
-}
-
 void Daemon::Process(const otSysMainloopContext &aContext)
 {
     ssize_t rval;
@@ -328,8 +309,7 @@ void Daemon::Process(const otSysMainloopContext &aContext)
 
     if (FD_ISSET(mSessionSocket, &aContext.mErrorFdSet))
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSessionSocket();
     }
     else if (FD_ISSET(mSessionSocket, &aContext.mReadFdSet))
     {
@@ -350,8 +330,7 @@ void Daemon::Process(const otSysMainloopContext &aContext)
             {
                 otLogWarnPlat("Daemon read: %s", strerror(errno));
             }
-            close(mSessionSocket);
-            mSessionSocket = -1;
+            CloseSessionSocket();
         }
     }
 
@@ -43,12 +43,12 @@ public:
 
     void SetUp(void);
     void TearDown(void);
-    void Update(otSysMainloopContext &aContext) override;
     void Process(const otSysMainloopContext &aContext) override;
 
 private:
     int  OutputFormatV(const char *aFormat, va_list aArguments);
     void InitializeSessionSocket(void);
+    void CloseSessionSocket(void);
 
     int mListenSocket  = -1;
     int mDaemonLock    = -1;
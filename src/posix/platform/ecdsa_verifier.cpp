@@ -0,0 +1,262 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the ECDSA signature verifier running on worker threads.
+ */
+
+#include "posix/platform/ecdsa_verifier.hpp"
+
+#include "platform-posix.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <openthread/platform/crypto.h>
+
+#include "common/code_utils.hpp"
+
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+
+#if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+#error "OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE requires OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE"
+#endif
+
+otError otPlatCryptoEcdsaVerifyAsync(otInstance                       *aInstance,
+                                     uint32_t                          aRequestId,
+                                     const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                     const otPlatCryptoSha256Hash     *aHash,
+                                     const otPlatCryptoEcdsaSignature *aSignature)
+{
+    return ot::Posix::EcdsaVerifier::Get().Verify(aInstance, aRequestId, *aPublicKey, *aHash, *aSignature);
+}
+
+namespace ot {
+namespace Posix {
+
+void EcdsaVerifier::Queue::Push(const Request &aRequest)
+{
+    assert(mLength < kMaxRequests);
+
+    mRequests[(mHead + mLength) % kMaxRequests] = aRequest;
+    mLength++;
+}
+
+bool EcdsaVerifier::Queue::Pop(Request &aRequest)
+{
+    bool popped = !IsEmpty();
+
+    VerifyOrExit(popped);
+
+    aRequest = mRequests[mHead];
+    mHead    = (mHead + 1) % kMaxRequests;
+    mLength--;
+
+exit:
+    return popped;
+}
+
+void EcdsaVerifier::SetUp(void)
+{
+    VerifyOrDie(pipe(mPipe) == 0, OT_EXIT_ERROR_ERRNO);
+
+    for (int fd : mPipe)
+    {
+        VerifyOrDie(fcntl(fd, F_SETFD, FD_CLOEXEC) == 0, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(fcntl(fd, F_SETFL, O_NONBLOCK) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    mRunning = true;
+
+    for (pthread_t &thread : mThreads)
+    {
+        VerifyOrDie(pthread_create(&thread, nullptr, &EcdsaVerifier::Run, this) == 0, OT_EXIT_FAILURE);
+    }
+
+    Mainloop::Manager::Get().Add(*this);
+    Mainloop::Manager::Get().AddFd(*this, mPipe[0], Mainloop::Manager::kEventRead);
+}
+
+void EcdsaVerifier::TearDown(void)
+{
+    VerifyOrExit(mRunning);
+
+    Mainloop::Manager::Get().Remove(*this);
+
+    pthread_mutex_lock(&mMutex);
+    mRunning = false;
+    pthread_cond_broadcast(&mCondition);
+    pthread_mutex_unlock(&mMutex);
+
+    for (pthread_t &thread : mThreads)
+    {
+        pthread_join(thread, nullptr);
+    }
+
+    mWaitingQueue.Clear();
+    mDoneQueue.Clear();
+    mNumRequests = 0;
+
+    for (int &fd : mPipe)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+exit:
+    return;
+}
+
+otError EcdsaVerifier::Verify(otInstance                       *aInstance,
+                              uint32_t                          aRequestId,
+                              const otPlatCryptoEcdsaPublicKey &aPublicKey,
+                              const otPlatCryptoSha256Hash     &aHash,
+                              const otPlatCryptoEcdsaSignature &aSignature)
+{
+    otError error = OT_ERROR_NONE;
+    Request request;
+
+    VerifyOrExit(mRunning, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(mNumRequests < kMaxRequests, error = OT_ERROR_NO_BUFS);
+
+    request.mInstance  = aInstance;
+    request.mRequestId = aRequestId;
+    request.mPublicKey = aPublicKey;
+    request.mHash      = aHash;
+    request.mSignature = aSignature;
+    request.mError     = OT_ERROR_NONE;
+
+    pthread_mutex_lock(&mMutex);
+    mWaitingQueue.Push(request);
+    pthread_cond_signal(&mCondition);
+    pthread_mutex_unlock(&mMutex);
+
+    mNumRequests++;
+
+exit:
+    return error;
+}
+
+void *EcdsaVerifier::Run(void *aVerifier)
+{
+    static_cast<EcdsaVerifier *>(aVerifier)->Run();
+
+    return nullptr;
+}
+
+void EcdsaVerifier::Run(void)
+{
+    // This runs on a worker thread. It must not call into OpenThread
+    // other than the stateless `otPlatCryptoEcdsaVerify()`.
+
+    Request request;
+
+    pthread_mutex_lock(&mMutex);
+
+    while (true)
+    {
+        while (mRunning && mWaitingQueue.IsEmpty())
+        {
+            pthread_cond_wait(&mCondition, &mMutex);
+        }
+
+        if (!mRunning)
+        {
+            break;
+        }
+
+        IgnoreReturnValue(mWaitingQueue.Pop(request));
+        pthread_mutex_unlock(&mMutex);
+
+        request.mError = otPlatCryptoEcdsaVerify(&request.mPublicKey, &request.mHash, &request.mSignature);
+
+        pthread_mutex_lock(&mMutex);
+
+        // The mainloop drains the pipe before it empties the done
+        // queue, so waking it up once per non-empty queue is enough.
+        if (mDoneQueue.IsEmpty())
+        {
+            uint8_t event = 0;
+
+            IgnoreReturnValue(write(mPipe[1], &event, sizeof(event)));
+        }
+
+        mDoneQueue.Push(request);
+    }
+
+    pthread_mutex_unlock(&mMutex);
+}
+
+void EcdsaVerifier::Process(const otSysMainloopContext &aContext)
+{
+    Request  requests[kMaxRequests];
+    uint16_t numRequests = 0;
+    uint8_t  events[16];
+
+    VerifyOrExit(mPipe[0] != -1 && FD_ISSET(mPipe[0], &aContext.mReadFdSet));
+
+    while (read(mPipe[0], events, sizeof(events)) > 0)
+    {
+    }
+
+    pthread_mutex_lock(&mMutex);
+
+    while (mDoneQueue.Pop(requests[numRequests]))
+    {
+        numRequests++;
+    }
+
+    pthread_mutex_unlock(&mMutex);
+
+    mNumRequests -= numRequests;
+
+    // The results are reported without `mMutex` locked, as OpenThread
+    // may queue the next requests from the callback.
+    for (uint16_t i = 0; i < numRequests; i++)
+    {
+        otPlatCryptoEcdsaVerifyAsyncDone(requests[i].mInstance, requests[i].mRequestId, requests[i].mError);
+    }
+
+exit:
+    return;
+}
+
+EcdsaVerifier &EcdsaVerifier::Get(void)
+{
+    static EcdsaVerifier sInstance;
+
+    return sInstance;
+}
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
@@ -0,0 +1,150 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the ECDSA signature verifier running on worker threads.
+ */
+
+#ifndef OT_POSIX_PLATFORM_ECDSA_VERIFIER_HPP_
+#define OT_POSIX_PLATFORM_ECDSA_VERIFIER_HPP_
+
+#include "openthread-posix-config.h"
+
+#include <pthread.h>
+
+#include <openthread/instance.h>
+#include <openthread/platform/crypto.h>
+
+#include "core/common/non_copyable.hpp"
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * This class verifies ECDSA signatures on worker threads and reports the results from the mainloop.
+ *
+ */
+class EcdsaVerifier : public Mainloop::Source, private NonCopyable
+{
+public:
+    /**
+     * This function returns the ECDSA verifier singleton.
+     *
+     * @returns A reference to the ECDSA verifier singleton.
+     *
+     */
+    static EcdsaVerifier &Get(void);
+
+    /**
+     * This method starts the worker threads.
+     *
+     */
+    void SetUp(void);
+
+    /**
+     * This method stops the worker threads.
+     *
+     * The requests which are not yet reported are dropped.
+     *
+     */
+    void TearDown(void);
+
+    /**
+     * This method queues a signature verification request.
+     *
+     * The result is reported by calling `otPlatCryptoEcdsaVerifyAsyncDone()` from the mainloop.
+     *
+     * @param[in]  aInstance   The OpenThread instance structure.
+     * @param[in]  aRequestId  The identifier of the request.
+     * @param[in]  aPublicKey  A reference to the ECDSA public key.
+     * @param[in]  aHash       A reference to the SHA-256 hash of the signed data.
+     * @param[in]  aSignature  A reference to the ECDSA signature.
+     *
+     * @retval OT_ERROR_NONE           The request was queued.
+     * @retval OT_ERROR_NO_BUFS        Too many requests are queued.
+     * @retval OT_ERROR_INVALID_STATE  The worker threads are not running.
+     *
+     */
+    otError Verify(otInstance                       *aInstance,
+                   uint32_t                          aRequestId,
+                   const otPlatCryptoEcdsaPublicKey &aPublicKey,
+                   const otPlatCryptoSha256Hash     &aHash,
+                   const otPlatCryptoEcdsaSignature &aSignature);
+
+    void Process(const otSysMainloopContext &aContext) override;
+
+private:
+    static constexpr uint16_t kMaxRequests = OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_IN_FLIGHT;
+    static constexpr uint16_t kNumThreads  = OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_THREAD_NUM;
+
+    static_assert(kNumThreads > 0, "OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_THREAD_NUM must be at least 1");
+
+    struct Request
+    {
+        otInstance                *mInstance;
+        uint32_t                   mRequestId;
+        otPlatCryptoEcdsaPublicKey mPublicKey;
+        otPlatCryptoSha256Hash     mHash;
+        otPlatCryptoEcdsaSignature mSignature;
+        otError                    mError;
+    };
+
+    // A FIFO of requests. It is accessed with `mMutex` locked.
+    class Queue
+    {
+    public:
+        bool IsEmpty(void) const { return mLength == 0; }
+        void Push(const Request &aRequest);
+        bool Pop(Request &aRequest);
+        void Clear(void) { mLength = 0; }
+
+    private:
+        Request  mRequests[kMaxRequests];
+        uint16_t mHead   = 0;
+        uint16_t mLength = 0;
+    };
+
+    static void *Run(void *aVerifier);
+    void         Run(void);
+
+    pthread_mutex_t mMutex     = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t  mCondition = PTHREAD_COND_INITIALIZER;
+    pthread_t       mThreads[kNumThreads];
+    Queue           mWaitingQueue;      // Requests waiting for a worker thread.
+    Queue           mDoneQueue;         // Verified requests waiting to be reported.
+    uint16_t        mNumRequests = 0;   // Requests queued and not yet reported.
+    int             mPipe[2]     = {-1, -1};
+    bool            mRunning     = false;
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OT_POSIX_PLATFORM_ECDSA_VERIFIER_HPP_
@@ -55,6 +55,7 @@
 #include <sys/wait.h>
 #include <syslog.h>
 #include <termios.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <openthread/logging.h>
@@ -134,6 +135,11 @@ HdlcInterface::HdlcInterface(SpinelInterface::ReceiveFrameCallback aCallback,
     , mBaudRate(0)
     , mHdlcDecoder(aFrameBuffer, HandleHdlcFrame, this)
     , mRadioUrl(nullptr)
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    , mLatencyStats(nullptr)
+    , mLastWriteUs(0)
+    , mFrameCallbackNs(0)
+#endif
 {
     memset(&mInterfaceMetrics, 0, sizeof(mInterfaceMetrics));
     mInterfaceMetrics.mRcpInterfaceType = OT_POSIX_RCP_BUS_UART;
@@ -183,6 +189,14 @@ void HdlcInterface::Read(void)
     uint8_t buffer[kMaxFrameSize];
     ssize_t rval;
 
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    if ((mLatencyStats != nullptr) && (mLastWriteUs != 0))
+    {
+        Spinel::LatencyStats::Record(mLatencyStats->mWriteToReadable, otPlatTimeGet() - mLastWriteUs);
+        mLastWriteUs = 0;
+    }
+#endif
+
     rval = read(mSockFd, buffer, sizeof(buffer));
 
     if (rval > 0)
@@ -195,7 +209,35 @@ void HdlcInterface::Read(void)
     }
 }
 
-void HdlcInterface::Decode(const uint8_t *aBuffer, uint16_t aLength) { mHdlcDecoder.Decode(aBuffer, aLength); }
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+static uint64_t GetNowNs(void)
+{
+    struct timespec now;
+
+    VerifyOrDie(clock_gettime(CLOCK_MONOTONIC, &now) == 0, OT_EXIT_FAILURE);
+
+    return static_cast<uint64_t>(now.tv_sec) * NS_PER_US * US_PER_S + static_cast<uint64_t>(now.tv_nsec);
+}
+#endif
+
+void HdlcInterface::Decode(const uint8_t *aBuffer, uint16_t aLength)
+{
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    uint64_t startNs = (mLatencyStats != nullptr) ? GetNowNs() : 0;
+
+    mFrameCallbackNs = 0;
+#endif
+
+    mHdlcDecoder.Decode(aBuffer, aLength);
+
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    if (mLatencyStats != nullptr)
+    {
+        // Exclude the time spent processing the decoded frames.
+        Spinel::LatencyStats::Record(mLatencyStats->mHdlcDecode, GetNowNs() - startNs - mFrameCallbackNs);
+    }
+#endif
+}
 
 otError HdlcInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
 {
@@ -246,6 +288,9 @@ exit:
     mInterfaceMetrics.mTransferredFrameCount++;
     if (error == OT_ERROR_NONE)
     {
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+        mLastWriteUs = otPlatTimeGet();
+#endif
         mInterfaceMetrics.mTxFrameCount++;
         mInterfaceMetrics.mTxFrameByteCount += aLength;
         mInterfaceMetrics.mTransferredValidFrameCount++;
@@ -664,7 +709,13 @@ void HdlcInterface::HandleHdlcFrame(otError aError)
         mInterfaceMetrics.mRxFrameCount++;
         mInterfaceMetrics.mRxFrameByteCount += mReceiveFrameBuffer.GetLength();
         mInterfaceMetrics.mTransferredValidFrameCount++;
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+        uint64_t startNs = (mLatencyStats != nullptr) ? GetNowNs() : 0;
+#endif
         mReceiveFrameCallback(mReceiveFrameContext);
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+        mFrameCallbackNs += (mLatencyStats != nullptr) ? (GetNowNs() - startNs) : 0;
+#endif
     }
     else
     {
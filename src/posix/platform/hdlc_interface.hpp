@@ -38,6 +38,7 @@
 #include "platform-posix.h"
 #include "lib/hdlc/hdlc.hpp"
 #include "lib/spinel/openthread-spinel-config.h"
+#include "lib/spinel/radio_spinel_latency.hpp"
 #include "lib/spinel/spinel_interface.hpp"
 
 #if OPENTHREAD_POSIX_CONFIG_RCP_BUS == OT_POSIX_RCP_BUS_UART
@@ -177,6 +178,17 @@ public:
      */
     const otRcpInterfaceMetrics *GetRcpInterfaceMetrics(void) const { return &mInterfaceMetrics; }
 
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    /**
+     * This method sets the latency statistics in which the interface records the write to readable latency and the
+     * HDLC decoding time.
+     *
+     * @param[in] aLatencyStats  A pointer to the latency statistics, or `nullptr` to stop recording.
+     *
+     */
+    void SetLatencyStats(Spinel::LatencyStats *aLatencyStats) { mLatencyStats = aLatencyStats; }
+#endif
+
 private:
     /**
      * This method instructs `HdlcInterface` to read and decode data from radio over the socket.
@@ -268,6 +280,12 @@ private:
 
     otRcpInterfaceMetrics mInterfaceMetrics;
 
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    Spinel::LatencyStats *mLatencyStats;
+    uint64_t              mLastWriteUs;     ///< When the last frame was written, zero once a read followed it.
+    uint64_t              mFrameCallbackNs; ///< Time spent in the frame callback during current `Decode()`.
+#endif
+
     // Non-copyable, intentionally not implemented.
     HdlcInterface(const HdlcInterface &);
     HdlcInterface &operator=(const HdlcInterface &);
@@ -101,6 +101,23 @@ typedef struct otRcpInterfaceMetrics
     uint64_t mTxFrameByteCount;             ///< The number of transmitted bytes.
 } otRcpInterfaceMetrics;
 
+/**
+ * This structure represents the counters of the Thread network interface.
+ *
+ * Transmit counters refer to the packets read from the interface and sent into the Thread network, receive counters
+ * to the packets received from the Thread network and written to the interface.
+ *
+ */
+typedef struct otSysNetifCounters
+{
+    uint64_t mTxPackets;      ///< The number of packets read from the interface.
+    uint64_t mTxDrops;        ///< The number of packets read from the interface which could not be sent.
+    uint64_t mTxBatches;      ///< The number of wakeups which read at least one packet from the interface.
+    uint32_t mTxMaxBatchSize; ///< The largest number of packets read from the interface in a single wakeup.
+    uint64_t mRxPackets;      ///< The number of packets written to the interface.
+    uint64_t mRxDrops;        ///< The number of packets which could not be written to the interface.
+} otSysNetifCounters;
+
 /**
  * This function performs all platform-specific initialization of OpenThread's drivers and initializes the OpenThread
  * instance.
@@ -195,6 +212,20 @@ const char *otSysGetThreadNetifName(void);
  */
 unsigned int otSysGetThreadNetifIndex(void);
 
+/**
+ * This method returns the counters of the Thread network interface.
+ *
+ * @returns The Thread network interface counters.
+ *
+ */
+const otSysNetifCounters *otSysGetThreadNetifCounters(void);
+
+/**
+ * This method resets the counters of the Thread network interface.
+ *
+ */
+void otSysResetThreadNetifCounters(void);
+
 /**
  * This method returns the infrastructure network interface name.
  *
@@ -219,6 +250,23 @@ const otRadioSpinelMetrics *otSysGetRadioSpinelMetrics(void);
  */
 const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void);
 
+/**
+ * This method returns the radio spinel latency statistics.
+ *
+ * The statistics are only collected when `OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE` is enabled. The write to
+ * readable and HDLC decoding histograms are only collected with the UART (HDLC) RCP bus.
+ *
+ * @returns The radio spinel latency statistics, or NULL if they are not enabled.
+ *
+ */
+const otRadioSpinelLatencyStats *otSysGetRadioSpinelLatencyStats(void);
+
+/**
+ * This method clears the radio spinel latency statistics.
+ *
+ */
+void otSysResetRadioSpinelLatencyStats(void);
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
@@ -357,6 +357,8 @@ void InfraNetif::SetUp(void)
     SuccessOrDie(otBorderRoutingInit(gInstance, mInfraIfIndex, platformInfraIfIsRunning()));
     SuccessOrDie(otBorderRoutingSetEnabled(gInstance, /* aEnabled */ true));
     Mainloop::Manager::Get().Add(*this);
+    Mainloop::Manager::Get().AddFd(*this, mInfraIfIcmp6Socket, Mainloop::Manager::kEventRead);
+    Mainloop::Manager::Get().AddFd(*this, mNetLinkSocket, Mainloop::Manager::kEventRead);
 exit:
     return;
 }
@@ -388,21 +390,6 @@ void InfraNetif::Deinit(void)
     mInfraIfIndex = 0;
 }
 
-void InfraNetif::Update(otSysMainloopContext &aContext)
-{
-    VerifyOrExit(mInfraIfIcmp6Socket != -1);
-    VerifyOrExit(mNetLinkSocket != -1);
-
-    FD_SET(mInfraIfIcmp6Socket, &aContext.mReadFdSet);
-    aContext.mMaxFd = OT_MAX(aContext.mMaxFd, mInfraIfIcmp6Socket);
-
-    FD_SET(mNetLinkSocket, &aContext.mReadFdSet);
-    aContext.mMaxFd = OT_MAX(aContext.mMaxFd, mNetLinkSocket);
-
-exit:
-    return;
-}
-
 void InfraNetif::ReceiveNetLinkMessage(void)
 {
     const size_t kMaxNetLinkBufSize = 8192;
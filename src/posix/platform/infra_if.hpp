@@ -51,14 +51,6 @@ namespace Posix {
 class InfraNetif : public Mainloop::Source, private NonCopyable
 {
 public:
-    /**
-     * This method updates the fd_set and timeout for mainloop.
-     *
-     * @param[in,out]   aContext    A reference to the mainloop context.
-     *
-     */
-    void Update(otSysMainloopContext &aContext) override;
-
     /**
      * This method performs infrastructure network interface processing.
      *
@@ -29,9 +29,25 @@
 #include "posix/platform/mainloop.hpp"
 
 #include <assert.h>
+#include <errno.h>
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+
+#include "platform-posix.h"
 #include "core/common/code_utils.hpp"
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#if !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE is only supported on Linux"
+#endif
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE does not support virtual time"
+#endif
+#endif
+
 namespace ot {
 namespace Posix {
 namespace Mainloop {
@@ -46,6 +62,14 @@ void Manager::Add(Source &aSource)
 
 void Manager::Remove(Source &aSource)
 {
+    for (int fd = 0; (fd <= mMaxFd) && (aSource.mNumFds > 0); fd++)
+    {
+        if (mFds[fd].mSource == &aSource)
+        {
+            RemoveFd(fd);
+        }
+    }
+
     for (Source **pnext = &mSources; *pnext != nullptr; pnext = &(*pnext)->mNext)
     {
         if (*pnext == &aSource)
@@ -55,11 +79,122 @@ void Manager::Remove(Source &aSource)
         }
     }
 
-    aSource.mNext = nullptr;
+    aSource.mNext  = nullptr;
+    aSource.mReady = false;
+}
+
+void Manager::AddFd(Source &aSource, int aFd, uint8_t aEvents)
+{
+    VerifyOrDie(aFd >= 0 && aFd < FD_SETSIZE, OT_EXIT_FAILURE);
+
+    // Registering the same file descriptor again is allowed (e.g., a
+    // source re-adding its open file descriptors after being set up
+    // again), as long as it is from the same source.
+    VerifyOrExit(mFds[aFd].mSource != &aSource);
+    VerifyOrDie(mFds[aFd].mSource == nullptr, OT_EXIT_FAILURE);
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    {
+        struct epoll_event event;
+
+        if (mEpollFd < 0)
+        {
+            mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+            VerifyOrDie(mEpollFd >= 0, OT_EXIT_ERROR_ERRNO);
+        }
+
+        memset(&event, 0, sizeof(event));
+        event.data.fd = aFd;
+
+        if (aEvents & kEventRead)
+        {
+            event.events |= EPOLLIN;
+        }
+
+        if (aEvents & kEventWrite)
+        {
+            event.events |= EPOLLOUT;
+        }
+
+        if (aEvents & kEventError)
+        {
+            event.events |= EPOLLPRI;
+        }
+
+        VerifyOrDie(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+#endif
+
+    mFds[aFd].mSource = &aSource;
+    mFds[aFd].mEvents = aEvents;
+    aSource.mNumFds++;
+
+    mMaxFd = OT_MAX(mMaxFd, aFd);
+
+exit:
+    return;
+}
+
+void Manager::RemoveFd(int aFd)
+{
+    VerifyOrExit(aFd >= 0 && aFd <= mMaxFd && mFds[aFd].mSource != nullptr);
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    VerifyOrDie(epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr) == 0, OT_EXIT_ERROR_ERRNO);
+#endif
+
+    mFds[aFd].mSource->mNumFds--;
+    mFds[aFd].mSource = nullptr;
+    mFds[aFd].mEvents = 0;
+
+    while (mMaxFd >= 0 && mFds[mMaxFd].mSource == nullptr)
+    {
+        mMaxFd--;
+    }
+
+exit:
+    return;
 }
 
 void Manager::Update(otSysMainloopContext &aContext)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // The registered file descriptors stay in the epoll instance, only
+    // the epoll file descriptor itself is waited for.
+    if (mMaxFd >= 0)
+    {
+        FD_SET(mEpollFd, &aContext.mReadFdSet);
+        aContext.mMaxFd = OT_MAX(aContext.mMaxFd, mEpollFd);
+    }
+#else
+    for (int fd = 0; fd <= mMaxFd; fd++)
+    {
+        uint8_t events = mFds[fd].mEvents;
+
+        if (mFds[fd].mSource == nullptr)
+        {
+            continue;
+        }
+
+        if (events & kEventRead)
+        {
+            FD_SET(fd, &aContext.mReadFdSet);
+        }
+
+        if (events & kEventWrite)
+        {
+            FD_SET(fd, &aContext.mWriteFdSet);
+        }
+
+        if (events & kEventError)
+        {
+            FD_SET(fd, &aContext.mErrorFdSet);
+        }
+
+        aContext.mMaxFd = OT_MAX(aContext.mMaxFd, fd);
+    }
+#endif
+
     for (Source *source = mSources; source != nullptr; source = source->mNext)
     {
         source->Update(aContext);
@@ -70,10 +205,85 @@ void Manager::Process(const otSysMainloopContext &aContext)
 {
     for (Source *source = mSources; source != nullptr; source = source->mNext)
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        // Sources with registered file descriptors are only processed
+        // when `epoll_wait()` reported one of them ready.
+        if (source->mNumFds > 0 && !source->mReady)
+        {
+            continue;
+        }
+
+        source->mReady = false;
+#endif
         source->Process(aContext);
     }
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+Manager::~Manager(void)
+{
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+}
+
+int Manager::Poll(otSysMainloopContext &aContext)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                rval;
+    int                count;
+
+    rval = select(aContext.mMaxFd + 1, &aContext.mReadFdSet, &aContext.mWriteFdSet, &aContext.mErrorFdSet,
+                  &aContext.mTimeout);
+    VerifyOrExit(rval > 0 && mEpollFd >= 0 && FD_ISSET(mEpollFd, &aContext.mReadFdSet));
+
+    FD_CLR(mEpollFd, &aContext.mReadFdSet);
+    rval--;
+
+    count = epoll_wait(mEpollFd, events, kMaxEpollEvents, 0);
+    VerifyOrExit(count >= 0, rval = -1);
+
+    for (int i = 0; i < count; i++)
+    {
+        int      fd    = events[i].data.fd;
+        uint32_t ready = events[i].events;
+        FdEntry &entry = mFds[fd];
+
+        if (entry.mSource == nullptr)
+        {
+            continue;
+        }
+
+        // Like `select()`, report a hang-up or an error as readable
+        // and writable to let the source observe it.
+
+        if ((entry.mEvents & kEventRead) && (ready & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+        {
+            FD_SET(fd, &aContext.mReadFdSet);
+        }
+
+        if ((entry.mEvents & kEventWrite) && (ready & (EPOLLOUT | EPOLLERR)))
+        {
+            FD_SET(fd, &aContext.mWriteFdSet);
+        }
+
+        if ((entry.mEvents & kEventError) && (ready & EPOLLPRI))
+        {
+            FD_SET(fd, &aContext.mErrorFdSet);
+        }
+
+        aContext.mMaxFd       = OT_MAX(aContext.mMaxFd, fd);
+        entry.mSource->mReady = true;
+        rval++;
+    }
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
@@ -34,6 +34,8 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -43,6 +45,10 @@ namespace Mainloop {
 /**
  * This class is the base for all mainloop event sources.
  *
+ * A source registers its file descriptors once with `Manager::AddFd()` and unregisters them with
+ * `Manager::RemoveFd()` before closing them. The manager then waits for them and calls `Process()` when any of them
+ * is ready. A source which has no registered file descriptor is processed on every mainloop iteration.
+ *
  */
 class Source
 {
@@ -50,12 +56,12 @@ class Source
 
 public:
     /**
-     * This method registers events in the mainloop.
+     * This method updates the mainloop context before waiting (e.g., to shorten the timeout).
      *
      * @param[in,out]   aContext    A reference to the mainloop context.
      *
      */
-    virtual void Update(otSysMainloopContext &aContext) = 0;
+    virtual void Update(otSysMainloopContext &aContext) { OT_UNUSED_VARIABLE(aContext); }
 
     /**
      * This method processes the mainloop events.
@@ -72,7 +78,9 @@ public:
     virtual ~Source() = default;
 
 private:
-    Source *mNext = nullptr;
+    Source  *mNext   = nullptr;
+    uint16_t mNumFds = 0;
+    bool     mReady  = false;
 };
 
 /**
@@ -82,6 +90,17 @@ private:
 class Manager
 {
 public:
+    /**
+     * Events to wait for on a file descriptor.
+     *
+     */
+    enum : uint8_t
+    {
+        kEventRead  = 1 << 0, ///< Readable (reported in `mReadFdSet`).
+        kEventWrite = 1 << 1, ///< Writable (reported in `mWriteFdSet`).
+        kEventError = 1 << 2, ///< Exceptional condition (reported in `mErrorFdSet`).
+    };
+
     /**
      * This method updates event polls in the mainloop context.
      *
@@ -98,6 +117,29 @@ public:
      */
     void Process(const otSysMainloopContext &aContext);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    /**
+     * This method waits for the events in the mainloop context.
+     *
+     * The registered file descriptors of the sources are kept in an epoll instance and only the epoll file descriptor
+     * is waited for together with the file descriptors that callers still put in the context fd sets. On return, the
+     * fd sets contain the ready file descriptors, both from the context and from `epoll_wait()`, and only the sources
+     * owning a ready file descriptor are processed by `Process()`.
+     *
+     * @param[in,out]   aContext    A reference to the mainloop context.
+     *
+     * @returns The number of ready file descriptors, 0 on timeout, or -1 on failure with `errno` set.
+     *
+     */
+    int Poll(otSysMainloopContext &aContext);
+
+    /**
+     * This destructor closes the epoll instance.
+     *
+     */
+    ~Manager(void);
+#endif
+
     /**
      * This method adds a new event source into the mainloop.
      *
@@ -109,11 +151,33 @@ public:
     /**
      * This method removes an event source from the mainloop.
      *
+     * Any file descriptor still registered by @p aSource is also removed.
+     *
      * @param[in]   aSource     A reference to the event source.
      *
      */
     void Remove(Source &aSource);
 
+    /**
+     * This method registers a file descriptor of an event source.
+     *
+     * @param[in]   aSource     A reference to the event source owning @p aFd.
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aEvents     The events to wait for (a combination of `kEventRead`, `kEventWrite`, `kEventError`).
+     *
+     */
+    void AddFd(Source &aSource, int aFd, uint8_t aEvents);
+
+    /**
+     * This method unregisters a file descriptor.
+     *
+     * This method MUST be called before @p aFd is closed. It does nothing if @p aFd is not registered.
+     *
+     * @param[in]   aFd         The file descriptor.
+     *
+     */
+    void RemoveFd(int aFd);
+
     /**
      * This function returns the Mainloop singleton.
      *
@@ -123,7 +187,21 @@ public:
     static Manager &Get(void);
 
 private:
-    Source *mSources = nullptr;
+    struct FdEntry
+    {
+        Source *mSource;
+        uint8_t mEvents;
+    };
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    static constexpr int kMaxEpollEvents = 64;
+
+    int mEpollFd = -1;
+#endif
+
+    FdEntry mFds[FD_SETSIZE] = {};
+    int     mMaxFd           = -1;
+    Source *mSources         = nullptr;
 };
 
 } // namespace Mainloop
@@ -76,6 +76,11 @@ void MulticastRoutingManager::SetUp(void)
     otBackboneRouterSetMulticastListenerCallback(gInstance,
                                                  &MulticastRoutingManager::HandleBackboneMulticastListenerEvent, this);
     Mainloop::Manager::Get().Add(*this);
+
+    if (IsEnabled())
+    {
+        Mainloop::Manager::Get().AddFd(*this, mMulticastRouterSock, Mainloop::Manager::kEventRead);
+    }
 }
 
 void MulticastRoutingManager::TearDown(void)
@@ -187,10 +192,13 @@ exit:
 
 void MulticastRoutingManager::Update(otSysMainloopContext &aContext)
 {
+    OT_UNUSED_VARIABLE(aContext);
+
+    // Expiring is done here rather than in `Process()`, which is only
+    // called when the socket is readable.
     VerifyOrExit(IsEnabled());
 
-    FD_SET(mMulticastRouterSock, &aContext.mReadFdSet);
-    aContext.mMaxFd = OT_MAX(aContext.mMaxFd, mMulticastRouterSock);
+    ExpireMulticastForwardingCache();
 
 exit:
     return;
@@ -200,8 +208,6 @@ void MulticastRoutingManager::Process(const otSysMainloopContext &aContext)
 {
     VerifyOrExit(IsEnabled());
 
-    ExpireMulticastForwardingCache();
-
     if (FD_ISSET(mMulticastRouterSock, &aContext.mReadFdSet))
     {
         ProcessMulticastRouterMessages();
@@ -220,6 +226,7 @@ void MulticastRoutingManager::InitMulticastRouterSock(void)
     // Create a Multicast Routing socket
     mMulticastRouterSock = SocketWithCloseExec(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6, kSocketBlock);
     VerifyOrDie(mMulticastRouterSock != -1, OT_EXIT_ERROR_ERRNO);
+    Mainloop::Manager::Get().AddFd(*this, mMulticastRouterSock, Mainloop::Manager::kEventRead);
 
     // Enable Multicast Forwarding in Kernel
     VerifyOrDie(0 == setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_INIT, &one, sizeof(one)), OT_EXIT_ERROR_ERRNO);
@@ -253,6 +260,7 @@ void MulticastRoutingManager::FinalizeMulticastRouterSock(void)
 {
     VerifyOrExit(IsEnabled());
 
+    Mainloop::Manager::Get().RemoveFd(mMulticastRouterSock);
     close(mMulticastRouterSock);
     mMulticastRouterSock = -1;
 
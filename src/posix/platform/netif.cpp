@@ -159,6 +159,12 @@ const char *otSysGetThreadNetifName(void) { return gNetifName; }
 
 unsigned int otSysGetThreadNetifIndex(void) { return gNetifIndex; }
 
+static otSysNetifCounters sNetifCounters;
+
+const otSysNetifCounters *otSysGetThreadNetifCounters(void) { return &sNetifCounters; }
+
+void otSysResetThreadNetifCounters(void) { memset(&sNetifCounters, 0, sizeof(sNetifCounters)); }
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 #if OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
 #include "firewall.hpp"
@@ -273,7 +279,10 @@ enum
 };
 #endif
 
-static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr size_t   kMaxIp6Size   = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr uint16_t kTunBatchSize = OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE;
+
+static_assert(kTunBatchSize >= 1, "OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE must be at least 1");
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -965,23 +974,29 @@ static void processReceive(otMessage *aMessage, void *aContext)
 #endif
 
     VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    sNetifCounters.mRxPackets++;
 
 exit:
     otMessageFree(aMessage);
 
     if (error != OT_ERROR_NONE)
     {
+        sNetifCounters.mRxDrops++;
         otLogWarnPlat("[netif] Failed to receive, error:%s", otThreadErrorToString(error));
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+static bool processTransmit(otInstance *aInstance)
 {
+    // Reads and sends a single packet from the TUN device. Returns
+    // whether the caller may continue with the next pending packet.
+
     otMessage *message = nullptr;
     ssize_t    rval;
     char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    otError    error          = OT_ERROR_NONE;
+    size_t     offset         = 0;
+    bool       shouldContinue = false;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     bool isIp4 = false;
 #endif
@@ -989,8 +1004,12 @@ static void processTransmit(otInstance *aInstance)
     assert(gInstance == aInstance);
 
     rval = read(sTunFd, packet, sizeof(packet));
+    VerifyOrExit((rval >= 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK)));
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
+    sNetifCounters.mTxPackets++;
+    shouldContinue = true;
+
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
     if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
@@ -1036,6 +1055,18 @@ exit:
 
     if (error != OT_ERROR_NONE)
     {
+        if (rval > 0)
+        {
+            sNetifCounters.mTxDrops++;
+        }
+
+        if (error == OT_ERROR_NO_BUFS)
+        {
+            // Leave the remaining packets queued in the TUN device
+            // until message buffers are freed.
+            shouldContinue = false;
+        }
+
         if (error == OT_ERROR_DROP)
         {
             otLogInfoPlat("[netif] Message dropped by Thread");
@@ -1045,6 +1076,39 @@ exit:
             otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
         }
     }
+
+    return shouldContinue;
+}
+
+static void processTransmitBatch(otInstance *aInstance)
+{
+    // Drains up to `kTunBatchSize` packets from the TUN device per
+    // mainloop iteration, so that a burst of packets from the host
+    // does not cost a full mainloop iteration per packet.
+
+    uint64_t txPackets = sNetifCounters.mTxPackets;
+    uint32_t batchSize;
+
+    for (uint16_t count = 0; count < kTunBatchSize; count++)
+    {
+        if (!processTransmit(aInstance))
+        {
+            break;
+        }
+    }
+
+    batchSize = static_cast<uint32_t>(sNetifCounters.mTxPackets - txPackets);
+    VerifyOrExit(batchSize > 0);
+
+    sNetifCounters.mTxBatches++;
+
+    if (batchSize > sNetifCounters.mTxMaxBatchSize)
+    {
+        sNetifCounters.mTxMaxBatchSize = batchSize;
+    }
+
+exit:
+    return;
 }
 
 static void logAddrEvent(bool isAdd, const ot::Ip6::Address &aAddress, otError error)
@@ -1950,7 +2014,7 @@ void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, c
 
     if (FD_ISSET(sTunFd, aReadFdSet))
     {
-        processTransmit(gInstance);
+        processTransmitBatch(gInstance);
     }
 
     if (FD_ISSET(sNetlinkFd, aReadFdSet))
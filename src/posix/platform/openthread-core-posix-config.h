@@ -319,4 +319,101 @@
 #define OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+ *
+ * Define to 1 to keep AES contexts with the MAC keys already set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_AES_KEY_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+ *
+ * Define to 1 to maintain a hash index over the EID-to-RLOC cache entries.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+ *
+ * Define to 1 to keep a per-child queue of the indirect messages for sleepy children.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define to 1 to index the child table by RLOC16, extended address and registered IPv6 addresses.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+ *
+ * Define to 1 to let the NAT64 translator share the IPv4 addresses between IPv6 hosts by translating ports.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+#define OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+ *
+ * Define to 1 to index the SRP server hosts and services by name.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+ *
+ * Define to 1 to keep the SRP server hosts and services in lease expiration order.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_LEASE_QUEUE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+ *
+ * Define to 1 to compile the Leader Network Data into a forwarding table used by route lookups.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+ *
+ * Define to 1 to compile the 6LoWPAN contexts in the Leader Network Data into a table used by context lookups.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE 1
+#endif
+
+// The SRP server signature verification threads use mbedTLS, which allocates from the heap, so they need the
+// thread-safe libc heap rather than the internal one (build with `OT_EXTERNAL_HEAP=ON`).
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME && \
+    !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+#error "OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE requires OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE"
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
@@ -294,6 +294,42 @@
 #define OPENTHREAD_POSIX_CONFIG_TREL_UDP_PORT 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+ *
+ * Define as 1 to store the settings file as an append-only log, so that each settings update appends a record
+ * instead of rewriting the whole file. Values are limited to 32764 bytes in this mode.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD
+ *
+ * The number of stale bytes in the settings log which triggers its compaction.
+ *
+ * Applicable only if `OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD 4096
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to keep the file descriptors of the mainloop sources registered in a persistent epoll instance, and to
+ * only process the sources which have a ready file descriptor.
+ *
+ * This is only supported on Linux and cannot be used together with virtual time.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_NAT64_CIDR
  *
@@ -358,4 +394,45 @@
 #define OPENTHREAD_POSIX_CONFIG_PRODUCT_CONFIG_FILE "src/posix/platform/openthread.conf.example"
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE
+ *
+ * The maximum number of packets read from the Thread network interface (TUN device) per mainloop iteration.
+ *
+ * Reading is stopped earlier when no packet is pending or when the OpenThread message buffers are exhausted. Setting
+ * it to 1 reads a single packet per mainloop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+ *
+ * Define as 1 to verify the ECDSA signatures of SRP updates on worker threads.
+ *
+ * When not enabled, the SRP server verifies the signatures synchronously. Virtual time is not supported as the results
+ * are reported from the mainloop.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE                                                  \
+    (OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE && \
+     !OPENTHREAD_POSIX_VIRTUAL_TIME)
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_THREAD_NUM
+ *
+ * The number of threads verifying the ECDSA signatures of SRP updates.
+ *
+ * Applicable only when `OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE` is enabled. The number of verifications
+ * queued at the same time is limited by `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_MAX_IN_FLIGHT`.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_THREAD_NUM
+#define OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_THREAD_NUM 1
+#endif
+
 #endif // OPENTHREAD_PLATFORM_CONFIG_H_
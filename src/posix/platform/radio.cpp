@@ -112,6 +112,10 @@ void Radio::Init(void)
     }
 #endif
 
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE && (OPENTHREAD_POSIX_CONFIG_RCP_BUS == OT_POSIX_RCP_BUS_UART)
+    sRadioSpinel.GetSpinelInterface().SetLatencyStats(&sRadioSpinel.GetLatencyStats());
+#endif
+
     SuccessOrDie(sRadioSpinel.GetSpinelInterface().Init(mRadioUrl));
     sRadioSpinel.Init(resetRadio, restoreDataset, skipCompatibilityCheck);
 
@@ -778,3 +782,19 @@ const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void)
 {
     return sRadioSpinel.GetSpinelInterface().GetRcpInterfaceMetrics();
 }
+
+const otRadioSpinelLatencyStats *otSysGetRadioSpinelLatencyStats(void)
+{
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    return &sRadioSpinel.GetLatencyStats();
+#else
+    return nullptr;
+#endif
+}
+
+void otSysResetRadioSpinelLatencyStats(void)
+{
+#if OPENTHREAD_SPINEL_CONFIG_LATENCY_STATS_ENABLE
+    sRadioSpinel.GetLatencyStats().Clear();
+#endif
+}
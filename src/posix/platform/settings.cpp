@@ -40,8 +40,10 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <openthread/logging.h>
@@ -53,6 +55,7 @@
 #endif
 
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/encoding.hpp"
 #include "posix/platform/settings.hpp"
 
@@ -106,6 +109,7 @@ static int swapOpen(otInstance *aInstance)
     return fd;
 }
 
+#if !OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
 /**
  * This function reads @p aLength bytes from the data file and appends to the swap file.
  *
@@ -133,6 +137,7 @@ static void swapWrite(otInstance *aInstance, int aFd, uint16_t aLength)
         aLength -= count;
     }
 }
+#endif
 
 static void swapPersist(otInstance *aInstance, int aFd)
 {
@@ -149,6 +154,7 @@ static void swapPersist(otInstance *aInstance, int aFd)
     sSettingsFd = aFd;
 }
 
+#if !OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
 static void swapDiscard(otInstance *aInstance, int aFd)
 {
     char swapFileName[kMaxFileNameSize];
@@ -157,6 +163,383 @@ static void swapDiscard(otInstance *aInstance, int aFd)
     getSettingsFileName(aInstance, swapFileName, true);
     VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
 }
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+/*
+ * In log mode the settings file is an append-only log of records, each made of a `uint16_t` key, a `uint16_t` length
+ * and the value. A record whose length has `kLogOpFlag` set carries an operation (`LogOp`) on its key instead of a
+ * value: the index it applies to, followed (for `kLogOpSet`) by the new value. Every key remains usable since the
+ * operation is marked in the length, which limits values to `kLogMaxValueLength` bytes. A compacted log only contains
+ * plain records.
+ *
+ * Every record written in log mode has `kLogCrcFlag` set in its length and is followed by a CRC16 over its header and
+ * its value, so that a torn write which leaves a valid header but a partial value is detected on replay. A file written
+ * in non-log mode (records without CRC) is accepted as the start of a log.
+ *
+ * The live records are tracked in a RAM index in the order they would be found in a compacted file. When the bytes no
+ * longer referenced by the index cross `OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD`, the live records are
+ * written to the swap file which then replaces the log.
+ */
+
+static const uint16_t kRecordHdrSize = sizeof(uint16_t) + sizeof(uint16_t);
+static const uint16_t kLogOpFlag     = 0x8000;
+static const uint16_t kLogCrcFlag    = 0x4000;
+static const uint16_t kLogFlags      = kLogOpFlag | kLogCrcFlag;
+static const uint16_t kLogCrcSize    = sizeof(uint16_t);
+
+enum LogOp : uint8_t
+{
+    kLogOpDelete = 0,
+    kLogOpSet    = 1,
+};
+
+OT_TOOL_PACKED_BEGIN
+struct LogOpHeader
+{
+    uint8_t mOp;
+    int16_t mIndex;
+} OT_TOOL_PACKED_END;
+
+static const uint16_t kLogMaxValueLength = kLogCrcFlag - 1 - sizeof(LogOpHeader);
+
+struct LogRecord
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    off_t    mValueOffset;
+};
+
+static LogRecord *sLogRecords         = nullptr;
+static size_t     sLogRecordsCount    = 0;
+static size_t     sLogRecordsCapacity = 0;
+static off_t      sLogLiveSize        = 0;
+static off_t      sLogFileSize        = 0;
+
+static void logIndexClear(void)
+{
+    free(sLogRecords);
+    sLogRecords         = nullptr;
+    sLogRecordsCount    = 0;
+    sLogRecordsCapacity = 0;
+    sLogLiveSize        = 0;
+}
+
+static void logIndexAppend(uint16_t aKey, uint16_t aLength, off_t aValueOffset)
+{
+    if (sLogRecordsCount == sLogRecordsCapacity)
+    {
+        size_t     capacity = (sLogRecordsCapacity == 0) ? 16 : sLogRecordsCapacity * 2;
+        LogRecord *records  = static_cast<LogRecord *>(realloc(sLogRecords, capacity * sizeof(LogRecord)));
+
+        VerifyOrDie(records != nullptr, OT_EXIT_FAILURE);
+        sLogRecords         = records;
+        sLogRecordsCapacity = capacity;
+    }
+
+    sLogRecords[sLogRecordsCount].mKey         = aKey;
+    sLogRecords[sLogRecordsCount].mLength      = aLength;
+    sLogRecords[sLogRecordsCount].mValueOffset = aValueOffset;
+    sLogRecordsCount++;
+
+    sLogLiveSize += kRecordHdrSize + aLength + kLogCrcSize;
+}
+
+static LogRecord *logIndexFind(uint16_t aKey, int aIndex)
+{
+    LogRecord *record = nullptr;
+
+    for (size_t i = 0; i < sLogRecordsCount; i++)
+    {
+        if (sLogRecords[i].mKey == aKey && aIndex-- == 0)
+        {
+            record = &sLogRecords[i];
+            break;
+        }
+    }
+
+    return record;
+}
+
+/**
+ * This function removes the record(s) with the given key and index from the RAM index.
+ *
+ * @param[in]  aKey    The key of the record(s).
+ * @param[in]  aIndex  The index of the record to remove, or -1 to remove all records with @p aKey.
+ *
+ * @retval OT_ERROR_NONE       At least one record was removed.
+ * @retval OT_ERROR_NOT_FOUND  No matching record was found.
+ *
+ */
+static otError logIndexRemove(uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+    size_t  count = 0;
+    int     index = 0;
+
+    for (size_t i = 0; i < sLogRecordsCount; i++)
+    {
+        LogRecord &record = sLogRecords[i];
+
+        if (record.mKey == aKey && (aIndex == -1 || aIndex == index++))
+        {
+            sLogLiveSize -= kRecordHdrSize + record.mLength + kLogCrcSize;
+            error = OT_ERROR_NONE;
+            continue;
+        }
+
+        sLogRecords[count++] = record;
+    }
+
+    sLogRecordsCount = count;
+
+    return error;
+}
+
+static void logCrcUpdate(ot::Crc16 &aCrc, const void *aData, size_t aLength)
+{
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aCrc.Update(static_cast<const uint8_t *>(aData)[i]);
+    }
+}
+
+/**
+ * This function feeds bytes of the settings file into a CRC computation.
+ *
+ * @retval TRUE   Successfully read the bytes.
+ * @retval FALSE  The bytes could not be read.
+ *
+ */
+static bool logCrcUpdateFromFile(ot::Crc16 &aCrc, off_t aOffset, uint16_t aLength)
+{
+    bool    success = false;
+    uint8_t buffer[512];
+
+    while (aLength > 0)
+    {
+        uint16_t count = (aLength >= sizeof(buffer)) ? sizeof(buffer) : aLength;
+
+        VerifyOrExit(pread(sSettingsFd, buffer, count, aOffset) == count);
+        logCrcUpdate(aCrc, buffer, count);
+        aOffset += count;
+        aLength -= count;
+    }
+
+    success = true;
+
+exit:
+    return success;
+}
+
+/**
+ * This function appends a record to the end of the log and flushes it to the storage.
+ *
+ * @returns The offset of @p aValue in the settings file.
+ *
+ */
+static off_t logAppend(uint16_t aKey, const LogOpHeader *aOpHeader, const uint8_t *aValue, uint16_t aValueLength)
+{
+    uint16_t     length   = kLogCrcFlag | aValueLength;
+    int          iovCount = 0;
+    size_t       total    = 0;
+    struct iovec iov[5];
+    off_t        valueOffset;
+    ot::Crc16    crc(ot::Crc16::kCcitt);
+    uint16_t     crcValue;
+
+    if (aOpHeader != nullptr)
+    {
+        length = static_cast<uint16_t>(kLogFlags | (aValueLength + sizeof(LogOpHeader)));
+    }
+
+    iov[iovCount].iov_base  = &aKey;
+    iov[iovCount++].iov_len = sizeof(aKey);
+    iov[iovCount].iov_base  = &length;
+    iov[iovCount++].iov_len = sizeof(length);
+
+    if (aOpHeader != nullptr)
+    {
+        iov[iovCount].iov_base  = const_cast<LogOpHeader *>(aOpHeader);
+        iov[iovCount++].iov_len = sizeof(LogOpHeader);
+    }
+
+    valueOffset = sLogFileSize + kRecordHdrSize + static_cast<off_t>((aOpHeader != nullptr) ? sizeof(LogOpHeader) : 0);
+
+    if (aValueLength > 0)
+    {
+        iov[iovCount].iov_base  = const_cast<uint8_t *>(aValue);
+        iov[iovCount++].iov_len = aValueLength;
+    }
+
+    for (int i = 0; i < iovCount; i++)
+    {
+        logCrcUpdate(crc, iov[i].iov_base, iov[i].iov_len);
+        total += iov[i].iov_len;
+    }
+
+    crcValue                = crc.Get();
+    iov[iovCount].iov_base  = &crcValue;
+    iov[iovCount++].iov_len = sizeof(crcValue);
+    total += sizeof(crcValue);
+
+    VerifyOrDie(lseek(sSettingsFd, sLogFileSize, SEEK_SET) == sLogFileSize, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(writev(sSettingsFd, iov, iovCount) == static_cast<ssize_t>(total), OT_EXIT_FAILURE);
+    VerifyOrDie(fsync(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+
+    sLogFileSize += static_cast<off_t>(total);
+
+    return valueOffset;
+}
+
+static void logCompact(otInstance *aInstance)
+{
+    int   swapFd = swapOpen(aInstance);
+    off_t offset = 0;
+
+    for (size_t i = 0; i < sLogRecordsCount; i++)
+    {
+        LogRecord &record     = sLogRecords[i];
+        uint16_t   remaining  = record.mLength;
+        uint16_t   length     = kLogCrcFlag | record.mLength;
+        off_t      readOffset = record.mValueOffset;
+        uint8_t    buffer[512];
+        ot::Crc16  crc(ot::Crc16::kCcitt);
+        uint16_t   crcValue;
+
+        logCrcUpdate(crc, &record.mKey, sizeof(record.mKey));
+        logCrcUpdate(crc, &length, sizeof(length));
+
+        VerifyOrDie(write(swapFd, &record.mKey, sizeof(record.mKey)) == sizeof(record.mKey) &&
+                        write(swapFd, &length, sizeof(length)) == sizeof(length),
+                    OT_EXIT_FAILURE);
+
+        while (remaining > 0)
+        {
+            uint16_t count = (remaining >= sizeof(buffer)) ? sizeof(buffer) : remaining;
+
+            VerifyOrDie(pread(sSettingsFd, buffer, count, readOffset) == count, OT_EXIT_FAILURE);
+            VerifyOrDie(write(swapFd, buffer, count) == count, OT_EXIT_FAILURE);
+            logCrcUpdate(crc, buffer, count);
+            readOffset += count;
+            remaining -= count;
+        }
+
+        crcValue = crc.Get();
+        VerifyOrDie(write(swapFd, &crcValue, sizeof(crcValue)) == sizeof(crcValue), OT_EXIT_FAILURE);
+
+        record.mValueOffset = offset + kRecordHdrSize;
+        offset += kRecordHdrSize + record.mLength + kLogCrcSize;
+    }
+
+    swapPersist(aInstance, swapFd);
+    sLogFileSize = offset;
+}
+
+static void logCompactIfNeeded(otInstance *aInstance)
+{
+    if (sLogFileSize - sLogLiveSize >= OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD)
+    {
+        logCompact(aInstance);
+    }
+}
+
+/**
+ * This function replays the log to build the RAM index.
+ *
+ * A record which is not complete (e.g., the process was killed while appending it), whose CRC does not match or which
+ * is not valid ends the log, and the file is truncated there so that following appends start from a valid record
+ * boundary. Records without CRC are only accepted before the first record with CRC, i.e., from a file written in
+ * non-log mode.
+ *
+ */
+static void logLoad(otInstance *aInstance)
+{
+    const off_t size    = lseek(sSettingsFd, 0, SEEK_END);
+    off_t       offset  = 0;
+    bool        hasCrcs = false;
+
+    VerifyOrDie(size >= 0, OT_EXIT_ERROR_ERRNO);
+
+    logIndexClear();
+
+    while (offset < size)
+    {
+        uint16_t    key;
+        uint16_t    length;
+        bool        isOp;
+        bool        hasCrc;
+        off_t       recordSize;
+        LogOpHeader opHeader;
+
+        VerifyOrExit(size - offset >= kRecordHdrSize);
+        VerifyOrExit(pread(sSettingsFd, &key, sizeof(key), offset) == sizeof(key));
+        VerifyOrExit(pread(sSettingsFd, &length, sizeof(length), offset + sizeof(key)) == sizeof(length));
+
+        isOp   = (length & kLogOpFlag) != 0;
+        hasCrc = (length & kLogCrcFlag) != 0;
+        length &= static_cast<uint16_t>(~kLogFlags);
+
+        VerifyOrExit(hasCrc || (!hasCrcs && !isOp));
+        hasCrcs |= hasCrc;
+
+        recordSize = kRecordHdrSize + length + (hasCrc ? kLogCrcSize : 0);
+        VerifyOrExit(size - offset >= recordSize);
+
+        if (hasCrc)
+        {
+            ot::Crc16 crc(ot::Crc16::kCcitt);
+            uint16_t  crcValue;
+
+            VerifyOrExit(logCrcUpdateFromFile(crc, offset, kRecordHdrSize + length));
+            VerifyOrExit(pread(sSettingsFd, &crcValue, sizeof(crcValue), offset + kRecordHdrSize + length) ==
+                         sizeof(crcValue));
+            VerifyOrExit(crcValue == crc.Get());
+        }
+
+        if (!isOp)
+        {
+            logIndexAppend(key, length, offset + kRecordHdrSize);
+        }
+        else
+        {
+            VerifyOrExit(length >= sizeof(LogOpHeader));
+            VerifyOrExit(pread(sSettingsFd, &opHeader, sizeof(opHeader), offset + kRecordHdrSize) ==
+                         sizeof(opHeader));
+
+            switch (opHeader.mOp)
+            {
+            case kLogOpDelete:
+                VerifyOrExit(length == sizeof(LogOpHeader));
+                IgnoreError(logIndexRemove(key, opHeader.mIndex));
+                break;
+
+            case kLogOpSet:
+                IgnoreError(logIndexRemove(key, -1));
+                logIndexAppend(key, length - sizeof(LogOpHeader),
+                               offset + kRecordHdrSize + static_cast<off_t>(sizeof(LogOpHeader)));
+                break;
+
+            default:
+                ExitNow();
+            }
+        }
+
+        offset += recordSize;
+    }
+
+exit:
+    if (offset < size)
+    {
+        otLogWarnPlat("Settings log is truncated at offset %ld of %ld", static_cast<long>(offset),
+                      static_cast<long>(size));
+        VerifyOrDie(ftruncate(sSettingsFd, offset) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    sLogFileSize = offset;
+    logCompactIfNeeded(aInstance);
+}
+#endif // OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
 
 void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, uint16_t aSensitiveKeysLength)
 {
@@ -193,6 +576,9 @@ void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, u
 
     VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    logLoad(aInstance);
+#else
     for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
     {
         uint16_t key;
@@ -208,6 +594,7 @@ void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, u
         offset += sizeof(key) + sizeof(length) + length;
         VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
     }
+#endif
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     otPosixSecureSettingsInit(aInstance);
@@ -233,6 +620,10 @@ void otPlatSettingsDeinit(otInstance *aInstance)
     VerifyOrExit(sSettingsFd != -1);
     VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
 
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    logIndexClear();
+#endif
+
 exit:
     return;
 }
@@ -324,11 +715,94 @@ void otPlatSettingsWipe(otInstance *aInstance)
 #endif
 
     VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    logIndexClear();
+    sLogFileSize = 0;
+#endif
 }
 
 namespace ot {
 namespace Posix {
 
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+
+otError PlatformSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError          error  = OT_ERROR_NONE;
+    const LogRecord *record = logIndexFind(aKey, aIndex);
+
+    VerifyOrExit(record != nullptr, error = OT_ERROR_NOT_FOUND);
+
+    if (aValueLength)
+    {
+        if (aValue)
+        {
+            uint16_t readLength = (record->mLength <= *aValueLength ? record->mLength : *aValueLength);
+
+            VerifyOrExit(pread(sSettingsFd, aValue, readLength, record->mValueOffset) == readLength,
+                         error = OT_ERROR_PARSE);
+        }
+
+        *aValueLength = record->mLength;
+    }
+
+exit:
+    return error;
+}
+
+void PlatformSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    LogOpHeader opHeader;
+    off_t       valueOffset;
+
+    VerifyOrDie(aValueLength <= kLogMaxValueLength, OT_EXIT_INVALID_ARGUMENTS);
+
+    opHeader.mOp    = kLogOpSet;
+    opHeader.mIndex = -1;
+
+    valueOffset = logAppend(aKey, &opHeader, aValue, aValueLength);
+
+    IgnoreError(logIndexRemove(aKey, -1));
+    logIndexAppend(aKey, aValueLength, valueOffset);
+    logCompactIfNeeded(aInstance);
+}
+
+void PlatformSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    VerifyOrDie(aValueLength <= kLogMaxValueLength, OT_EXIT_INVALID_ARGUMENTS);
+    logIndexAppend(aKey, aValueLength, logAppend(aKey, nullptr, aValue, aValueLength));
+}
+
+otError PlatformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
+{
+    OT_UNUSED_VARIABLE(aSwapFd);
+
+    otError     error = OT_ERROR_NONE;
+    LogOpHeader opHeader;
+
+    // The deletion is appended to the log, no swap file is used.
+
+    VerifyOrExit(logIndexFind(aKey, (aIndex == -1) ? 0 : aIndex) != nullptr, error = OT_ERROR_NOT_FOUND);
+
+    opHeader.mOp    = kLogOpDelete;
+    opHeader.mIndex = static_cast<int16_t>(aIndex);
+
+    IgnoreReturnValue(logAppend(aKey, &opHeader, nullptr, 0));
+
+    SuccessOrDie(logIndexRemove(aKey, aIndex));
+    logCompactIfNeeded(aInstance);
+
+exit:
+    return error;
+}
+
+#else // OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+
 otError PlatformSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -503,6 +977,8 @@ exit:
     return error;
 }
 
+#endif // OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 void PlatformSettingsGetSensitiveKeys(otInstance *aInstance, const uint16_t **aKeys, uint16_t *aKeysLength)
 {
@@ -527,6 +1003,8 @@ void PlatformSettingsGetSensitiveKeys(otInstance *aInstance, const uint16_t **aK
 
 void otLogCritPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
 
+void otLogWarnPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
 const char *otExitCodeToString(uint8_t aExitCode)
 {
     OT_UNUSED_VARIABLE(aExitCode);
@@ -678,6 +1156,218 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    // verify the log is replayed after reopening the settings
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 4) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 4);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 1, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify key 0xffff is stored and reloaded like any other key
+    assert(otPlatSettingsAdd(instance, 0xffff, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0xffff, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0xffff, 0) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 0xfffe, data, sizeof(data) / 4) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0xffff, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0xffff, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 0xfffe, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 4);
+    }
+    assert(otPlatSettingsSet(instance, 0xffff, data, sizeof(data) / 5) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0xffff, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 5);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0xffff, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        assert(otPlatSettingsGet(instance, 1, 0, nullptr, nullptr) == OT_ERROR_NONE);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the log is compacted once enough stale records accumulate
+    for (uint16_t i = 0; i < 2 * OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD / sizeof(data); i++)
+    {
+        data[0] = static_cast<uint8_t>(i);
+        assert(otPlatSettingsSet(instance, 2, data, sizeof(data)) == OT_ERROR_NONE);
+        assert(lseek(sSettingsFd, 0, SEEK_END) <=
+               static_cast<off_t>(OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD + 2 * sizeof(data)));
+    }
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 2, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 2, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    data[0] = 0;
+    otPlatSettingsWipe(instance);
+
+    // verify a record torn at any byte (e.g., the process is killed while writing it) is discarded on reload
+    {
+        enum
+        {
+            kOpAdd,
+            kOpSet,
+            kOpDelete,
+        };
+
+        uint8_t content[4 * sizeof(data)];
+
+        for (int op = kOpAdd; op <= kOpDelete; op++)
+        {
+            off_t oldSize;
+            off_t newSize;
+
+            otPlatSettingsWipe(instance);
+            assert(otPlatSettingsAdd(instance, 3, data, sizeof(data) / 2) == OT_ERROR_NONE);
+            oldSize = lseek(sSettingsFd, 0, SEEK_END);
+
+            switch (op)
+            {
+            case kOpAdd:
+                assert(otPlatSettingsAdd(instance, 3, data, sizeof(data)) == OT_ERROR_NONE);
+                break;
+            case kOpSet:
+                assert(otPlatSettingsSet(instance, 3, data, sizeof(data)) == OT_ERROR_NONE);
+                break;
+            case kOpDelete:
+                assert(otPlatSettingsDelete(instance, 3, 0) == OT_ERROR_NONE);
+                break;
+            }
+
+            newSize = lseek(sSettingsFd, 0, SEEK_END);
+            assert(newSize <= static_cast<off_t>(sizeof(content)));
+            assert(pread(sSettingsFd, content, static_cast<size_t>(newSize), 0) == newSize);
+
+            for (off_t size = newSize; size >= oldSize; size--)
+            {
+                uint8_t  value[sizeof(data)];
+                uint16_t length = sizeof(value);
+
+                assert(pwrite(sSettingsFd, content, static_cast<size_t>(size), 0) == size);
+                assert(ftruncate(sSettingsFd, size) == 0);
+                otPlatSettingsDeinit(instance);
+                otPlatSettingsInit(instance, nullptr, 0);
+
+                if (size == newSize)
+                {
+                    // The complete record is applied.
+                    if (op == kOpDelete)
+                    {
+                        assert(otPlatSettingsGet(instance, 3, 0, value, &length) == OT_ERROR_NOT_FOUND);
+                    }
+                    else
+                    {
+                        assert(otPlatSettingsGet(instance, 3, (op == kOpAdd) ? 1 : 0, value, &length) == OT_ERROR_NONE);
+                        assert(length == sizeof(data));
+                    }
+                }
+                else
+                {
+                    // The torn record is dropped and the previous state is kept.
+                    assert(lseek(sSettingsFd, 0, SEEK_END) == oldSize);
+                    assert(otPlatSettingsGet(instance, 3, 0, value, &length) == OT_ERROR_NONE);
+                    assert(length == sizeof(data) / 2);
+                    assert(otPlatSettingsGet(instance, 3, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+                }
+            }
+        }
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a record with a valid header but a corrupted value ends the log, along with the records after it
+    {
+        off_t    offset;
+        uint8_t  byte;
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsAdd(instance, 4, data, sizeof(data) / 2) == OT_ERROR_NONE);
+        offset = lseek(sSettingsFd, 0, SEEK_END);
+        assert(otPlatSettingsAdd(instance, 4, data, sizeof(data)) == OT_ERROR_NONE);
+        assert(otPlatSettingsAdd(instance, 5, data, sizeof(data) / 3) == OT_ERROR_NONE);
+
+        assert(pread(sSettingsFd, &byte, sizeof(byte), offset + kRecordHdrSize + 1) == sizeof(byte));
+        byte ^= 0xff;
+        assert(pwrite(sSettingsFd, &byte, sizeof(byte), offset + kRecordHdrSize + 1) == sizeof(byte));
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        assert(lseek(sSettingsFd, 0, SEEK_END) == offset);
+        assert(otPlatSettingsGet(instance, 4, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(otPlatSettingsGet(instance, 4, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        assert(otPlatSettingsGet(instance, 5, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a file written in non-log mode is replayed and appended to
+    {
+        uint16_t key    = 6;
+        uint16_t length = sizeof(data) / 2;
+        uint8_t  value[sizeof(data)];
+
+        assert(pwrite(sSettingsFd, &key, sizeof(key), 0) == sizeof(key));
+        assert(pwrite(sSettingsFd, &length, sizeof(length), sizeof(key)) == sizeof(length));
+        assert(pwrite(sSettingsFd, data, length, kRecordHdrSize) == length);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        assert(otPlatSettingsAdd(instance, 6, data, sizeof(data)) == OT_ERROR_NONE);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 6, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 6, 1, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+    }
+    otPlatSettingsWipe(instance);
+#endif // OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+
     otPlatSettingsDeinit(instance);
 
     return 0;
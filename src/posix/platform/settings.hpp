@@ -80,6 +80,8 @@ void PlatformSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aV
  * @note
  *   If @p aSwapFd is null, operate deleting on the setting file.
  *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
+ *   With `OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE` the deletion is always appended to the settings file and
+ *   @p aSwapFd is not used.
  *
  * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
  * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
@@ -50,6 +50,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "posix/platform/daemon.hpp"
+#include "posix/platform/ecdsa_verifier.hpp"
 #include "posix/platform/firewall.hpp"
 #include "posix/platform/infra_if.hpp"
 #include "posix/platform/mainloop.hpp"
@@ -197,6 +198,10 @@ void platformSetUp(void)
     ot::Posix::Daemon::Get().SetUp();
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+    ot::Posix::EcdsaVerifier::Get().SetUp();
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE || OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SuccessOrDie(otSetStateChangedCallback(gInstance, processStateChange, gInstance));
 #endif
@@ -224,6 +229,10 @@ void platformTearDown(void)
 {
     VerifyOrExit(!gDryRun);
 
+#if OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFIER_ENABLE
+    ot::Posix::EcdsaVerifier::Get().TearDown();
+#endif
+
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
     ot::Posix::Daemon::Get().TearDown();
 #endif
@@ -385,8 +394,12 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
     else
 #endif
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        rval = ot::Posix::Mainloop::Manager::Get().Poll(*aMainloop);
+#else
         rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                       &aMainloop->mTimeout);
+#endif
     }
 
     return rval;
@@ -231,6 +231,7 @@ otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
     VerifyOrExit(fd >= 0, error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = FdToHandle(fd);
+    ot::Posix::Mainloop::Manager::Get().AddFd(ot::Posix::Udp::Get(), fd, ot::Posix::Mainloop::Manager::kEventRead);
 
 exit:
     return error;
@@ -246,6 +247,7 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+    ot::Posix::Mainloop::Manager::Get().RemoveFd(fd);
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
@@ -534,32 +536,6 @@ exit:
 namespace ot {
 namespace Posix {
 
-void Udp::Update(otSysMainloopContext &aContext)
-{
-    VerifyOrExit(gNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd;
-
-        if (socket->mHandle == nullptr)
-        {
-            continue;
-        }
-
-        fd = FdFromHandle(socket->mHandle);
-        FD_SET(fd, &aContext.mReadFdSet);
-
-        if (aContext.mMaxFd < fd)
-        {
-            aContext.mMaxFd = fd;
-        }
-    }
-
-exit:
-    return;
-}
-
 void Udp::Init(const char *aIfName)
 {
     if (aIfName == nullptr)
@@ -579,7 +555,20 @@ void Udp::Init(const char *aIfName)
     assert(gNetifIndex != 0);
 }
 
-void Udp::SetUp(void) { Mainloop::Manager::Get().Add(*this); }
+void Udp::SetUp(void)
+{
+    Mainloop::Manager::Get().Add(*this);
+
+    // Register the sockets which are already open (e.g., after a
+    // pseudo reset, since `TearDown()` removes them).
+    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (socket->mHandle != nullptr)
+        {
+            Mainloop::Manager::Get().AddFd(*this, FdFromHandle(socket->mHandle), Mainloop::Manager::kEventRead);
+        }
+    }
+}
 
 void Udp::TearDown(void) { Mainloop::Manager::Get().Remove(*this); }
 
@@ -599,6 +588,10 @@ void Udp::Process(const otSysMainloopContext &aContext)
 {
     otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
 
+    // The socket file descriptors are registered when they are opened,
+    // but they are not processed before the Thread netif exists.
+    VerifyOrExit(gNetifIndex != 0);
+
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
     {
         int fd = FdFromHandle(socket->mHandle);
@@ -638,6 +631,7 @@ void Udp::Process(const otSysMainloopContext &aContext)
         }
     }
 
+exit:
     return;
 }
 
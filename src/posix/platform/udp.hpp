@@ -43,7 +43,6 @@ public:
     void SetUp(void);
     void TearDown(void);
     void Deinit(void);
-    void Update(otSysMainloopContext &aContext) override;
     void Process(const otSysMainloopContext &aContext) override;
 };
 
@@ -0,0 +1,1113 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements `ot-bench`, a set of deterministic micro-benchmarks for hot paths of the core and the
+ *   host-side libraries.
+ *
+ *   Every benchmark runs on fixed input data for a fixed number of iterations, so results are comparable between
+ *   commits on the same machine. The results are written to stdout as a single JSON object. An optional argument
+ *   restricts the run to the benchmarks whose name contains the given sub-string.
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/instance.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "lib/hdlc/hdlc.hpp"
+#include "lib/spinel/spinel_buffer.hpp"
+#include "lib/spinel/spinel_decoder.hpp"
+#include "lib/spinel/spinel_encoder.hpp"
+#include "mac/mac_frame.hpp"
+#include "net/checksum.hpp"
+#include "net/dns_types.hpp"
+#include "net/ip6_headers.hpp"
+#include "net/udp6.hpp"
+#include "thread/child_table.hpp"
+#include "thread/key_manager.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/network_data_leader.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+namespace Bench {
+
+static constexpr uint8_t  kWarmupRounds    = 1;    // Number of untimed rounds run before the measured ones.
+static constexpr uint8_t  kMeasuredRounds  = 5;    // Number of measured rounds (median and min are reported).
+static constexpr uint16_t kMessageLength   = 1024; // Length of the message used by `Message` and checksum benchmarks.
+static constexpr uint16_t kFramePayloadLen = 64;   // Payload length of MAC/6LoWPAN/AES-CCM/HDLC/Spinel frames.
+
+static Instance         *sInstance;
+static volatile uint32_t sSink; // Consumes benchmark results so that the compiler cannot drop the measured code.
+static uint8_t           sPayload[kMessageLength];
+static bool              sFirstResult = true;
+
+/**
+ * This class runs the timed rounds of a single benchmark and reports its result.
+ *
+ * Usage:
+ *
+ *     Runner runner(aName, iterations, bytesPerIteration);
+ *
+ *     // Untimed setup
+ *
+ *     while (runner.NextRound())
+ *     {
+ *         for (uint32_t i = 0; i < runner.GetIterations(); i++)
+ *         {
+ *             // Measured operation
+ *         }
+ *     }
+ *
+ */
+class Runner
+{
+public:
+    Runner(const char *aName, uint32_t aIterations, uint32_t aBytes)
+        : mName(aName)
+        , mIterations(aIterations)
+        , mBytes(aBytes)
+        , mRound(0)
+    {
+    }
+
+    uint32_t GetIterations(void) const { return mIterations; }
+
+    bool NextRound(void)
+    {
+        Clock::time_point now = Clock::now();
+
+        if (mRound > kWarmupRounds)
+        {
+            mElapsed[mRound - kWarmupRounds - 1] =
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - mStart).count());
+        }
+
+        if (mRound == kWarmupRounds + kMeasuredRounds)
+        {
+            Report();
+            return false;
+        }
+
+        mRound++;
+        mStart = Clock::now();
+
+        return true;
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    void Report(void)
+    {
+        double medianNs;
+        double minNs;
+
+        // Insertion sort, `kMeasuredRounds` is small.
+        for (uint8_t i = 1; i < kMeasuredRounds; i++)
+        {
+            uint64_t elapsed = mElapsed[i];
+            uint8_t  j       = i;
+
+            for (; (j > 0) && (mElapsed[j - 1] > elapsed); j--)
+            {
+                mElapsed[j] = mElapsed[j - 1];
+            }
+
+            mElapsed[j] = elapsed;
+        }
+
+        medianNs = static_cast<double>(mElapsed[kMeasuredRounds / 2]) / mIterations;
+        minNs    = static_cast<double>(mElapsed[0]) / mIterations;
+
+        printf("%s\n    {\"name\": \"%s\", \"iterations\": %lu, \"rounds\": %u, \"bytes_per_op\": %lu, "
+               "\"ns_per_op\": %.2f, \"min_ns_per_op\": %.2f, \"mb_per_s\": %.2f}",
+               sFirstResult ? "" : ",", mName, static_cast<unsigned long>(mIterations), kMeasuredRounds,
+               static_cast<unsigned long>(mBytes), medianNs, minNs, (mBytes == 0) ? 0.0 : (mBytes * 1000.0 / medianNs));
+
+        sFirstResult = false;
+    }
+
+    const char       *mName;
+    uint32_t          mIterations;
+    uint32_t          mBytes;
+    uint8_t           mRound;
+    Clock::time_point mStart;
+    uint64_t          mElapsed[kMeasuredRounds];
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// Message
+
+void BenchMessageAppend(const char *aName)
+{
+    Runner   runner(aName, 20000, kMessageLength);
+    Message *message;
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            SuccessOrQuit(message->SetLength(0));
+            SuccessOrQuit(message->AppendBytes(sPayload, kMessageLength));
+        }
+    }
+
+    message->Free();
+}
+
+void BenchMessageRead(const char *aName)
+{
+    Runner   runner(aName, 50000, kMessageLength);
+    Message *message;
+    uint8_t  buffer[kMessageLength];
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(sPayload, kMessageLength));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            sSink += message->ReadBytes(0, buffer, kMessageLength);
+            sSink += buffer[i % kMessageLength];
+        }
+    }
+
+    message->Free();
+}
+
+void BenchMessageClone(const char *aName)
+{
+    Runner   runner(aName, 20000, kMessageLength);
+    Message *message;
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(sPayload, kMessageLength));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            Message *clone = message->Clone();
+
+            VerifyOrQuit(clone != nullptr);
+            sSink += clone->GetLength();
+            clone->Free();
+        }
+    }
+
+    message->Free();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Lowpan
+
+static void PrepareIp6UdpMessage(Message &aMessage, const Mac::Addresses &aMacAddrs)
+{
+    Ip6::Header      ip6Header;
+    Ip6::Udp::Header udpHeader;
+
+    ip6Header.Clear();
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + kFramePayloadLen);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    ip6Header.GetSource().SetToLinkLocalAddress(aMacAddrs.mSource.GetExtended());
+    ip6Header.GetDestination().SetToLinkLocalAddress(aMacAddrs.mDestination.GetExtended());
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(19788);
+    udpHeader.SetDestinationPort(61631);
+    udpHeader.SetLength(sizeof(udpHeader) + kFramePayloadLen);
+    udpHeader.SetChecksum(0x1234);
+
+    SuccessOrQuit(aMessage.Append(ip6Header));
+    SuccessOrQuit(aMessage.Append(udpHeader));
+    SuccessOrQuit(aMessage.AppendBytes(sPayload, kFramePayloadLen));
+}
+
+static const uint8_t kSrcExtAddr[] = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0};
+static const uint8_t kDstExtAddr[] = {0x0f, 0xed, 0xcb, 0xa9, 0x87, 0x65, 0x43, 0x21};
+
+static void PrepareMacAddrs(Mac::Addresses &aMacAddrs)
+{
+    aMacAddrs.mSource.SetExtended(kSrcExtAddr);
+    aMacAddrs.mDestination.SetExtended(kDstExtAddr);
+}
+
+void BenchLowpanCompress(const char *aName)
+{
+    Runner          runner(aName, 50000, sizeof(Ip6::Header) + sizeof(Ip6::Udp::Header));
+    Lowpan::Lowpan &lowpan = sInstance->Get<Lowpan::Lowpan>();
+    Mac::Addresses  macAddrs;
+    Message        *message;
+    uint8_t         frame[OT_RADIO_FRAME_MAX_SIZE];
+
+    PrepareMacAddrs(macAddrs);
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    PrepareIp6UdpMessage(*message, macAddrs);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            FrameBuilder frameBuilder;
+
+            frameBuilder.Init(frame, sizeof(frame));
+            message->SetOffset(0);
+            SuccessOrQuit(lowpan.Compress(*message, macAddrs, frameBuilder));
+            sSink += frameBuilder.GetLength();
+        }
+    }
+
+    message->Free();
+}
+
+void BenchLowpanDecompress(const char *aName)
+{
+    Runner          runner(aName, 50000, sizeof(Ip6::Header) + sizeof(Ip6::Udp::Header));
+    Lowpan::Lowpan &lowpan = sInstance->Get<Lowpan::Lowpan>();
+    Mac::Addresses  macAddrs;
+    Message        *message;
+    FrameBuilder    frameBuilder;
+    uint8_t         frame[OT_RADIO_FRAME_MAX_SIZE];
+
+    PrepareMacAddrs(macAddrs);
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    PrepareIp6UdpMessage(*message, macAddrs);
+
+    frameBuilder.Init(frame, sizeof(frame));
+    SuccessOrQuit(lowpan.Compress(*message, macAddrs, frameBuilder));
+    SuccessOrQuit(frameBuilder.AppendBytes(sPayload, kFramePayloadLen));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            FrameData frameData;
+
+            frameData.Init(frameBuilder.GetBytes(), frameBuilder.GetLength());
+            SuccessOrQuit(message->SetLength(0));
+            message->SetOffset(0);
+            SuccessOrQuit(lowpan.Decompress(*message, macAddrs, frameData, 0));
+            sSink += message->GetLength();
+        }
+    }
+
+    message->Free();
+}
+
+// Network Data with four on-mesh prefixes, each with a Border Router and a 6LoWPAN Context sub-TLV. The global
+// benchmarks use addresses from the last two prefixes (Context IDs 3 and 4).
+static const uint8_t kContextNetworkData[] = {
+    0x03, 0x14, 0x00, 0x40, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x01, // Prefix 2001:db8:1:1::/64
+    0x05, 0x04, 0x5c, 0x00, 0x31, 0x00,                                     // Border Router sub-TLV
+    0x07, 0x02, 0x11, 0x40,                                                 // Context ID 1, C = TRUE
+    0x03, 0x14, 0x00, 0x40, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02, // Prefix 2001:db8:1:2::/64
+    0x05, 0x04, 0x6c, 0x00, 0x31, 0x00,                                     // Border Router sub-TLV
+    0x07, 0x02, 0x12, 0x40,                                                 // Context ID 2, C = TRUE
+    0x03, 0x14, 0x00, 0x40, 0xfd, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, // Prefix fd11:22:0:1::/64
+    0x05, 0x04, 0x5c, 0x00, 0x31, 0x00,                                     // Border Router sub-TLV
+    0x07, 0x02, 0x13, 0x40,                                                 // Context ID 3, C = TRUE
+    0x03, 0x14, 0x00, 0x40, 0xfd, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, // Prefix fd11:22:0:2::/64
+    0x05, 0x04, 0x6c, 0x00, 0x31, 0x00,                                     // Border Router sub-TLV
+    0x07, 0x02, 0x14, 0x40,                                                 // Context ID 4, C = TRUE
+};
+
+static void PrepareGlobalIp6UdpMessage(Message &aMessage, const Mac::Addresses &aMacAddrs)
+{
+    static const uint8_t kSrcPrefix[] = {0xfd, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01};
+    static const uint8_t kDstPrefix[] = {0xfd, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02};
+
+    Ip6::Header ip6Header;
+    Message    *netDataMessage;
+
+    VerifyOrQuit((netDataMessage = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(netDataMessage->AppendBytes(kContextNetworkData, sizeof(kContextNetworkData)));
+    SuccessOrQuit(sInstance->Get<NetworkData::Leader>().SetNetworkData(0, 0, NetworkData::kFullSet, *netDataMessage, 0,
+                                                                       sizeof(kContextNetworkData)));
+    netDataMessage->Free();
+
+    PrepareIp6UdpMessage(aMessage, aMacAddrs);
+    SuccessOrQuit(aMessage.Read(0, ip6Header));
+    ip6Header.GetSource().SetPrefix(kSrcPrefix, Ip6::NetworkPrefix::kLength);
+    ip6Header.GetDestination().SetPrefix(kDstPrefix, Ip6::NetworkPrefix::kLength);
+    aMessage.Write(0, ip6Header);
+}
+
+void BenchLowpanCompressGlobal(const char *aName)
+{
+    Runner          runner(aName, 50000, sizeof(Ip6::Header) + sizeof(Ip6::Udp::Header));
+    Lowpan::Lowpan &lowpan = sInstance->Get<Lowpan::Lowpan>();
+    Mac::Addresses  macAddrs;
+    Message        *message;
+    uint8_t         frame[OT_RADIO_FRAME_MAX_SIZE];
+
+    PrepareMacAddrs(macAddrs);
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    PrepareGlobalIp6UdpMessage(*message, macAddrs);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            FrameBuilder frameBuilder;
+
+            frameBuilder.Init(frame, sizeof(frame));
+            message->SetOffset(0);
+            SuccessOrQuit(lowpan.Compress(*message, macAddrs, frameBuilder));
+            sSink += frameBuilder.GetLength();
+        }
+    }
+
+    message->Free();
+    sInstance->Get<NetworkData::Leader>().Reset();
+}
+
+void BenchLowpanDecompressGlobal(const char *aName)
+{
+    Runner          runner(aName, 50000, sizeof(Ip6::Header) + sizeof(Ip6::Udp::Header));
+    Lowpan::Lowpan &lowpan = sInstance->Get<Lowpan::Lowpan>();
+    Mac::Addresses  macAddrs;
+    Message        *message;
+    FrameBuilder    frameBuilder;
+    uint8_t         frame[OT_RADIO_FRAME_MAX_SIZE];
+
+    PrepareMacAddrs(macAddrs);
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    PrepareGlobalIp6UdpMessage(*message, macAddrs);
+
+    frameBuilder.Init(frame, sizeof(frame));
+    SuccessOrQuit(lowpan.Compress(*message, macAddrs, frameBuilder));
+    SuccessOrQuit(frameBuilder.AppendBytes(sPayload, kFramePayloadLen));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            FrameData frameData;
+
+            frameData.Init(frameBuilder.GetBytes(), frameBuilder.GetLength());
+            SuccessOrQuit(message->SetLength(0));
+            message->SetOffset(0);
+            SuccessOrQuit(lowpan.Decompress(*message, macAddrs, frameData, 0));
+            sSink += message->GetLength();
+        }
+    }
+
+    message->Free();
+    sInstance->Get<NetworkData::Leader>().Reset();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Mac::Frame
+
+static constexpr uint16_t kMacFcf = Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 |
+                                    Mac::Frame::kFcfDstAddrShort | Mac::Frame::kFcfSrcAddrExt |
+                                    Mac::Frame::kFcfPanidCompression | Mac::Frame::kFcfSecurityEnabled |
+                                    Mac::Frame::kFcfAckRequest;
+static constexpr uint8_t kMacSecCtl = Mac::Frame::kSecEncMic32 | Mac::Frame::kKeyIdMode1;
+
+static void BuildMacFrame(Mac::TxFrame &aFrame, uint32_t aSequence)
+{
+    Mac::ExtAddress srcExtAddr;
+
+    srcExtAddr.Set(kSrcExtAddr);
+
+    aFrame.InitMacHeader(kMacFcf, kMacSecCtl);
+    aFrame.SetSequence(static_cast<uint8_t>(aSequence));
+    aFrame.SetDstPanId(0xface);
+    aFrame.SetDstAddr(static_cast<Mac::ShortAddress>(0x5c00));
+    aFrame.SetSrcAddr(srcExtAddr);
+    aFrame.SetFrameCounter(aSequence);
+    aFrame.SetKeyId(1);
+    aFrame.SetPayloadLength(kFramePayloadLen);
+    memcpy(aFrame.GetPayload(), sPayload, kFramePayloadLen);
+}
+
+void BenchMacFrameBuild(const char *aName)
+{
+    Runner       runner(aName, 100000, 0);
+    uint8_t      psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame frame;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu = psdu;
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            BuildMacFrame(frame, i);
+            sSink += frame.GetLength();
+        }
+    }
+}
+
+void BenchMacFrameParse(const char *aName)
+{
+    Runner       runner(aName, 100000, 0);
+    uint8_t      psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame txFrame;
+    Mac::RxFrame rxFrame;
+
+    memset(&txFrame, 0, sizeof(txFrame));
+    txFrame.mPsdu = psdu;
+    BuildMacFrame(txFrame, 0);
+
+    memset(&rxFrame, 0, sizeof(rxFrame));
+    rxFrame.mPsdu   = psdu;
+    rxFrame.mLength = txFrame.GetLength();
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            Mac::PanId   panId;
+            Mac::Address dstAddr;
+            Mac::Address srcAddr;
+            uint32_t     frameCounter;
+
+            SuccessOrQuit(rxFrame.ValidatePsdu());
+            SuccessOrQuit(rxFrame.GetDstPanId(panId));
+            SuccessOrQuit(rxFrame.GetDstAddr(dstAddr));
+            SuccessOrQuit(rxFrame.GetSrcAddr(srcAddr));
+            SuccessOrQuit(rxFrame.GetFrameCounter(frameCounter));
+            sSink += panId + frameCounter + rxFrame.GetPayloadLength() + rxFrame.GetPayload()[0];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AesCcm
+
+static constexpr uint8_t kAesCcmKey[] = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                                         0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf};
+static constexpr uint8_t kAesCcmNonce[] = {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00,
+                                           0x01, 0x00, 0x00, 0x00, 0x05, 0x02};
+static constexpr uint8_t kAesCcmHeaderLength = 21;
+static constexpr uint8_t kAesCcmTagLength    = 4;
+
+static void AesCcmProcess(Crypto::AesCcm &aAesCcm, uint8_t *aFrame, Crypto::AesCcm::Mode aMode)
+{
+    aAesCcm.Init(kAesCcmHeaderLength, kFramePayloadLen, kAesCcmTagLength, kAesCcmNonce, sizeof(kAesCcmNonce));
+    aAesCcm.Header(aFrame, kAesCcmHeaderLength);
+    aAesCcm.Payload(aFrame + kAesCcmHeaderLength, aFrame + kAesCcmHeaderLength, kFramePayloadLen, aMode);
+    aAesCcm.Finalize(aFrame + kAesCcmHeaderLength + kFramePayloadLen);
+}
+
+void BenchAesCcmEncrypt(const char *aName)
+{
+    Runner         runner(aName, 20000, kFramePayloadLen);
+    Crypto::AesCcm aesCcm;
+    uint8_t        frame[kAesCcmHeaderLength + kFramePayloadLen + kAesCcmTagLength];
+
+    memcpy(frame, sPayload, sizeof(frame));
+    aesCcm.SetKey(kAesCcmKey, sizeof(kAesCcmKey));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            AesCcmProcess(aesCcm, frame, Crypto::AesCcm::kEncrypt);
+        }
+    }
+
+    sSink += frame[sizeof(frame) - 1];
+}
+
+void BenchAesCcmDecrypt(const char *aName)
+{
+    Runner         runner(aName, 20000, kFramePayloadLen);
+    Crypto::AesCcm aesCcm;
+    uint8_t        encrypted[kAesCcmHeaderLength + kFramePayloadLen + kAesCcmTagLength];
+    uint8_t        frame[sizeof(encrypted)];
+    uint8_t        tag[kAesCcmTagLength];
+
+    memcpy(encrypted, sPayload, sizeof(encrypted));
+    aesCcm.SetKey(kAesCcmKey, sizeof(kAesCcmKey));
+    AesCcmProcess(aesCcm, encrypted, Crypto::AesCcm::kEncrypt);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            memcpy(frame, encrypted, sizeof(frame));
+            aesCcm.Init(kAesCcmHeaderLength, kFramePayloadLen, kAesCcmTagLength, kAesCcmNonce, sizeof(kAesCcmNonce));
+            aesCcm.Header(frame, kAesCcmHeaderLength);
+            aesCcm.Payload(frame + kAesCcmHeaderLength, frame + kAesCcmHeaderLength, kFramePayloadLen,
+                           Crypto::AesCcm::kDecrypt);
+            aesCcm.Finalize(tag);
+            VerifyOrQuit(memcmp(tag, &encrypted[kAesCcmHeaderLength + kFramePayloadLen], sizeof(tag)) == 0);
+        }
+    }
+}
+
+static void MacFrameEncrypt(const char *aName, bool aUseKeyedEcb)
+{
+    // Secures a MAC frame as `SubMac` does for every transmitted
+    // frame, either setting (expanding) the MAC key for each frame
+    // or using an `AesEcb` with the key already set.
+
+    Runner           runner(aName, 20000, kFramePayloadLen);
+    uint8_t          psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame     frame;
+    Mac::KeyMaterial macKey;
+    Mac::Key         key;
+    Mac::ExtAddress  extAddr;
+    Crypto::Key      cryptoKey;
+    Crypto::AesEcb   keyedEcb;
+
+    memcpy(key.m8, kAesCcmKey, sizeof(key.m8));
+    macKey.SetFrom(key);
+    macKey.ConvertToCryptoKey(cryptoKey);
+    keyedEcb.SetKey(cryptoKey);
+    extAddr.Set(kSrcExtAddr);
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu = psdu;
+    frame.SetAesKey(macKey);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            BuildMacFrame(frame, i);
+            frame.ProcessTransmitAesCcm(extAddr, aUseKeyedEcb ? &keyedEcb : nullptr);
+            sSink += frame.GetFooter()[0];
+        }
+    }
+}
+
+void BenchMacFrameEncrypt(const char *aName) { MacFrameEncrypt(aName, /* aUseKeyedEcb */ false); }
+
+void BenchMacFrameEncryptKeyed(const char *aName) { MacFrameEncrypt(aName, /* aUseKeyedEcb */ true); }
+
+//---------------------------------------------------------------------------------------------------------------------
+// Checksum
+
+void BenchChecksumCalculate(const char *aName)
+{
+    Runner           runner(aName, 50000, sizeof(Ip6::Udp::Header) + kMessageLength);
+    Ip6::Address     source;
+    Ip6::Address     destination;
+    Ip6::Udp::Header udpHeader;
+    Message         *message;
+
+    SuccessOrQuit(source.FromString("fd00:1234:5678:9abc:0:ff:fe00:fc10"));
+    SuccessOrQuit(destination.FromString("fd00:1234:5678:9abc:f0e1:d2c3:b4a5:9687"));
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(19788);
+    udpHeader.SetDestinationPort(5683);
+    udpHeader.SetLength(sizeof(udpHeader) + kMessageLength);
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->AppendBytes(sPayload, kMessageLength));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            Checksum::UpdateMessageChecksum(*message, source, destination, Ip6::kProtoUdp);
+        }
+    }
+
+    SuccessOrQuit(message->Read(0, udpHeader));
+    sSink += udpHeader.GetChecksum();
+    message->Free();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// KeyManager
+
+void BenchKeyManagerTemporaryMleKey(const char *aName)
+{
+    // Gets the MLE key of the next key sequence, as done for every
+    // MLE message received from a neighbor which already rotated
+    // its key.
+
+    Runner      runner(aName, 20000, 0);
+    KeyManager &keyManager = sInstance->Get<KeyManager>();
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            const Mle::KeyMaterial &key = keyManager.GetTemporaryMleKey(keyManager.GetCurrentKeySequence() + 1);
+
+            sSink += static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&key));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// ChildTable
+
+static constexpr uint16_t kBenchRouterRloc16 = 0x0400; // RLOC16 of the (parent) router owning the children.
+
+static void GetChildMulticastAddress(uint16_t aChildIndex, Ip6::Address &aAddress)
+{
+    // Every child subscribes to its own site-local multicast address.
+
+    aAddress.Clear();
+    aAddress.mFields.m16[0] = Encoding::BigEndian::HostSwap16(0xff05);
+    aAddress.mFields.m16[7] = Encoding::BigEndian::HostSwap16(aChildIndex + 1);
+}
+
+static void FillChildTable(void)
+{
+    // Fills the whole child table with valid sleepy children.
+
+    ChildTable &childTable = sInstance->Get<ChildTable>();
+
+    childTable.Clear();
+
+    for (uint16_t index = 0; index < childTable.GetMaxChildren(); index++)
+    {
+        Child          *child = childTable.GetNewChild();
+        Mac::ExtAddress extAddress;
+        Ip6::Address    address;
+
+        VerifyOrQuit(child != nullptr);
+
+        memcpy(extAddress.m8, &sPayload[index % (kMessageLength - sizeof(extAddress))], sizeof(extAddress));
+        extAddress.m8[0] = static_cast<uint8_t>(index);
+        GetChildMulticastAddress(index, address);
+
+        child->SetExtAddress(extAddress);
+        child->SetRloc16(kBenchRouterRloc16 | (index + 1));
+        child->SetDeviceMode(Mle::DeviceMode(0));
+        child->SetState(Neighbor::kStateValid);
+        SuccessOrQuit(child->AddIp6Address(address));
+    }
+}
+
+void BenchChildTableFindChild(const char *aName)
+{
+    // Looks up children by RLOC16 and by extended address in a full
+    // child table, as done for frames received from or sent to a
+    // child. Every third lookup is for the RLOC16 of a router, i.e.,
+    // misses the child table as done for all frames of routers.
+
+    static Mac::ExtAddress extAddresses[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+
+    Runner      runner(aName, 20000, 0);
+    ChildTable &childTable  = sInstance->Get<ChildTable>();
+    uint16_t    numChildren = childTable.GetMaxChildren();
+
+    FillChildTable();
+
+    for (uint16_t index = 0; index < numChildren; index++)
+    {
+        extAddresses[index] = childTable.GetChildAtIndex(index)->GetExtAddress();
+    }
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            uint16_t index = static_cast<uint16_t>((i * 7) % numChildren);
+            Child   *child;
+
+            switch (i % 3)
+            {
+            case 0:
+                child = childTable.FindChild(kBenchRouterRloc16 | (index + 1), Child::kInStateValidOrRestoring);
+                break;
+            case 1:
+                child = childTable.FindChild(extAddresses[index], Child::kInStateValid);
+                break;
+            default:
+                child = childTable.FindChild(Mle::Rloc16FromRouterId(static_cast<uint8_t>(index % Mle::kMaxRouterId)),
+                                             Child::kInStateValidOrRestoring);
+                break;
+            }
+
+            sSink += static_cast<uint32_t>(reinterpret_cast<uintptr_t>(child));
+        }
+    }
+
+    childTable.Clear();
+}
+
+void BenchChildTableHasSleepyChild(const char *aName)
+{
+    // Checks whether a sleepy child subscribed to a multicast address,
+    // as done for every multicast message larger than realm-local
+    // scope. Half of the addresses are not subscribed by any child.
+
+    Runner      runner(aName, 20000, 0);
+    ChildTable &childTable  = sInstance->Get<ChildTable>();
+    uint16_t    numChildren = childTable.GetMaxChildren();
+
+    FillChildTable();
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            Ip6::Address address;
+
+            GetChildMulticastAddress(static_cast<uint16_t>((i * 7) % (2 * numChildren)), address);
+            sSink += childTable.HasSleepyChildWithAddress(address);
+        }
+    }
+
+    childTable.Clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Dns::Name
+
+static const char kDnsName[] = "living-room-thermostat._matter._tcp.default.service.arpa.";
+
+void BenchDnsNameParse(const char *aName)
+{
+    Runner   runner(aName, 100000, sizeof(kDnsName) - 1);
+    Message *message;
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(Dns::Name::AppendName(kDnsName, *message));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            uint16_t offset = 0;
+
+            SuccessOrQuit(Dns::Name::ParseName(*message, offset));
+            sSink += offset;
+        }
+    }
+
+    message->Free();
+}
+
+void BenchDnsNameCompare(const char *aName)
+{
+    Runner   runner(aName, 100000, sizeof(kDnsName) - 1);
+    Message *message;
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(Dns::Name::AppendName(kDnsName, *message));
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            uint16_t offset = 0;
+
+            SuccessOrQuit(Dns::Name::CompareName(*message, offset, kDnsName));
+            sSink += offset;
+        }
+    }
+
+    message->Free();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Spinel
+
+static constexpr uint16_t kSpinelBufferSize = 512;
+
+static const otExtAddress kSpinelExtAddr = {{0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0}};
+
+static otError EncodeSpinelFrame(Spinel::Encoder &aEncoder)
+{
+    otError error;
+
+    SuccessOrExit(error = aEncoder.BeginFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_CMD_PROP_VALUE_IS,
+                                              SPINEL_PROP_STREAM_RAW));
+    SuccessOrExit(error = aEncoder.WriteDataWithLen(sPayload, kFramePayloadLen));
+    SuccessOrExit(error = aEncoder.WriteUint8(11));
+    SuccessOrExit(error = aEncoder.WriteInt8(-70));
+    SuccessOrExit(error = aEncoder.WriteInt8(-100));
+    SuccessOrExit(error = aEncoder.WriteUint16(0));
+    SuccessOrExit(error = aEncoder.OpenStruct());
+    SuccessOrExit(error = aEncoder.WriteUint8(0xff));
+    SuccessOrExit(error = aEncoder.WriteUint32(0x12345678));
+    SuccessOrExit(error = aEncoder.WriteEui64(kSpinelExtAddr));
+    SuccessOrExit(error = aEncoder.CloseStruct());
+    SuccessOrExit(error = aEncoder.WriteUint64(0x0123456789abcdefULL));
+    error = aEncoder.EndFrame();
+
+exit:
+    return error;
+}
+
+void BenchSpinelEncode(const char *aName)
+{
+    Runner          runner(aName, 100000, kFramePayloadLen);
+    uint8_t         buffer[kSpinelBufferSize];
+    Spinel::Buffer  ncpBuffer(buffer, sizeof(buffer));
+    Spinel::Encoder encoder(ncpBuffer);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            SuccessOrQuit(EncodeSpinelFrame(encoder));
+            SuccessOrQuit(ncpBuffer.OutFrameBegin());
+            sSink += ncpBuffer.OutFrameGetLength();
+            SuccessOrQuit(ncpBuffer.OutFrameRemove());
+        }
+    }
+}
+
+void BenchSpinelDecode(const char *aName)
+{
+    Runner          runner(aName, 100000, kFramePayloadLen);
+    uint8_t         buffer[kSpinelBufferSize];
+    uint8_t         frame[kSpinelBufferSize];
+    uint16_t        frameLength;
+    Spinel::Buffer  ncpBuffer(buffer, sizeof(buffer));
+    Spinel::Encoder encoder(ncpBuffer);
+    Spinel::Decoder decoder;
+
+    SuccessOrQuit(EncodeSpinelFrame(encoder));
+    SuccessOrQuit(ncpBuffer.OutFrameBegin());
+    frameLength = ncpBuffer.OutFrameGetLength();
+    VerifyOrQuit(ncpBuffer.OutFrameRead(frameLength, frame) == frameLength);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            uint8_t             header;
+            unsigned int        command;
+            unsigned int        key;
+            const uint8_t      *data;
+            uint16_t            dataLength;
+            uint8_t             channel;
+            int8_t              rssi;
+            int8_t              noiseFloor;
+            uint16_t            flags;
+            uint8_t             iid;
+            uint32_t            timestamp;
+            const otExtAddress *extAddress;
+            uint64_t            time;
+
+            decoder.Init(frame, frameLength);
+            SuccessOrQuit(decoder.ReadUint8(header));
+            SuccessOrQuit(decoder.ReadUintPacked(command));
+            SuccessOrQuit(decoder.ReadUintPacked(key));
+            SuccessOrQuit(decoder.ReadDataWithLen(data, dataLength));
+            SuccessOrQuit(decoder.ReadUint8(channel));
+            SuccessOrQuit(decoder.ReadInt8(rssi));
+            SuccessOrQuit(decoder.ReadInt8(noiseFloor));
+            SuccessOrQuit(decoder.ReadUint16(flags));
+            SuccessOrQuit(decoder.OpenStruct());
+            SuccessOrQuit(decoder.ReadUint8(iid));
+            SuccessOrQuit(decoder.ReadUint32(timestamp));
+            SuccessOrQuit(decoder.ReadEui64(extAddress));
+            SuccessOrQuit(decoder.CloseStruct());
+            SuccessOrQuit(decoder.ReadUint64(time));
+
+            sSink += header + command + key + data[0] + dataLength + channel + static_cast<uint8_t>(rssi) +
+                     static_cast<uint8_t>(noiseFloor) + flags + iid + timestamp + extAddress->m8[0] +
+                     static_cast<uint32_t>(time);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Hdlc
+
+static constexpr uint16_t kHdlcBufferSize   = 1500;
+static constexpr uint16_t kHdlcFrameLength  = 255;
+static constexpr uint8_t  kHdlcEscapeStride = 16; // One in this many bytes of the test frame needs escaping.
+
+static void PrepareHdlcFrame(uint8_t *aFrame)
+{
+    for (uint16_t i = 0; i < kHdlcFrameLength; i++)
+    {
+        // Mostly plain bytes, plus a few flag/escape/XON/XOFF values
+        // to exercise the escaping path.
+
+        switch (i % kHdlcEscapeStride)
+        {
+        case 3:
+            aFrame[i] = 0x7e;
+            break;
+        case 7:
+            aFrame[i] = 0x7d;
+            break;
+        case 11:
+            aFrame[i] = 0x11;
+            break;
+        default:
+            aFrame[i] = sPayload[i];
+            break;
+        }
+    }
+}
+
+static void HandleHdlcFrame(void *aContext, otError aError)
+{
+    Hdlc::FrameBuffer<kHdlcBufferSize> &decoderBuffer = *static_cast<Hdlc::FrameBuffer<kHdlcBufferSize> *>(aContext);
+
+    VerifyOrQuit(aError == OT_ERROR_NONE);
+    VerifyOrQuit(decoderBuffer.GetLength() == kHdlcFrameLength);
+    sSink += decoderBuffer.GetFrame()[0];
+    decoderBuffer.Clear();
+}
+
+void BenchHdlcEncode(const char *aName)
+{
+    Runner                             runner(aName, 50000, kHdlcFrameLength);
+    uint8_t                            frame[kHdlcFrameLength];
+    Hdlc::FrameBuffer<kHdlcBufferSize> encoderBuffer;
+    Hdlc::Encoder                      encoder(encoderBuffer);
+
+    PrepareHdlcFrame(frame);
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            encoderBuffer.Clear();
+            SuccessOrQuit(encoder.BeginFrame());
+            SuccessOrQuit(encoder.Encode(frame, sizeof(frame)));
+            SuccessOrQuit(encoder.EndFrame());
+            sSink += encoderBuffer.GetLength();
+        }
+    }
+}
+
+void BenchHdlcDecode(const char *aName)
+{
+    Runner                             runner(aName, 50000, kHdlcFrameLength);
+    uint8_t                            frame[kHdlcFrameLength];
+    Hdlc::FrameBuffer<kHdlcBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kHdlcBufferSize> decoderBuffer;
+    Hdlc::Encoder                      encoder(encoderBuffer);
+    Hdlc::Decoder                      decoder(decoderBuffer, HandleHdlcFrame, &decoderBuffer);
+
+    PrepareHdlcFrame(frame);
+    SuccessOrQuit(encoder.BeginFrame());
+    SuccessOrQuit(encoder.Encode(frame, sizeof(frame)));
+    SuccessOrQuit(encoder.EndFrame());
+
+    while (runner.NextRound())
+    {
+        for (uint32_t i = 0; i < runner.GetIterations(); i++)
+        {
+            decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+struct Benchmark
+{
+    const char *mName;
+    void (*mFunction)(const char *aName);
+};
+
+static const Benchmark kBenchmarks[] = {
+    {"message.append", BenchMessageAppend},
+    {"message.read", BenchMessageRead},
+    {"message.clone", BenchMessageClone},
+    {"lowpan.compress", BenchLowpanCompress},
+    {"lowpan.decompress", BenchLowpanDecompress},
+    {"lowpan.compress_global", BenchLowpanCompressGlobal},
+    {"lowpan.decompress_global", BenchLowpanDecompressGlobal},
+    {"mac_frame.build", BenchMacFrameBuild},
+    {"mac_frame.parse", BenchMacFrameParse},
+    {"aes_ccm.encrypt", BenchAesCcmEncrypt},
+    {"aes_ccm.decrypt", BenchAesCcmDecrypt},
+    {"mac_frame.encrypt", BenchMacFrameEncrypt},
+    {"mac_frame.encrypt_keyed", BenchMacFrameEncryptKeyed},
+    {"checksum.calculate", BenchChecksumCalculate},
+    {"key_manager.temporary_mle_key", BenchKeyManagerTemporaryMleKey},
+    {"child_table.find_child", BenchChildTableFindChild},
+    {"child_table.has_sleepy_child", BenchChildTableHasSleepyChild},
+    {"dns_name.parse", BenchDnsNameParse},
+    {"dns_name.compare", BenchDnsNameCompare},
+    {"spinel.encode", BenchSpinelEncode},
+    {"spinel.decode", BenchSpinelDecode},
+    {"hdlc.encode", BenchHdlcEncode},
+    {"hdlc.decode", BenchHdlcDecode},
+};
+
+void RunBenchmarks(const char *aFilter)
+{
+    // Deterministic, incompressible-looking payload.
+    for (uint16_t i = 0; i < kMessageLength; i++)
+    {
+        sPayload[i] = static_cast<uint8_t>((i * 167u + 13u) ^ (i >> 3));
+    }
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    printf("{\n  \"version\": \"%s\",\n  \"benchmarks\": [", otGetVersionString());
+
+    for (const Benchmark &benchmark : kBenchmarks)
+    {
+        if ((aFilter == nullptr) || (strstr(benchmark.mName, aFilter) != nullptr))
+        {
+            benchmark.mFunction(benchmark.mName);
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace Bench
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    if ((argc > 2) || ((argc == 2) && (strcmp(argv[1], "--help") == 0)))
+    {
+        fprintf(stderr, "Usage: %s [filter]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ot::Bench::RunBenchmarks((argc == 2) ? argv[1] : nullptr);
+
+    return 0;
+}
@@ -0,0 +1,310 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
+static Instance *sInstance;
+
+static constexpr uint16_t kCacheEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES;
+static constexpr uint16_t kNumEids      = 4 * kCacheEntries;
+
+static Ip6::Address sEids[kNumEids];
+
+static void PrepareEids(void)
+{
+    // EIDs share the same prefix and use sequential IIDs, so most
+    // of them differ only in their last byte.
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        SuccessOrQuit(sEids[i].FromString("fd00:1234:5678:9abc::"));
+        sEids[i].mFields.m8[14] = static_cast<uint8_t>((i + 1) >> 8);
+        sEids[i].mFields.m8[15] = static_cast<uint8_t>((i + 1) & 0xff);
+    }
+}
+
+static uint16_t GetRloc16(uint16_t aEidIndex) { return static_cast<uint16_t>(0x0400 + aEidIndex); }
+
+static void AddSnoopedEntry(uint16_t aEidIndex)
+{
+    sInstance->Get<AddressResolver>().UpdateSnoopedCacheEntry(sEids[aEidIndex], GetRloc16(aEidIndex),
+                                                              sInstance->Get<Mac::Mac>().GetShortAddress());
+}
+
+class UnitTester
+{
+public:
+    static void VerifyListLinks(void)
+    {
+        // Checks that every entry tracks its list and its previous
+        // entry in the list.
+
+        AddressResolver                 &resolver = sInstance->Get<AddressResolver>();
+        AddressResolver::CacheEntryList *lists[]  = {&resolver.mCachedList, &resolver.mSnoopedList,
+                                                     &resolver.mQueryList, &resolver.mQueryRetryList};
+
+        for (AddressResolver::CacheEntryList *list : lists)
+        {
+            AddressResolver::CacheEntry *prev = nullptr;
+
+            for (AddressResolver::CacheEntry &entry : *list)
+            {
+                VerifyOrQuit(entry.GetList() == list);
+                VerifyOrQuit(entry.GetPrev() == prev);
+                prev = &entry;
+            }
+        }
+    }
+
+    static void TestCacheHitDoesNotWalkLists(void)
+    {
+        AddressResolver                 &resolver = sInstance->Get<AddressResolver>();
+        AddressResolver::CacheEntry     *head;
+        AddressResolver::CacheEntry     *detached;
+        AddressResolver::CacheEntry     *entry;
+        AddressResolver::CacheEntry     *prev;
+        AddressResolver::CacheEntryList *list;
+
+        printf("\nTestCacheHitDoesNotWalkLists");
+
+        // Fill the cache with snooped entries. The first added entry
+        // is the tail of the snooped list.
+
+        for (uint16_t i = 0; i < kCacheEntries; i++)
+        {
+            AddSnoopedEntry(i);
+        }
+
+        VerifyListLinks();
+
+        // Cut the snooped list after its head, so that the rest of
+        // the entries can no longer be reached by walking the list.
+        // A hit must still find the entry, its list and its previous
+        // entry.
+
+        head     = resolver.mSnoopedList.GetHead();
+        detached = head->GetNext();
+        VerifyOrQuit(detached != nullptr);
+        head->SetNext(nullptr);
+
+        for (uint16_t i = 0; i + 1 < kCacheEntries; i++)
+        {
+            entry = resolver.FindCacheEntry(sEids[i], list, prev);
+            VerifyOrQuit(entry != nullptr);
+            VerifyOrQuit(entry->Matches(sEids[i]));
+            VerifyOrQuit(list == &resolver.mSnoopedList);
+            VerifyOrQuit((prev != nullptr) && prev->Matches(sEids[i + 1]));
+        }
+
+        head->SetNext(detached);
+        VerifyListLinks();
+
+        // A hit moves the entry to the head of the cached list.
+
+        VerifyOrQuit(resolver.LookUp(sEids[0]) == GetRloc16(0));
+        entry = resolver.FindCacheEntry(sEids[0], list, prev);
+        VerifyOrQuit((entry != nullptr) && (list == &resolver.mCachedList) && (prev == nullptr));
+
+        VerifyOrQuit(resolver.LookUp(sEids[1]) == GetRloc16(1));
+        entry = resolver.FindCacheEntry(sEids[0], list, prev);
+        VerifyOrQuit((entry != nullptr) && (list == &resolver.mCachedList));
+        VerifyOrQuit((prev != nullptr) && prev->Matches(sEids[1]));
+        VerifyListLinks();
+
+        resolver.Clear();
+
+        printf(" -- PASS\n");
+    }
+};
+
+static void VerifyCacheIndex(void)
+{
+    // Checks that looking up every EID (through the index) agrees
+    // with walking the cache entry lists.
+
+    AddressResolver                                &resolver = sInstance->Get<AddressResolver>();
+    AddressResolver::Iterator                       iterator;
+    AddressResolver::EntryInfo                      entryInfo;
+    Array<AddressResolver::EntryInfo, kCacheEntries> entries;
+
+    iterator.Clear();
+
+    while (resolver.GetNextCacheEntry(entryInfo, iterator) == kErrorNone)
+    {
+        SuccessOrQuit(entries.PushBack(entryInfo));
+    }
+
+    for (const Ip6::Address &eid : sEids)
+    {
+        Mac::ShortAddress expectedRloc16 = Mac::kShortAddrInvalid;
+
+        for (const AddressResolver::EntryInfo &entry : entries)
+        {
+            if (AsCoreType(&entry.mTarget) == eid)
+            {
+                expectedRloc16 = entry.mRloc16;
+                break;
+            }
+        }
+
+        VerifyOrQuit(resolver.LookUp(eid) == expectedRloc16, "LookUp() does not match the cache entry lists");
+    }
+
+    UnitTester::VerifyListLinks();
+}
+
+static uint16_t GetNumCacheEntries(void)
+{
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo entryInfo;
+    uint16_t                   numEntries = 0;
+
+    iterator.Clear();
+
+    while (sInstance->Get<AddressResolver>().GetNextCacheEntry(entryInfo, iterator) == kErrorNone)
+    {
+        numEntries++;
+    }
+
+    return numEntries;
+}
+
+void TestAddressResolverCacheIndex(void)
+{
+    AddressResolver &resolver = sInstance->Get<AddressResolver>();
+
+    printf("\nTestAddressResolverCacheIndex");
+
+    // Fill the cache with sequential IIDs.
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        AddSnoopedEntry(i);
+    }
+
+    VerifyOrQuit(GetNumCacheEntries() == kCacheEntries);
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        VerifyOrQuit(resolver.LookUp(sEids[i]) == ((i < kCacheEntries) ? GetRloc16(i) : Mac::kShortAddrInvalid));
+    }
+
+    VerifyCacheIndex();
+
+    // Remove every third entry. Each removal shifts back the entries
+    // following it in the same probe sequence.
+
+    for (uint16_t i = 0; i < kCacheEntries; i += 3)
+    {
+        resolver.Remove(sEids[i]);
+        VerifyOrQuit(resolver.LookUp(sEids[i]) == Mac::kShortAddrInvalid);
+    }
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        VerifyOrQuit(resolver.LookUp(sEids[i]) == ((i % 3 == 0) ? Mac::kShortAddrInvalid : GetRloc16(i)));
+    }
+
+    VerifyCacheIndex();
+
+    // Add the removed entries back, then keep adding new ones so
+    // that older entries are evicted.
+
+    for (uint16_t i = 0; i < kCacheEntries; i += 3)
+    {
+        AddSnoopedEntry(i);
+    }
+
+    VerifyOrQuit(GetNumCacheEntries() == kCacheEntries);
+    VerifyCacheIndex();
+
+    for (uint16_t i = kCacheEntries; i < kNumEids; i++)
+    {
+        AddSnoopedEntry(i);
+        VerifyOrQuit(resolver.LookUp(sEids[i]) == GetRloc16(i));
+        VerifyOrQuit(GetNumCacheEntries() == kCacheEntries);
+    }
+
+    VerifyCacheIndex();
+
+    // Remove all the remaining entries.
+
+    for (const Ip6::Address &eid : sEids)
+    {
+        resolver.Remove(eid);
+    }
+
+    VerifyOrQuit(GetNumCacheEntries() == 0);
+    VerifyCacheIndex();
+
+    printf(" -- PASS\n");
+}
+
+void TestAddressResolver(void)
+{
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    // Snooped entries are only added by an FTD.
+    SuccessOrQuit(sInstance->Get<Mle::MleRouter>().SetDeviceMode(Mle::DeviceMode(
+        Mle::DeviceMode::kModeRxOnWhenIdle | Mle::DeviceMode::kModeFullThreadDevice |
+        Mle::DeviceMode::kModeFullNetworkData)));
+
+    PrepareEids();
+    TestAddressResolverCacheIndex();
+    UnitTester::TestCacheHitDoesNotWalkLists();
+
+    testFreeInstance(sInstance);
+}
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    ot::TestAddressResolver();
+    printf("\nAll tests passed.\n");
+#else
+    printf("TMF_ADDRESS_CACHE_HASH_INDEX feature is not enabled\n");
+#endif
+    return 0;
+}
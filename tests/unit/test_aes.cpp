@@ -253,11 +253,200 @@ void TestInPlaceAesCcmProcessing(void)
     testFreeInstance(instance);
 }
 
+/**
+ * Verifies test vector from RFC 3610 Section 8 (Packet Vector #1), with the payload processed in one call and split
+ * in chunks of different sizes.
+ *
+ */
+void TestAesCcmRfc3610Vector(void)
+{
+    static constexpr uint8_t kTagLength     = 8;
+    static constexpr uint8_t kHeaderLength  = 8;
+    static constexpr uint8_t kPayloadLength = 23;
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    static const uint8_t kNonce[] = {
+        0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+    };
+
+    static const uint8_t kPacket[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e,
+    };
+
+    static const uint8_t kEncrypted[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2,
+        0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84, 0x17,
+        0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0,
+    };
+
+    static const ot::Crypto::AesCcm::Mode kModes[] = {ot::Crypto::AesCcm::kEncrypt, ot::Crypto::AesCcm::kDecrypt};
+
+    static const uint8_t kChunkSizes[][3] = {
+        {kPayloadLength, 0, 0}, {1, 22, 0}, {7, 16, 0}, {16, 7, 0}, {3, 17, 3}, {15, 1, 7},
+    };
+
+    ot::Instance      *instance = testInitInstance();
+    ot::Crypto::AesCcm aesCcm;
+    uint8_t            frame[sizeof(kEncrypted)];
+
+    VerifyOrQuit(instance != nullptr);
+
+    aesCcm.SetKey(kKey, sizeof(kKey));
+
+    for (const uint8_t *chunkSizes : kChunkSizes)
+    {
+        for (ot::Crypto::AesCcm::Mode mode : kModes)
+        {
+            uint8_t offset = kHeaderLength;
+
+            if (mode == ot::Crypto::AesCcm::kEncrypt)
+            {
+                memcpy(frame, kPacket, sizeof(kPacket));
+            }
+            else
+            {
+                memcpy(frame, kEncrypted, sizeof(kEncrypted));
+            }
+
+            aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+            aesCcm.Header(frame, kHeaderLength);
+
+            for (uint8_t i = 0; i < 3; i++)
+            {
+                aesCcm.Payload(frame + offset, frame + offset, chunkSizes[i], mode);
+                offset += chunkSizes[i];
+            }
+
+            VerifyOrQuit(offset == kHeaderLength + kPayloadLength);
+
+            if (mode == ot::Crypto::AesCcm::kEncrypt)
+            {
+                aesCcm.Finalize(frame + offset);
+                VerifyOrQuit(memcmp(frame, kEncrypted, sizeof(kEncrypted)) == 0);
+            }
+            else
+            {
+                uint8_t tag[kTagLength];
+
+                aesCcm.Finalize(tag);
+                VerifyOrQuit(memcmp(frame, kPacket, sizeof(kPacket)) == 0);
+                VerifyOrQuit(memcmp(tag, kEncrypted + offset, sizeof(tag)) == 0);
+            }
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
+/**
+ * Verifies AES CCM using an `AesEcb` with the key already set gives the same result as setting the key.
+ *
+ */
+void TestAesCcmWithKeyedEcb(void)
+{
+    static constexpr uint8_t kTagLength     = 8;
+    static constexpr uint8_t kHeaderLength  = 21;
+    static constexpr uint8_t kPayloadLength = 100;
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    static const uint8_t kOtherKey[] = {
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    };
+
+    static const uint8_t kNonce[] = {
+        0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    ot::Instance      *instance = testInitInstance();
+    ot::Crypto::AesCcm aesCcm;
+    ot::Crypto::AesEcb keyedEcb;
+    ot::Crypto::Key    cryptoKey;
+    uint8_t            plain[kHeaderLength + kPayloadLength];
+    uint8_t            expected[sizeof(plain)];
+    uint8_t            frame[sizeof(plain)];
+    uint8_t            expectedTag[kTagLength];
+    uint8_t            tag[kTagLength];
+
+    VerifyOrQuit(instance != nullptr);
+
+    for (uint8_t i = 0; i < sizeof(plain); i++)
+    {
+        plain[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    cryptoKey.Set(kKey, sizeof(kKey));
+    keyedEcb.SetKey(cryptoKey);
+
+    // Encrypt by setting the key.
+
+    memcpy(expected, plain, sizeof(plain));
+    aesCcm.SetKey(kKey, sizeof(kKey));
+    aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+    aesCcm.Header(expected, kHeaderLength);
+    aesCcm.Payload(expected + kHeaderLength, expected + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+    aesCcm.Finalize(expectedTag);
+
+    // Encrypt and then decrypt using the keyed `AesEcb` (twice, to check the `AesEcb` is reusable).
+
+    for (uint8_t round = 0; round < 2; round++)
+    {
+        memcpy(frame, plain, sizeof(plain));
+        aesCcm.SetKey(keyedEcb);
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(memcmp(frame, expected, sizeof(expected)) == 0);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(expectedTag)) == 0);
+
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kDecrypt);
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(memcmp(frame, plain, sizeof(plain)) == 0);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(expectedTag)) == 0);
+    }
+
+    // Setting a key after using the keyed `AesEcb` must use the new key (and leave the keyed `AesEcb` unchanged).
+
+    memcpy(frame, plain, sizeof(plain));
+    aesCcm.SetKey(kOtherKey, sizeof(kOtherKey));
+    aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+    aesCcm.Header(frame, kHeaderLength);
+    aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+    aesCcm.Finalize(tag);
+
+    VerifyOrQuit(memcmp(frame + kHeaderLength, expected + kHeaderLength, kPayloadLength) != 0);
+
+    memcpy(frame, plain, sizeof(plain));
+    aesCcm.SetKey(keyedEcb);
+    aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+    aesCcm.Header(frame, kHeaderLength);
+    aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+    aesCcm.Finalize(tag);
+
+    VerifyOrQuit(memcmp(frame, expected, sizeof(expected)) == 0);
+    VerifyOrQuit(memcmp(tag, expectedTag, sizeof(expectedTag)) == 0);
+
+    testFreeInstance(instance);
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
     TestInPlaceAesCcmProcessing();
+    TestAesCcmRfc3610Vector();
+    TestAesCcmWithKeyedEcb();
     printf("All tests passed\n");
     return 0;
 }
@@ -26,6 +26,9 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <string.h>
+
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
@@ -464,6 +467,120 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static uint16_t CalculateBytewise(const uint8_t *aBuffer, uint16_t aLength)
+    {
+        // Reference implementation folding one byte at a time.
+
+        Checksum checksum;
+
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            checksum.AddUint8(aBuffer[i]);
+        }
+
+        return checksum.GetValue();
+    }
+
+    static void TestSplitData(void)
+    {
+        // Verify that adding data in pieces of arbitrary (odd or even)
+        // lengths and alignments gives the same result as adding it
+        // at once or one byte at a time.
+
+        constexpr uint16_t kMaxLength     = 600;
+        constexpr uint16_t kNumIterations = 2000;
+
+        uint8_t   buffer[kMaxLength + sizeof(uint32_t)];
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            uint16_t length = Random::NonCrypto::GetUint16InRange(0, kMaxLength + 1);
+            uint8_t  align  = Random::NonCrypto::GetUint8InRange(0, sizeof(uint32_t));
+            uint8_t *data   = &buffer[align];
+            uint16_t offset = 0;
+            Checksum whole;
+            Checksum split;
+
+            Random::NonCrypto::FillBuffer(data, length);
+
+            // Also cover the all-ones data which sums to 0xffff.
+            if (iter % 100 == 0)
+            {
+                memset(data, 0xff, length);
+            }
+
+            whole.AddData(data, length);
+            VerifyOrQuit(whole.GetValue() == CalculateBytewise(data, length));
+            VerifyOrQuit(whole.GetValue() == CalculateChecksum(data, length));
+
+            while (offset < length)
+            {
+                uint16_t pieceLength = Random::NonCrypto::GetUint16InRange(1, 64);
+
+                pieceLength = Min<uint16_t>(pieceLength, length - offset);
+                split.AddData(&data[offset], pieceLength);
+                offset += pieceLength;
+            }
+
+            VerifyOrQuit(split.GetValue() == whole.GetValue());
+            VerifyOrQuit(split.mAtOddIndex == ((length % 2) != 0));
+        }
+
+        printf("TestSplitData() passed\n");
+    }
+
+    static void TestThroughput(void)
+    {
+        // Compare the time to checksum a large buffer using `AddData()`
+        // against the byte-at-a-time reference. This only reports the
+        // numbers and does not fail on a slow run.
+
+        constexpr uint16_t kLength        = 1280;
+        constexpr uint32_t kNumIterations = 20000;
+
+        uint8_t                                        buffer[kLength];
+        uint16_t                                       result   = 0;
+        Instance                                      *instance = static_cast<Instance *>(testInitInstance());
+        std::chrono::high_resolution_clock::time_point start;
+        std::chrono::duration<double, std::micro>      bytewiseTime;
+        std::chrono::duration<double, std::micro>      addDataTime;
+
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::FillBuffer(buffer, kLength);
+
+        start = std::chrono::high_resolution_clock::now();
+
+        for (uint32_t i = 0; i < kNumIterations; i++)
+        {
+            buffer[0] = static_cast<uint8_t>(i);
+            result += CalculateBytewise(buffer, kLength);
+        }
+
+        bytewiseTime = std::chrono::high_resolution_clock::now() - start;
+
+        start = std::chrono::high_resolution_clock::now();
+
+        for (uint32_t i = 0; i < kNumIterations; i++)
+        {
+            Checksum checksum;
+
+            buffer[0] = static_cast<uint8_t>(i);
+            checksum.AddData(buffer, kLength);
+            result -= checksum.GetValue();
+        }
+
+        addDataTime = std::chrono::high_resolution_clock::now() - start;
+
+        VerifyOrQuit(result == 0);
+
+        printf("TestThroughput: bytewise %.1f MB/s, AddData %.1f MB/s\n",
+               kLength * kNumIterations / bytewiseTime.count(), kLength * kNumIterations / addDataTime.count());
+    }
 };
 
 } // namespace ot
@@ -471,6 +588,8 @@ public:
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestSplitData();
+    ot::ChecksumTester::TestThroughput();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     ot::TestTcp4MessageChecksum();
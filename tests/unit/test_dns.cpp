@@ -768,6 +768,170 @@ void TestDnsCompressedName(void)
     testFreeInstance(instance);
 }
 
+void TestDnsNameCompressor(void)
+{
+    enum
+    {
+        kHeaderOffset = 10,
+        kNameSize     = 256,
+        kNumHosts     = 20,
+    };
+
+    const char kServiceName[]        = "_srv._udp.default.service.arpa.";
+    const char kSubTypeServiceName[] = "_sub1._sub._srv._udp.default.service.arpa.";
+    const char kInstanceLabel[]      = "Human.Readable";
+    const char kDottedName[]         = "Human.Readable._srv._udp.default.service.arpa";
+    const char kHostName[]           = "host.default.service.arpa";
+    const char kHostNameUpperCase[]  = "HOST.Default.Service.ARPA.";
+
+    Instance           *instance;
+    Message            *message;
+    Dns::NameCompressor compressor;
+    uint16_t            offset;
+    uint16_t            serviceOffset;
+    uint16_t            subTypeOffset;
+    uint16_t            instanceOffset;
+    uint16_t            instance2Offset;
+    uint16_t            dottedOffset;
+    uint16_t            hostOffset;
+    uint16_t            host2Offset;
+    uint16_t            rootOffset;
+    uint16_t            instanceOffsets[2];
+    uint16_t            hostNameOffsets[2];
+    char                name[kNameSize];
+    char                label[Dns::Name::kMaxLabelSize];
+
+    printf("================================================================\n");
+    printf("TestDnsNameCompressor()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+
+    for (uint8_t index = 0; index < kHeaderOffset + sizeof(Dns::Header); index++)
+    {
+        SuccessOrQuit(message->Append(index));
+    }
+
+    message->SetOffset(kHeaderOffset);
+
+    serviceOffset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kServiceName, *message));
+    VerifyOrQuit(message->GetLength() - serviceOffset == sizeof(kServiceName));
+
+    // Sub-type labels followed by a pointer to the service name.
+    subTypeOffset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kSubTypeServiceName, *message));
+    VerifyOrQuit(message->GetLength() - subTypeOffset == sizeof("_sub1._sub.") - 1 + 2);
+
+    // Instance label followed by a pointer to the service name.
+    instanceOffset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kInstanceLabel, sizeof(kInstanceLabel) - 1, kServiceName, *message));
+    VerifyOrQuit(message->GetLength() - instanceOffset == sizeof(kInstanceLabel) + 2);
+
+    // Same instance name again is a single pointer label.
+    instance2Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kInstanceLabel, sizeof(kInstanceLabel) - 1, kServiceName, *message));
+    VerifyOrQuit(message->GetLength() - instance2Offset == 2);
+
+    // Same text as multiple labels must not point to the instance label.
+    dottedOffset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kDottedName, *message));
+    VerifyOrQuit(message->GetLength() - dottedOffset == sizeof("Human.Readable.") - 1 + 2);
+
+    // Host name shares the domain suffix, and is matched case-insensitively.
+    hostOffset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kHostName, *message));
+    VerifyOrQuit(message->GetLength() - hostOffset == sizeof("host.") - 1 + 2);
+
+    host2Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kHostNameUpperCase, *message));
+    VerifyOrQuit(message->GetLength() - host2Offset == 2);
+
+    rootOffset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(".", *message));
+    VerifyOrQuit(message->GetLength() - rootOffset == 1);
+
+    offset = message->GetLength();
+    VerifyOrQuit(compressor.AppendName("bad..name", *message) == kErrorInvalidArgs);
+    VerifyOrQuit(compressor.AppendName(".bad", *message) == kErrorInvalidArgs);
+    SuccessOrQuit(message->SetLength(offset));
+
+    // Verify all the appended names.
+
+    instanceOffsets[0] = instanceOffset;
+    instanceOffsets[1] = instance2Offset;
+    hostNameOffsets[0] = hostOffset;
+    hostNameOffsets[1] = host2Offset;
+
+    offset = serviceOffset;
+    SuccessOrQuit(Dns::Name::CompareName(*message, offset, kServiceName));
+    VerifyOrQuit(offset == subTypeOffset);
+    SuccessOrQuit(Dns::Name::CompareName(*message, offset, kSubTypeServiceName));
+    VerifyOrQuit(offset == instanceOffset);
+
+    for (uint16_t nameOffset : instanceOffsets)
+    {
+        offset = nameOffset;
+        SuccessOrQuit(Dns::Name::CompareLabel(*message, offset, kInstanceLabel));
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset, kServiceName));
+    }
+
+    offset = dottedOffset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name, sizeof(name)));
+    printf("Read name =\"%s\"\n", name);
+    offset = dottedOffset;
+    SuccessOrQuit(Dns::Name::CompareName(*message, offset, kDottedName));
+    VerifyOrQuit(offset == hostOffset);
+
+    for (uint16_t nameOffset : hostNameOffsets)
+    {
+        offset = nameOffset;
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset, kHostName));
+    }
+
+    offset = rootOffset;
+    SuccessOrQuit(Dns::Name::CompareName(*message, offset, "."));
+
+    // Append more names than the compressor can remember and check
+    // they are all still encoded correctly. The shared domain suffix
+    // is never evicted, so every new host name is a single label
+    // followed by a pointer.
+
+    for (uint8_t round = 0; round < 2; round++)
+    {
+        uint16_t hostOffsets[kNumHosts];
+
+        for (uint8_t index = 0; index < kNumHosts; index++)
+        {
+            snprintf(label, sizeof(label), "host%u", index);
+            snprintf(name, sizeof(name), "%s.default.service.arpa.", label);
+            hostOffsets[index] = message->GetLength();
+            SuccessOrQuit(compressor.AppendName(name, *message));
+
+            if (round == 0)
+            {
+                // Label length, label and pointer.
+                VerifyOrQuit(message->GetLength() - hostOffsets[index] ==
+                             sizeof(uint8_t) + StringLength(label, sizeof(label)) + sizeof(uint16_t));
+            }
+        }
+
+        for (uint8_t index = 0; index < kNumHosts; index++)
+        {
+            snprintf(name, sizeof(name), "host%u.default.service.arpa.", index);
+            offset = hostOffsets[index];
+            SuccessOrQuit(Dns::Name::CompareName(*message, offset, name));
+        }
+    }
+
+    printf("Message length with compression: %u\n", message->GetLength());
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 void TestHeaderAndResourceRecords(void)
 {
     enum
@@ -1387,6 +1551,7 @@ int main(void)
 {
     ot::TestDnsName();
     ot::TestDnsCompressedName();
+    ot::TestDnsNameCompressor();
     ot::TestHeaderAndResourceRecords();
     ot::TestDnsTxtEntry();
 
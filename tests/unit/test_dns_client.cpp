@@ -0,0 +1,601 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/dns_client.h>
+#include <openthread/srp_client.h>
+#include <openthread/srp_server.h>
+#include <openthread/thread.h>
+
+#include "common/arg_macros.hpp"
+#include "common/instance.hpp"
+#include "common/num_utils.hpp"
+#include "common/string.hpp"
+#include "common/time.hpp"
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE && \
+    OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_ENABLE &&                       \
+    OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE && !OPENTHREAD_CONFIG_TIME_SYNC_ENABLE && !OPENTHREAD_PLATFORM_POSIX
+#define ENABLE_DNS_CACHE_TEST 1
+#else
+#define ENABLE_DNS_CACHE_TEST 0
+#endif
+
+#if ENABLE_DNS_CACHE_TEST
+
+using namespace ot;
+
+// Logs a message and adds current time (sNow) as "<hours>:<min>:<secs>.<msec>"
+#define Log(...)                                                                                          \
+    printf("%02u:%02u:%02u.%03u " OT_FIRST_ARG(__VA_ARGS__) "\n", (sNow / 36000000), (sNow / 60000) % 60, \
+           (sNow / 1000) % 60, sNow % 1000 OT_REST_ARGS(__VA_ARGS__))
+
+static ot::Instance *sInstance;
+
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+static otRadioFrame sRadioTxFrame;
+static uint8_t      sRadioTxFramePsdu[OT_RADIO_FRAME_MAX_SIZE];
+static bool         sRadioTxOngoing = false;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Function prototypes
+
+void ProcessRadioTxAndTasklets(void);
+void AdvanceTime(uint32_t aDuration);
+
+//----------------------------------------------------------------------------------------------------------------------
+// `otPlatRadio`
+
+extern "C" {
+
+otError otPlatRadioTransmit(otInstance *, otRadioFrame *)
+{
+    sRadioTxOngoing = true;
+
+    return OT_ERROR_NONE;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *) { return &sRadioTxFrame; }
+
+otRadioCaps otPlatRadioGetCaps(otInstance *)
+{
+    // Let the radio handle CSMA backoff and retries so that frames are
+    // passed to `otPlatRadioTransmit()` right away. The test runs for
+    // hours of simulated time and the send queue must be drained.
+
+    return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF | OT_RADIO_CAPS_TRANSMIT_RETRIES;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// `otPlatAlaram`
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    OT_UNUSED_VARIABLE(aLogLevel);
+    OT_UNUSED_VARIABLE(aLogRegion);
+
+    va_list args;
+
+    printf("   ");
+    va_start(args, aFormat);
+    vprintf(aFormat, args);
+    va_end(args);
+    printf("\n");
+}
+#endif
+
+} // extern "C"
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void ProcessRadioTxAndTasklets(void)
+{
+    do
+    {
+        if (sRadioTxOngoing)
+        {
+            sRadioTxOngoing = false;
+            otPlatRadioTxStarted(sInstance, &sRadioTxFrame);
+            otPlatRadioTxDone(sInstance, &sRadioTxFrame, nullptr, OT_ERROR_NONE);
+        }
+
+        otTaskletsProcess(sInstance);
+    } while (otTaskletsArePending(sInstance));
+}
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    Log("AdvanceTime for %u.%03u", aDuration / 1000, aDuration % 1000);
+
+    while (TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        ProcessRadioTxAndTasklets();
+        sNow = sAlarmTime;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    ProcessRadioTxAndTasklets();
+    sNow = time;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+static constexpr uint16_t kNumSmallServices = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES + 1;
+static constexpr uint16_t kNumLargeServices = 3;
+static constexpr uint16_t kNumServices      = kNumSmallServices + kNumLargeServices;
+static constexpr uint16_t kLargeTxtSize     = 200;
+
+static const char kHostName[]      = "myhost";
+static const char kInstanceLabel[] = "inst";
+
+static Srp::Client::Service sServices[kNumServices];
+static char                 sServiceNames[kNumServices][16];
+static uint8_t              sLargeTxtValue[kLargeTxtSize];
+static otDnsTxtEntry        sLargeTxtEntries[] = {
+    {"a", sLargeTxtValue, sizeof(sLargeTxtValue)},
+    {"b", sLargeTxtValue, sizeof(sLargeTxtValue)},
+    {"c", sLargeTxtValue, sizeof(sLargeTxtValue)},
+};
+
+static uint16_t sBrowseCallbackCount = 0;
+static Error    sBrowseError         = kErrorNone;
+static uint32_t sBrowseExpireTime    = 0;
+
+void HandleSrpServerUpdate(otSrpServerServiceUpdateId aId,
+                           const otSrpServerHost     *aHost,
+                           uint32_t                   aTimeout,
+                           void                      *aContext)
+{
+    OT_UNUSED_VARIABLE(aHost);
+    OT_UNUSED_VARIABLE(aTimeout);
+    OT_UNUSED_VARIABLE(aContext);
+
+    otSrpServerHandleServiceUpdateResult(sInstance, aId, kErrorNone);
+}
+
+void HandleBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse, void *aContext)
+{
+    VerifyOrQuit(aContext == sInstance);
+
+    sBrowseCallbackCount++;
+    sBrowseError = aError;
+
+    if (aError == kErrorNone)
+    {
+        otDnsServiceInfo info;
+
+        memset(&info, 0, sizeof(info));
+        SuccessOrQuit(otDnsBrowseResponseGetServiceInfo(aResponse, kInstanceLabel, &info));
+
+        // The response is cached using the minimum TTL of its records.
+        sBrowseExpireTime = sNow + Time::SecToMsec(Min(info.mTtl, info.mHostAddressTtl));
+    }
+}
+
+void InitTest(void)
+{
+    Srp::Server *srpServer;
+    Srp::Client *srpClient;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Initialize OT instance and start Thread operation.
+
+    sNow      = 0;
+    sInstance = static_cast<Instance *>(testInitInstance());
+
+    memset(&sRadioTxFrame, 0, sizeof(sRadioTxFrame));
+    sRadioTxFrame.mPsdu = sRadioTxFramePsdu;
+
+    SuccessOrQuit(otLinkSetPanId(sInstance, 0x1234));
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true));
+
+    AdvanceTime(10000);
+
+    VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and register the services using SRP client,
+    // the DNS-SD server then answers the DNS client queries from the
+    // registered services.
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    memset(sLargeTxtValue, 'x', sizeof(sLargeTxtValue));
+
+    for (uint16_t i = 0; i < kNumServices; i++)
+    {
+        Srp::Client::Service &service = sServices[i];
+        bool                  isLarge = (i >= kNumSmallServices);
+
+        snprintf(sServiceNames[i], sizeof(sServiceNames[i]), "_%c%u._udp", isLarge ? 'l' : 's',
+                 isLarge ? i - kNumSmallServices : i);
+
+        memset(&service, 0, sizeof(service));
+        service.mName          = sServiceNames[i];
+        service.mInstanceName  = kInstanceLabel;
+        service.mTxtEntries    = isLarge ? sLargeTxtEntries : nullptr;
+        service.mNumTxtEntries = isLarge ? GetArrayLength(sLargeTxtEntries) : 0;
+        service.mPort          = 1000 + i;
+
+        SuccessOrQuit(srpClient->AddService(service));
+    }
+
+    // The services do not fit in a single update message, so SRP
+    // client registers them one by one.
+
+    AdvanceTime(20000);
+
+    for (Srp::Client::Service &service : sServices)
+    {
+        VerifyOrQuit(service.GetState() == Srp::Client::kRegistered);
+    }
+}
+
+void PrepareConfig(otDnsQueryConfig &aConfig, const otIp6Address &aServerAddress)
+{
+    memset(&aConfig, 0, sizeof(aConfig));
+    aConfig.mServerSockAddr.mAddress = aServerAddress;
+    aConfig.mServerSockAddr.mPort    = OPENTHREAD_CONFIG_DNSSD_SERVER_PORT;
+}
+
+bool Browse(const char *aServiceLabel, const otDnsQueryConfig &aConfig)
+{
+    // Browses for the given service and returns whether the response
+    // was answered from the cache (i.e., synchronously from the call).
+
+    const otDnsClientCacheCounters *counters = otDnsClientGetCacheCounters(sInstance);
+    uint32_t                        hits     = counters->mHits;
+    uint32_t                        misses   = counters->mMisses;
+    bool                            fromCache;
+    String<64>                      name;
+
+    name.Append("%s.default.service.arpa.", aServiceLabel);
+
+    sBrowseCallbackCount = 0;
+    SuccessOrQuit(otDnsClientBrowse(sInstance, name.AsCString(), HandleBrowseResponse, sInstance, &aConfig));
+
+    fromCache = (sBrowseCallbackCount == 1);
+
+    if (fromCache)
+    {
+        VerifyOrQuit(counters->mHits == hits + 1);
+        VerifyOrQuit(counters->mMisses == misses);
+    }
+    else
+    {
+        VerifyOrQuit(sBrowseCallbackCount == 0);
+        VerifyOrQuit(counters->mHits == hits);
+        VerifyOrQuit(counters->mMisses == misses + 1);
+
+        AdvanceTime(100);
+        VerifyOrQuit(sBrowseCallbackCount == 1);
+    }
+
+    SuccessOrQuit(sBrowseError);
+
+    Log("Browse(%s) -> %s", name.AsCString(), fromCache ? "cache hit" : "cache miss");
+
+    return fromCache;
+}
+
+void TestDnsClientCache(void)
+{
+    otDnsQueryConfig config;
+    otDnsQueryConfig rlocConfig;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnsClientCache");
+
+    InitTest();
+
+    PrepareConfig(config, *otThreadGetMeshLocalEid(sInstance));
+    PrepareConfig(rlocConfig, *otThreadGetRloc(sInstance));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // A response is cached and answers the next identical query.
+
+    otDnsClientClearCache(sInstance);
+
+    VerifyOrQuit(!Browse(sServiceNames[0], config));
+    VerifyOrQuit(Browse(sServiceNames[0], config));
+    VerifyOrQuit(!Browse(sServiceNames[1], config));
+    VerifyOrQuit(Browse(sServiceNames[1], config));
+    VerifyOrQuit(Browse(sServiceNames[0], config));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // The same query sent to another server is not answered from the
+    // response of the first server.
+
+    VerifyOrQuit(!Browse(sServiceNames[0], rlocConfig));
+    VerifyOrQuit(Browse(sServiceNames[0], rlocConfig));
+    VerifyOrQuit(Browse(sServiceNames[0], config));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // A cached response expires after the TTL of its records.
+
+    otDnsClientClearCache(sInstance);
+
+    VerifyOrQuit(!Browse(sServiceNames[0], config));
+    AdvanceTime(sBrowseExpireTime - sNow - 1);
+    VerifyOrQuit(Browse(sServiceNames[0], config));
+    AdvanceTime(1);
+    VerifyOrQuit(!Browse(sServiceNames[0], config));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // When all entries are used, the least recently used one is
+    // evicted.
+
+    otDnsClientClearCache(sInstance);
+
+    for (uint16_t i = 0; i < OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES; i++)
+    {
+        VerifyOrQuit(!Browse(sServiceNames[i], config));
+    }
+
+    VerifyOrQuit(Browse(sServiceNames[0], config));
+    VerifyOrQuit(!Browse(sServiceNames[kNumSmallServices - 1], config));
+
+    for (uint16_t i = 0; i < kNumSmallServices; i++)
+    {
+        if (i != 1)
+        {
+            VerifyOrQuit(Browse(sServiceNames[i], config));
+        }
+    }
+
+    VerifyOrQuit(!Browse(sServiceNames[1], config));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Least recently used entries are evicted to keep the total size
+    // of the cached responses within the byte budget, even when there
+    // are unused entries.
+
+    otDnsClientClearCache(sInstance);
+
+    VerifyOrQuit(!Browse(sServiceNames[kNumSmallServices], config));
+    VerifyOrQuit(!Browse(sServiceNames[kNumSmallServices + 1], config));
+    VerifyOrQuit(Browse(sServiceNames[kNumSmallServices], config));
+    VerifyOrQuit(!Browse(sServiceNames[kNumSmallServices + 2], config));
+
+    VerifyOrQuit(Browse(sServiceNames[kNumSmallServices], config));
+    VerifyOrQuit(Browse(sServiceNames[kNumSmallServices + 2], config));
+    VerifyOrQuit(!Browse(sServiceNames[kNumSmallServices + 1], config));
+
+    otDnsClientClearCache(sInstance);
+
+    Log("Finalizing OT instance");
+    testFreeInstance(sInstance);
+
+    Log("End of TestDnsClientCache");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+static constexpr uint16_t kNumManyServices = 16;
+
+static const char kManyServiceLabel[] = "_many._udp";
+
+static Srp::Client::Service sManyServices[kNumManyServices];
+static char                 sManyInstanceNames[kNumManyServices][Dns::Name::kMaxLabelSize];
+
+static uint16_t sResponseLength          = 0;
+static uint16_t sResponseAnswerCount     = 0;
+static uint16_t sResponseAdditionalCount = 0;
+
+void HandleDnsResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    const Message &message = AsCoreType(aMessage);
+    Dns::Header    header;
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(aContext == sInstance);
+
+    SuccessOrQuit(message.Read(message.GetOffset(), header));
+    VerifyOrQuit(header.GetType() == Dns::Header::kTypeResponse);
+    VerifyOrQuit(header.GetResponseCode() == Dns::Header::kResponseSuccess);
+
+    sResponseLength          = message.GetLength() - message.GetOffset();
+    sResponseAnswerCount     = header.GetAnswerCount();
+    sResponseAdditionalCount = header.GetAdditionalRecordCount();
+}
+
+void SendPtrQuery(const char *aServiceName)
+{
+    // Sends a PTR query for the given service name directly to the
+    // DNS-SD server and waits for its response.
+
+    Ip6::Udp::Socket socket(*sInstance);
+    Ip6::MessageInfo messageInfo;
+    Message         *message;
+    Dns::Header      header;
+
+    SuccessOrQuit(socket.Open(HandleDnsResponse, sInstance));
+    SuccessOrQuit(socket.Bind(0));
+
+    message = socket.NewMessage(0);
+    VerifyOrQuit(message != nullptr);
+
+    header.Clear();
+    header.SetMessageId(0x1234);
+    header.SetType(Dns::Header::kTypeQuery);
+    header.SetQueryType(Dns::Header::kQueryTypeStandard);
+    header.SetQuestionCount(1);
+
+    SuccessOrQuit(message->Append(header));
+    SuccessOrQuit(Dns::Name::AppendName(aServiceName, *message));
+    SuccessOrQuit(message->Append(Dns::Question(Dns::ResourceRecord::kTypePtr)));
+
+    messageInfo.SetPeerAddr(AsCoreType(otThreadGetMeshLocalEid(sInstance)));
+    messageInfo.SetPeerPort(OPENTHREAD_CONFIG_DNSSD_SERVER_PORT);
+
+    sResponseLength = 0;
+    SuccessOrQuit(socket.SendTo(*message, messageInfo));
+
+    AdvanceTime(100);
+    VerifyOrQuit(sResponseLength > 0);
+
+    SuccessOrQuit(socket.Close());
+}
+
+void TestDnssdServerResponseSize(void)
+{
+    static constexpr uint16_t kPointerSize = sizeof(uint16_t);
+
+    Srp::Client             *srpClient;
+    const Srp::Server::Host *host;
+    uint8_t                  numAddresses;
+    uint16_t                 instanceNameSize;
+    uint16_t                 hostNameSize;
+    uint16_t                 maxLength;
+    String<64>               serviceName;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnssdServerResponseSize");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register more instances of a service than the name compressor
+    // can remember names for.
+
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    for (uint16_t i = 0; i < kNumManyServices; i++)
+    {
+        Srp::Client::Service &service = sManyServices[i];
+
+        snprintf(sManyInstanceNames[i], sizeof(sManyInstanceNames[i]), "many-%02u", i);
+
+        memset(&service, 0, sizeof(service));
+        service.mName         = kManyServiceLabel;
+        service.mInstanceName = sManyInstanceNames[i];
+        service.mPort         = 2000 + i;
+
+        SuccessOrQuit(srpClient->AddService(service));
+    }
+
+    AdvanceTime(20000);
+
+    for (Srp::Client::Service &service : sManyServices)
+    {
+        VerifyOrQuit(service.GetState() == Srp::Client::kRegistered);
+    }
+
+    host = sInstance->Get<Srp::Server>().GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(host->GetAddresses(numAddresses) != nullptr);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Browse for the service. The response has a PTR record for each
+    // instance in the answer section and its SRV and TXT records along
+    // with the host AAAA records in the additional section.
+
+    serviceName.Append("%s.default.service.arpa.", kManyServiceLabel);
+    SendPtrQuery(serviceName.AsCString());
+
+    Log("Response length %u", sResponseLength);
+
+    VerifyOrQuit(sResponseAnswerCount == kNumManyServices);
+    VerifyOrQuit(sResponseAdditionalCount == 2 * kNumManyServices + numAddresses);
+
+    // Every name after the question must be compressed to at most one
+    // label followed by a pointer. The host name is used by every SRV
+    // record, and the TXT and AAAA records directly follow a record
+    // with the same name, so once appended these names must be a
+    // single pointer. Each service then adds a bounded number of bytes
+    // to the response, however many there are.
+
+    instanceNameSize = sizeof(uint8_t) + StringLength(sManyInstanceNames[0], Dns::Name::kMaxLabelSize) + kPointerSize;
+    hostNameSize     = sizeof(uint8_t) + sizeof(kHostName) - 1 + kPointerSize;
+
+    maxLength = sizeof(Dns::Header) + serviceName.GetLength() + sizeof(uint8_t) + sizeof(Dns::Question);
+    maxLength += kNumManyServices * (kPointerSize + sizeof(Dns::PtrRecord) + instanceNameSize);
+    maxLength += kNumManyServices * (instanceNameSize + sizeof(Dns::SrvRecord) + kPointerSize);
+    maxLength += hostNameSize - kPointerSize;
+    maxLength += kNumManyServices * (kPointerSize + sizeof(Dns::TxtRecord) + sizeof(uint8_t));
+    maxLength += numAddresses * (kPointerSize + sizeof(Dns::AaaaRecord));
+
+    VerifyOrQuit(sResponseLength <= maxLength);
+
+    Log("Finalizing OT instance");
+    testFreeInstance(sInstance);
+
+    Log("End of TestDnssdServerResponseSize");
+}
+
+#endif // ENABLE_DNS_CACHE_TEST
+
+int main(void)
+{
+#if ENABLE_DNS_CACHE_TEST
+    TestDnsClientCache();
+    TestDnssdServerResponseSize();
+    printf("All tests passed\n");
+#else
+    printf("DNS_CLIENT_CACHE or SRP/DNSSD server feature is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -32,6 +32,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "common/random.hpp"
 #include "utils/flash.hpp"
 
 #include "test_platform.h"
@@ -186,11 +187,121 @@ void TestFlash(void)
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 }
 
+void TestFlashRandomOperations(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+    // Applies random `Add()`/`Set()`/`Delete()` operations and compares
+    // the results of `Get()` against a simple model of the stored values.
+    // The number of live records grows beyond the record index budget
+    // between swaps, so both the indexed and the scanning paths are used.
+
+    static constexpr uint16_t kNumKeys       = 4;
+    static constexpr uint16_t kMaxValues     = 8;
+    static constexpr uint16_t kMaxLength     = 16;
+    static constexpr uint16_t kNumIterations = 4000;
+
+    struct Value
+    {
+        uint8_t  mData[kMaxLength];
+        uint16_t mLength;
+    };
+
+    Value    values[kNumKeys][kMaxValues];
+    uint16_t numValues[kNumKeys];
+    uint8_t  readBuffer[kMaxLength];
+
+    Instance *instance = testInitInstance();
+    Flash     flash(*instance);
+
+    memset(numValues, 0, sizeof(numValues));
+
+    flash.Init();
+    flash.Wipe();
+
+    for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+    {
+        uint16_t key   = Random::NonCrypto::GetUint16InRange(0, kNumKeys);
+        uint8_t  op    = Random::NonCrypto::GetUint8InRange(0, 8);
+        uint16_t count = numValues[key];
+
+        if (op < 4 && count < kMaxValues)
+        {
+            Value &value = values[key][count];
+
+            value.mLength = Random::NonCrypto::GetUint16InRange(0, kMaxLength + 1);
+            Random::NonCrypto::FillBuffer(value.mData, value.mLength);
+
+            // `Set()` on a key with more than one value would leave the
+            // superseded values visible at higher indexes, so only use it
+            // when the key holds at most a single value.
+
+            if (op == 0 && count <= 1)
+            {
+                SuccessOrQuit(flash.Set(key, value.mData, value.mLength));
+                values[key][0] = value;
+                numValues[key] = 1;
+            }
+            else
+            {
+                SuccessOrQuit(flash.Add(key, value.mData, value.mLength));
+                numValues[key]++;
+            }
+        }
+        else if (op < 7)
+        {
+            int index = Random::NonCrypto::GetUint8InRange(0, kMaxValues);
+
+            if (index < count)
+            {
+                SuccessOrQuit(flash.Delete(key, index));
+                memmove(&values[key][index], &values[key][index + 1], (count - index - 1) * sizeof(Value));
+                numValues[key]--;
+            }
+            else
+            {
+                VerifyOrQuit(flash.Delete(key, index) == kErrorNotFound);
+            }
+        }
+        else if (Random::NonCrypto::GetUint8InRange(0, 8) == 0)
+        {
+            VerifyOrQuit(flash.Delete(key, -1) == ((count > 0) ? kErrorNone : kErrorNotFound));
+            numValues[key] = 0;
+        }
+        else
+        {
+            // Re-initialize as done on reboot.
+            flash.Init();
+        }
+
+        for (uint16_t k = 0; k < kNumKeys; k++)
+        {
+            for (uint16_t index = 0; index <= numValues[k]; index++)
+            {
+                uint16_t length = sizeof(readBuffer);
+
+                if (index == numValues[k])
+                {
+                    VerifyOrQuit(flash.Get(k, index, readBuffer, &length) == kErrorNotFound);
+                    VerifyOrQuit(length == 0);
+                    continue;
+                }
+
+                SuccessOrQuit(flash.Get(k, index, readBuffer, &length));
+                VerifyOrQuit(length == values[k][index].mLength, "Get() did not return expected length");
+                VerifyOrQuit(memcmp(readBuffer, values[k][index].mData, length) == 0,
+                             "Get() did not return expected value");
+            }
+        }
+    }
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestFlash();
+    ot::TestFlashRandomOperations();
     printf("All tests passed\n");
     return 0;
 }
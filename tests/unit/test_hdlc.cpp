@@ -641,6 +641,109 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void TestBulkEncoderDecoder(void)
+{
+    static constexpr uint16_t kSmallBufferSize = 64;
+    static constexpr uint16_t kFcsSize         = 2;
+
+    static const uint8_t kSpecialBytes[] = {kFlagXOn, kFlagXOff, kFlagSequence, kEscapeSequence, kFlagSpecial};
+
+    uint16_t                            length;
+    uint8_t                             frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kBufferSize>      bulkBuffer;
+    Hdlc::FrameBuffer<kBufferSize>      byteBuffer;
+    Hdlc::FrameBuffer<kBufferSize>      decoderBuffer;
+    Hdlc::FrameBuffer<kSmallBufferSize> smallBuffer;
+    DecoderContext                      decoderContext;
+    Hdlc::Encoder                       bulkEncoder(bulkBuffer);
+    Hdlc::Encoder                       byteEncoder(byteBuffer);
+    Hdlc::Decoder                       decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    Hdlc::Decoder                       smallDecoder(smallBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder bulk paths against byte-wise processing");
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration / 10; iter++)
+    {
+        uint16_t offset;
+
+        bulkBuffer.Clear();
+        byteBuffer.Clear();
+
+        length = static_cast<uint16_t>(GetRandom(kMaxFrameLength - 1)) + 1;
+
+        // Use a varying density of bytes which need escaping,
+        // from none at all up to every byte.
+
+        for (uint16_t i = 0, density = static_cast<uint16_t>(GetRandom(8)); i < length; i++)
+        {
+            frame[i] = ((density != 0) && (GetRandom(density * density) == 0))
+                           ? kSpecialBytes[GetRandom(sizeof(kSpecialBytes))]
+                           : static_cast<uint8_t>(GetRandom(256));
+        }
+
+        SuccessOrQuit(bulkEncoder.BeginFrame());
+        SuccessOrQuit(bulkEncoder.Encode(frame, length));
+        SuccessOrQuit(bulkEncoder.EndFrame());
+
+        SuccessOrQuit(byteEncoder.BeginFrame());
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            SuccessOrQuit(byteEncoder.Encode(frame[i]));
+        }
+
+        SuccessOrQuit(byteEncoder.EndFrame());
+
+        VerifyOrQuit(bulkBuffer.GetLength() == byteBuffer.GetLength(), "Bulk and byte-wise encoded lengths differ");
+        VerifyOrQuit(memcmp(bulkBuffer.GetFrame(), byteBuffer.GetFrame(), bulkBuffer.GetLength()) == 0,
+                     "Bulk and byte-wise encoded frames differ");
+
+        // Decode the frame fed in randomly sized chunks.
+
+        decoderBuffer.Clear();
+        decoderContext.mWasCalled = false;
+
+        for (offset = 0; offset < bulkBuffer.GetLength();)
+        {
+            uint16_t chunkLength = static_cast<uint16_t>(GetRandom(bulkBuffer.GetLength() - offset)) + 1;
+
+            decoder.Decode(bulkBuffer.GetFrame() + offset, chunkLength);
+            offset += chunkLength;
+        }
+
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+        VerifyOrQuit(decoderBuffer.GetLength() == length, "Decoded frame length does not match original frame");
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, length) == 0,
+                     "Decoded frame content does not match original frame");
+
+        // Decode into a small buffer and check that the partially
+        // decoded frame matches on `OT_ERROR_NO_BUFS`.
+
+        smallBuffer.Clear();
+        decoderContext.mWasCalled = false;
+        smallDecoder.Reset();
+        smallDecoder.Decode(bulkBuffer.GetFrame(), bulkBuffer.GetLength());
+
+        VerifyOrQuit(decoderContext.mWasCalled);
+
+        if (length + kFcsSize > kSmallBufferSize)
+        {
+            VerifyOrQuit(decoderContext.mError == OT_ERROR_NO_BUFS, "Decoder::Decode() did not fail with small buffer");
+            VerifyOrQuit(smallBuffer.GetLength() == kSmallBufferSize);
+            VerifyOrQuit(memcmp(smallBuffer.GetFrame(), frame, OT_MIN(length, kSmallBufferSize)) == 0,
+                         "Partially decoded frame content does not match original frame");
+        }
+        else
+        {
+            VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+            VerifyOrQuit(smallBuffer.GetLength() == length);
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -650,6 +753,7 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestBulkEncoderDecoder();
     printf("\nAll tests passed.\n");
     return 0;
 }
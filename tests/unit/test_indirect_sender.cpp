@@ -0,0 +1,377 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "net/ip6_headers.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+
+static Instance *sInstance;
+
+static constexpr uint16_t kNumChildren = 4;
+
+static Child *sChildren[kNumChildren];
+
+class UnitTester
+{
+public:
+    static bool IsInSendQueue(const Message *aMessage)
+    {
+        // Only compares pointers, so `aMessage` is not accessed if it
+        // was freed.
+
+        bool found = false;
+
+        for (const Message &message : sInstance->Get<MeshForwarder>().mSendQueue)
+        {
+            if (&message == aMessage)
+            {
+                found = true;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+    static void VerifyChildQueues(void)
+    {
+        // Checks that every child queue entry references a message in
+        // the send queue which is destined to the child, and that (if
+        // the queue is not overflowed) the queue has all the messages
+        // for the child in their send queue order.
+
+        IndirectSender &sender = sInstance->Get<IndirectSender>();
+
+        for (uint16_t childIndex = 0; childIndex < GetArrayLength(sender.mChildQueues); childIndex++)
+        {
+            const IndirectSender::ChildQueue &queue = sender.mChildQueues[childIndex];
+            const IndirectSender::QueueEntry *entry = queue.mHead;
+            const IndirectSender::QueueEntry *tail  = nullptr;
+
+            for (; entry != nullptr; entry = entry->GetNext())
+            {
+                VerifyOrQuit(IsInSendQueue(entry->mMessage), "child queue references a freed message");
+                VerifyOrQuit(entry->mMessage->GetChildMask(childIndex));
+                tail = entry;
+            }
+
+            VerifyOrQuit(queue.mTail == tail);
+
+            if (queue.mOverflowed)
+            {
+                VerifyOrQuit(queue.mHead == nullptr);
+                continue;
+            }
+
+            entry = queue.mHead;
+
+            for (Message &message : sInstance->Get<MeshForwarder>().mSendQueue)
+            {
+                if (message.GetChildMask(childIndex))
+                {
+                    VerifyOrQuit((entry != nullptr) && (entry->mMessage == &message), "child queue is out of order");
+                    entry = entry->GetNext();
+                }
+            }
+
+            VerifyOrQuit(entry == nullptr);
+        }
+    }
+
+    static Message *FindIndirectMessageInSendQueue(Child &aChild)
+    {
+        uint16_t childIndex = sInstance->Get<ChildTable>().GetChildIndex(aChild);
+        Message *msg        = nullptr;
+
+        for (Message &message : sInstance->Get<MeshForwarder>().mSendQueue)
+        {
+            if (message.GetChildMask(childIndex))
+            {
+                msg = &message;
+                break;
+            }
+        }
+
+        return msg;
+    }
+
+    static void VerifyIndirectMessages(void)
+    {
+        for (Child *child : sChildren)
+        {
+            VerifyOrQuit(sInstance->Get<IndirectSender>().FindIndirectMessage(*child) ==
+                         FindIndirectMessageInSendQueue(*child));
+        }
+    }
+
+    static Message *NewMessage(Message::Priority aPriority, const char *aDestination)
+    {
+        Message     *message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+        Ip6::Header  header;
+        Ip6::Address address;
+
+        VerifyOrQuit(message != nullptr);
+
+        header.InitVersionTrafficClassFlow();
+        header.SetPayloadLength(0);
+        header.SetNextHeader(Ip6::kProtoUdp);
+        header.SetHopLimit(64);
+        SuccessOrQuit(address.FromString("fd00::1234"));
+        header.SetSource(address);
+        SuccessOrQuit(address.FromString(aDestination));
+        header.SetDestination(address);
+
+        SuccessOrQuit(message->Append(header));
+        SuccessOrQuit(message->SetPriority(aPriority));
+        message->SetTimestampToNow();
+
+        sInstance->Get<MeshForwarder>().mSendQueue.Enqueue(*message);
+
+        return message;
+    }
+
+    static void AddForChildren(Message &aMessage, uint16_t aFirstChild, uint16_t aNumChildren)
+    {
+        for (uint16_t i = aFirstChild; i < aFirstChild + aNumChildren; i++)
+        {
+            sInstance->Get<IndirectSender>().AddMessageForSleepyChild(aMessage, *sChildren[i]);
+        }
+    }
+
+    static void ClearAllMessages(void)
+    {
+        for (Child *child : sChildren)
+        {
+            sInstance->Get<IndirectSender>().ClearAllMessagesForSleepyChild(*child);
+        }
+
+        VerifyOrQuit(sInstance->Get<MeshForwarder>().mSendQueue.GetHead() == nullptr);
+        VerifyChildQueues();
+    }
+
+    static void TestIndirectSenderChildQueues(void)
+    {
+        MeshForwarder &forwarder = sInstance->Get<MeshForwarder>();
+        Message       *multicast;
+        Message       *message;
+        Ip6::Address   eid;
+
+        printf("\nTestIndirectSenderChildQueues");
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Enqueue messages with different priorities for several
+        // children, including a multicast message for all of them.
+
+        multicast = NewMessage(Message::kPriorityNormal, "ff03::1");
+        AddForChildren(*multicast, 0, kNumChildren);
+
+        for (uint16_t i = 0; i < 3 * kNumChildren; i++)
+        {
+            static const Message::Priority kPriorities[] = {Message::kPriorityLow, Message::kPriorityNormal,
+                                                            Message::kPriorityHigh};
+
+            message = NewMessage(kPriorities[i % GetArrayLength(kPriorities)], "fd00::abcd");
+            AddForChildren(*message, i % kNumChildren, 1);
+        }
+
+        VerifyChildQueues();
+        VerifyIndirectMessages();
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Evict the multicast message.
+
+        forwarder.RemoveMessage(*multicast);
+        VerifyChildQueues();
+        VerifyIndirectMessages();
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Evict a message queued for a child which is no longer valid.
+
+        message = NewMessage(Message::kPriorityHigh, "ff03::1");
+        AddForChildren(*message, 0, kNumChildren);
+        VerifyChildQueues();
+
+        sChildren[1]->SetState(Child::kStateInvalid);
+        forwarder.RemoveMessage(*message);
+        VerifyChildQueues();
+        sChildren[1]->SetState(Child::kStateValid);
+        VerifyIndirectMessages();
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Drop a message (also queued for a child) whose address
+        // resolution failed.
+
+        message = NewMessage(Message::kPriorityNormal, "fd00::beef");
+        message->SetDirectTransmission();
+        message->SetResolvingAddress(true);
+        AddForChildren(*message, 2, 1);
+        VerifyChildQueues();
+
+        SuccessOrQuit(eid.FromString("fd00::beef"));
+        forwarder.HandleResolved(eid, kErrorDrop);
+        VerifyOrQuit(!IsInSendQueue(message));
+        VerifyChildQueues();
+        VerifyIndirectMessages();
+
+#if OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Remove aged messages. A multicast message also queued for
+        // children only has its direct tx dropped.
+
+        message = NewMessage(Message::kPriorityNormal, "ff03::1");
+        message->SetDirectTransmission();
+        message->SetTimestamp(TimerMilli::GetNow() - MeshForwarder::kTimeInQueueDropMsg);
+        AddForChildren(*message, 0, kNumChildren);
+        VerifyChildQueues();
+
+        SuccessOrQuit(forwarder.RemoveAgedMessages());
+        VerifyOrQuit(IsInSendQueue(message));
+        VerifyOrQuit(!message->IsDirectTransmission());
+        VerifyChildQueues();
+        VerifyIndirectMessages();
+#endif
+
+        ClearAllMessages();
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestIndirectSenderChildQueueOverflow(void)
+    {
+        static constexpr uint16_t kNumMessages = IndirectSender::kQueueEntries / kNumChildren + 1;
+
+        MeshForwarder  &forwarder = sInstance->Get<MeshForwarder>();
+        IndirectSender &sender    = sInstance->Get<IndirectSender>();
+        Message        *messages[kNumMessages];
+        bool            didOverflow;
+
+        printf("\nTestIndirectSenderChildQueueOverflow");
+
+        // Queue more messages for the children than there are queue
+        // entries. The children whose queue overflows fall back to
+        // searching the send queue.
+
+        for (Message *&message : messages)
+        {
+            message = NewMessage(Message::kPriorityNormal, "ff03::1");
+            AddForChildren(*message, 0, kNumChildren);
+            VerifyChildQueues();
+            VerifyIndirectMessages();
+        }
+
+        didOverflow = false;
+
+        for (Child *child : sChildren)
+        {
+            didOverflow |= sender.mChildQueues[sInstance->Get<ChildTable>().GetChildIndex(*child)].mOverflowed;
+        }
+
+        VerifyOrQuit(didOverflow);
+
+        // Evict the messages one by one. Once a child has no more
+        // messages, its queue is used again.
+
+        for (Message *message : messages)
+        {
+            forwarder.RemoveMessage(*message);
+            VerifyChildQueues();
+            VerifyIndirectMessages();
+        }
+
+        for (Child *child : sChildren)
+        {
+            VerifyOrQuit(!sender.mChildQueues[sInstance->Get<ChildTable>().GetChildIndex(*child)].mOverflowed);
+        }
+
+        messages[0] = NewMessage(Message::kPriorityNormal, "ff03::1");
+        AddForChildren(*messages[0], 0, kNumChildren);
+
+        for (Child *child : sChildren)
+        {
+            VerifyOrQuit(sender.mChildQueues[sInstance->Get<ChildTable>().GetChildIndex(*child)].mHead != nullptr);
+        }
+
+        VerifyChildQueues();
+        ClearAllMessages();
+
+        printf(" -- PASS\n");
+    }
+};
+
+void TestIndirectSender(void)
+{
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        Mac::ExtAddress extAddress;
+
+        sChildren[i] = sInstance->Get<ChildTable>().GetNewChild();
+        VerifyOrQuit(sChildren[i] != nullptr);
+
+        extAddress.GenerateRandom();
+        sChildren[i]->SetExtAddress(extAddress);
+        sChildren[i]->SetRloc16(0x1401 + i);
+        sChildren[i]->SetState(Child::kStateValid);
+        VerifyOrQuit(!sChildren[i]->IsRxOnWhenIdle());
+    }
+
+    UnitTester::TestIndirectSenderChildQueues();
+    UnitTester::TestIndirectSenderChildQueueOverflow();
+
+    testFreeInstance(sInstance);
+}
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_INDIRECT_QUEUE_INDEX_ENABLE
+    ot::TestIndirectSender();
+    printf("\nAll tests passed.\n");
+#else
+    printf("INDIRECT_QUEUE_INDEX feature is not enabled\n");
+#endif
+    return 0;
+}
@@ -28,34 +28,47 @@
 
 #include <openthread/config.h>
 
+#include <string.h>
+
 #include <openthread/mqttsn.h>
+#include <openthread/tasklet.h>
 #include "common/code_utils.hpp"
-#include "mqttsn/mqttsn_gateway_list.hpp"
 
 #include "test_platform.h"
 #include "test_util.h"
 
+#if OPENTHREAD_CONFIG_MQTTSN_ENABLE
+
+#include "common/instance.hpp"
+#include "mqttsn/mqttsn_client.hpp"
+#include "mqttsn/mqttsn_gateway_list.hpp"
+#include "mqttsn/mqttsn_serializer.hpp"
+
 using namespace ot::Mqttsn;
 
 #define TIMER_STARTUP_TIME 1000000
 
+// Maximum packet size used by the MQTT-SN client.
+#define MAX_PACKET_SIZE 255
+
+static const uint8_t kPublishMessageType = 0x0c;
+
 static uint32_t sNow;
 
-static uint32_t testTimerAlarmGetNow(void)
+extern "C" {
+
+uint32_t otPlatAlarmMilliGetNow(void)
 {
     return sNow;
 }
 
+} // extern "C"
+
 static void SetNow(uint32_t millis)
 {
     sNow = millis;
 }
 
-void InitTestTimer(void)
-{
-    g_testPlatAlarmGetNow  = testTimerAlarmGetNow;
-}
-
 template <typename ItemType>
 static StaticListEntry<ItemType> *ListFind(StaticArrayList<ItemType> &list, const ItemType &value)
 {
@@ -280,9 +293,220 @@ void TestActiveGatewayListInfoRemovedAfterKeepaliveTimeout(void)
     VerifyOrQuit(list.GetList().Size() == 0, "GatewayInfo not removed");
 }
 
+static void CheckPublishHeader(const PublishMessage &aPublishMessage)
+{
+    uint8_t buffer[MAX_PACKET_SIZE];
+    uint8_t packet[MAX_PACKET_SIZE];
+    int32_t length        = -1;
+    int32_t headerLength  = -1;
+    int32_t payloadLength = aPublishMessage.GetPayloadLength();
+
+    SuccessOrQuit(aPublishMessage.SerializeHeader(packet, sizeof(packet), &headerLength),
+                  "PublishMessage::SerializeHeader() failed");
+    VerifyOrQuit(headerLength > 0 && headerLength <= PublishMessage::kMaxHeaderLength,
+                 "SerializeHeader() returned invalid length");
+
+    if (headerLength + payloadLength > MAX_PACKET_SIZE)
+    {
+        // The full serializer cannot produce packets exceeding the client buffer size
+        VerifyOrQuit(aPublishMessage.Serialize(buffer, sizeof(buffer), &length) != OT_ERROR_NONE,
+                     "Serialize() should fail");
+        return;
+    }
+
+    memcpy(packet + headerLength, aPublishMessage.GetPayload(), static_cast<size_t>(payloadLength));
+
+    SuccessOrQuit(aPublishMessage.Serialize(buffer, sizeof(buffer), &length), "PublishMessage::Serialize() failed");
+    VerifyOrQuit(length == headerLength + payloadLength, "SerializeHeader() length differs from Serialize()");
+    VerifyOrQuit(memcmp(buffer, packet, static_cast<size_t>(length)) == 0,
+                 "SerializeHeader() bytes differ from Serialize()");
+}
+
+void TestPublishSerializeHeader(void)
+{
+    const uint16_t kPayloadLengths[] = {0, 1, 100, 247, 248, 249, 250, 251, 300};
+    const Qos      kQosLevels[]      = {kQos0, kQos1, kQos2};
+    uint8_t        payload[300];
+    Topic          topics[3];
+
+    printf("\nTest 10: Test PublishMessage::SerializeHeader() matches Serialize()\n");
+
+    for (uint16_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    topics[0] = Topic::FromTopicId(0x1234);
+    topics[1] = Topic::FromShortTopicName("ab");
+    topics[2] = Topic::FromPredefinedTopicId(0x0102);
+
+    for (Topic &topic : topics)
+    {
+        for (Qos qos : kQosLevels)
+        {
+            for (uint16_t payloadLength : kPayloadLengths)
+            {
+                PublishMessage publishMessage(false, false, qos, 0x5678, topic, payload, payloadLength);
+
+                CheckPublishHeader(publishMessage);
+
+                publishMessage.SetDupFlag(true);
+                publishMessage.SetRetainedFlag(true);
+                CheckPublishHeader(publishMessage);
+            }
+        }
+    }
+
+    // QoS -1 is allowed only with predefined topic ID and zero message ID
+    for (uint16_t payloadLength : kPayloadLengths)
+    {
+        PublishMessage publishMessage(false, true, kQosm1, 0, topics[2], payload, payloadLength);
+
+        CheckPublishHeader(publishMessage);
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestPublishSerializeHeaderLengthBoundary(void)
+{
+    uint8_t payload[300];
+    uint8_t header[PublishMessage::kMaxHeaderLength];
+    int32_t headerLength = -1;
+
+    printf("\nTest 11: Test PublishMessage::SerializeHeader() length field boundary\n");
+
+    memset(payload, 0, sizeof(payload));
+
+    // 248 bytes of payload with 6 bytes of fixed fields and 1 length byte is the largest one byte length packet
+    {
+        PublishMessage publishMessage(false, false, kQos0, 0, Topic::FromTopicId(1), payload, 248);
+
+        SuccessOrQuit(publishMessage.SerializeHeader(header, sizeof(header), &headerLength),
+                      "PublishMessage::SerializeHeader() failed");
+        VerifyOrQuit(headerLength == 7, "SerializeHeader() returned invalid length");
+        VerifyOrQuit(header[0] == 255, "Invalid one byte length field");
+        VerifyOrQuit(header[1] == kPublishMessageType, "Invalid message type");
+    }
+
+    // From here on the length field is encoded as 0x01 followed by a 16-bit length
+    {
+        PublishMessage publishMessage(false, false, kQos0, 0, Topic::FromTopicId(1), payload, 249);
+
+        SuccessOrQuit(publishMessage.SerializeHeader(header, sizeof(header), &headerLength),
+                      "PublishMessage::SerializeHeader() failed");
+        VerifyOrQuit(headerLength == 9, "SerializeHeader() returned invalid length");
+        VerifyOrQuit(header[0] == 0x01 && header[1] == 0x01 && header[2] == 0x00, "Invalid three byte length field");
+        VerifyOrQuit(header[3] == kPublishMessageType, "Invalid message type");
+    }
+
+    {
+        PublishMessage publishMessage(false, false, kQos0, 0, Topic::FromTopicId(1), payload, 300);
+
+        SuccessOrQuit(publishMessage.SerializeHeader(header, sizeof(header), &headerLength),
+                      "PublishMessage::SerializeHeader() failed");
+        VerifyOrQuit(headerLength == 9, "SerializeHeader() returned invalid length");
+        VerifyOrQuit(header[0] == 0x01 && header[1] == 0x01 && header[2] == 0x35, "Invalid three byte length field");
+    }
+
+    printf(" -- PASS\n");
+}
+
+static uint16_t GetQueueDepth(MqttsnClient &aClient)
+{
+    otMqttsnPublishTopicStats stats;
+
+    VerifyOrQuit(aClient.GetPublishTopicStats(&stats, 1) == 1, "GetPublishTopicStats() failed");
+    return stats.mQueueDepth;
+}
+
+static void ProcessTasklets(ot::Instance &aInstance)
+{
+    // The client process task posts itself again on every run
+    otTaskletsProcess(&aInstance);
+}
+
+void TestPublishBatching(void)
+{
+    const uint16_t   kPort         = 10000;
+    const uint32_t   kLingerTime   = 1000;
+    const Topic      kTopic        = Topic::FromPredefinedTopicId(1);
+    ot::Instance    *instance;
+    ot::Ip6::Address address;
+    uint8_t          payload[100];
+
+    printf("\nTest 12: Test PUBLISH batching flushes on linger time and byte budget\n");
+
+    memset(payload, 0xaa, sizeof(payload));
+    SuccessOrQuit(address.FromString("fd00::1"), "Address::FromString() failed");
+
+    // Start close to the wrap of the millisecond counter so that the batch deadline wraps
+    SetNow(0xffffffff - kLingerTime / 2);
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    MqttsnClient &client = instance->Get<MqttsnClient>();
+
+    SuccessOrQuit(client.Start(kPort), "MqttsnClient::Start() failed");
+    SuccessOrQuit(client.SetPublishBatching(kLingerTime, 0), "MqttsnClient::SetPublishBatching() failed");
+
+    // Messages are held in the batch until the linger time of the first one elapses
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        SuccessOrQuit(client.PublishQosm1(payload, sizeof(payload), false, kTopic, address, kPort),
+                      "MqttsnClient::PublishQosm1() failed");
+        ProcessTasklets(*instance);
+        VerifyOrQuit(GetQueueDepth(client) == i + 1, "PUBLISH message was not batched");
+    }
+
+    SetNow(sNow + kLingerTime - 1);
+    ProcessTasklets(*instance);
+    VerifyOrQuit(GetQueueDepth(client) == 3, "Batch flushed before linger time elapsed");
+
+    SetNow(sNow + 1);
+    ProcessTasklets(*instance);
+    VerifyOrQuit(GetQueueDepth(client) == 0, "Batch not flushed after linger time elapsed");
+
+    // Reaching the byte budget flushes the batch before the linger time elapses
+    SuccessOrQuit(client.SetPublishBatching(kLingerTime, 2 * sizeof(payload) + sizeof(payload) / 2),
+                  "MqttsnClient::SetPublishBatching() failed");
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        SuccessOrQuit(client.PublishQosm1(payload, sizeof(payload), false, kTopic, address, kPort),
+                      "MqttsnClient::PublishQosm1() failed");
+        ProcessTasklets(*instance);
+        VerifyOrQuit(GetQueueDepth(client) == i + 1, "Batch flushed before byte budget reached");
+    }
+
+    SuccessOrQuit(client.PublishQosm1(payload, sizeof(payload), false, kTopic, address, kPort),
+                  "MqttsnClient::PublishQosm1() failed");
+    ProcessTasklets(*instance);
+    VerifyOrQuit(GetQueueDepth(client) == 0, "Batch not flushed after byte budget reached");
+
+    // Disabling batching sends held messages right away
+    SuccessOrQuit(client.PublishQosm1(payload, sizeof(payload), false, kTopic, address, kPort),
+                  "MqttsnClient::PublishQosm1() failed");
+    VerifyOrQuit(GetQueueDepth(client) == 1, "PUBLISH message was not batched");
+    SuccessOrQuit(client.SetPublishBatching(0, 0), "MqttsnClient::SetPublishBatching() failed");
+    VerifyOrQuit(GetQueueDepth(client) == 0, "Batch not flushed when batching disabled");
+
+    // Sending itself fails since the device is not attached, only check the message was not held
+    IgnoreError(client.PublishQosm1(payload, sizeof(payload), false, kTopic, address, kPort));
+    VerifyOrQuit(GetQueueDepth(client) == 0, "PUBLISH message batched when batching disabled");
+
+    SuccessOrQuit(client.Stop(), "MqttsnClient::Stop() failed");
+    testFreeInstance(instance);
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_CONFIG_MQTTSN_ENABLE
+
 int main(void)
 {
-    InitTestTimer();
+#if OPENTHREAD_CONFIG_MQTTSN_ENABLE
     TestListAddMultipleItems();
     TestListSize();
     TestListRemoveHead();
@@ -292,6 +516,12 @@ int main(void)
     TestListAddToFullListAfterRemove();
     TestActiveGatewayListInfoNotRemovedBeforeKeepaliveTimeout();
     TestActiveGatewayListInfoRemovedAfterKeepaliveTimeout();
+    TestPublishSerializeHeader();
+    TestPublishSerializeHeaderLengthBoundary();
+    TestPublishBatching();
     printf("\nAll tests passed.\n");
+#else
+    printf("MQTTSN feature is not enabled\n");
+#endif
     return 0;
 }
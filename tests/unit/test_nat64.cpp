@@ -46,6 +46,41 @@ namespace BorderRouter {
 
 static ot::Instance *sInstance;
 
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    printf("AdvanceTime for %u.%03u\n", aDuration / 1000, aDuration % 1000);
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        otTaskletsProcess(sInstance);
+        sNow = sAlarmTime;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    otTaskletsProcess(sInstance);
+    sNow = time;
+}
+
 void DumpMessageInHex(const char *prefix, const uint8_t *aBuf, size_t aBufLen)
 {
     // This function dumps all packets the output of this function can be imported to packet analyser for debugging.
@@ -141,6 +176,30 @@ void TestCase4To6(const char *aTestName,
     printf("  ... PASS\n");
 }
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+// Returns the number of mappings using the translated port or ICMP echo ID `aTranslatedPortOrId`, only counting the
+// mappings with `aRemainingTimeMs` left when it is not zero.
+uint16_t CountMappings(uint16_t aTranslatedPortOrId, uint32_t aRemainingTimeMs = 0)
+{
+    Nat64::Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping                     mapping;
+    uint16_t                                  count = 0;
+
+    sInstance->Get<Nat64::Translator>().InitAddressMappingIterator(iterator);
+
+    while (sInstance->Get<Nat64::Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone)
+    {
+        if ((mapping.mTranslatedPortOrId == aTranslatedPortOrId) &&
+            ((aRemainingTimeMs == 0) || (mapping.mRemainingTimeMs == aRemainingTimeMs)))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+#endif
+
 void TestNat64(void)
 {
     Ip6::Prefix  nat64prefix;
@@ -188,9 +247,33 @@ void TestNat64(void)
             0x00, 0x00, 0x00, 0x01, 0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
         };
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        // With port translation, fd02::1 is only mapped on its source port (43981).
+        OT_UNUSED_VARIABLE(kIp6Packet);
+        TestCase4To6("v4 udp datagram to unmapped port", kIp4Packet, Nat64::Translator::kDrop, nullptr, 0);
+#else
         TestCase4To6("good v4 udp datagram", kIp4Packet, Nat64::Translator::kForward, kIp6Packet, sizeof(kIp6Packet));
+#endif
     }
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    {
+        // 172.16.243.197        192.168.123.1         UDP      32     4660 → 43981 Len=4
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x11, 0xa0,
+                                      0x4d, 172,  16,   243,  197,  192,  168,  123,  1,    0x12, 0x34,
+                                      0xab, 0xcd, 0x00, 0x0c, 0xa1, 0x8d, 0x61, 0x62, 0x63, 0x64};
+        // fd01::ac10:f3c5       fd02::1               UDP      52     4660 → 43981 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x3f, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 172,  16,   243,  197,  0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x01, 0x12, 0x34, 0xab, 0xcd, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase4To6("good v4 udp reply datagram", kIp4Packet, Nat64::Translator::kForward, kIp6Packet,
+                     sizeof(kIp6Packet));
+    }
+#endif
+
     {
         // fd02::1               fd01::ac10:f3c5       TCP      64     43981 → 4660 [ACK] Seq=1 Ack=1 Win=1 Len=4
         const uint8_t kIp6Packet[] = {
@@ -222,8 +305,34 @@ void TestNat64(void)
             0x12, 0x34, 0x56, 0x78, 0x50, 0x10, 0x00, 0x01, 0x5f, 0xf8, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64,
         };
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        // With port translation, fd02::1 is only mapped on its source port (43981).
+        OT_UNUSED_VARIABLE(kIp6Packet);
+        TestCase4To6("v4 tcp datagram to unmapped port", kIp4Packet, Nat64::Translator::kDrop, nullptr, 0);
+#else
         TestCase4To6("good v4 tcp datagram", kIp4Packet, Nat64::Translator::kForward, kIp6Packet, sizeof(kIp6Packet));
+#endif
+    }
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    {
+        // 172.16.243.197        192.168.123.1         TCP      44     4660 → 43981 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x9f,
+                                      0x4c, 172,  16,   243,  197,  192,  168,  123,  1,    0x12, 0x34,
+                                      0xab, 0xcd, 0x87, 0x65, 0x43, 0x21, 0x12, 0x34, 0x56, 0x78, 0x50,
+                                      0x10, 0x00, 0x01, 0x1e, 0x54, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64};
+        // fd01::ac10:f3c5       fd02::1               TCP      64     4660 → 43981 [ACK] Seq=1 Ack=1 Win=1 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x40, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 172,  16,   243,  197,  0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x34, 0xab, 0xcd, 0x87, 0x65, 0x43, 0x21,
+            0x12, 0x34, 0x56, 0x78, 0x50, 0x10, 0x00, 0x01, 0x5f, 0xf8, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase4To6("good v4 tcp reply datagram", kIp4Packet, Nat64::Translator::kForward, kIp6Packet,
+                     sizeof(kIp6Packet));
     }
+#endif
 
     {
         // fd02::1         fd01::ac10:f3c5     ICMPv6   52     Echo (ping) request id=0xaabb, seq=1, hop limit=64
@@ -257,6 +366,18 @@ void TestNat64(void)
                      sizeof(kIp6Packet));
     }
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    {
+        // 172.16.243.197        192.168.123.1         ICMP     36     Destination unreachable (Host unreachable)
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0xa0, 0x59,
+                                      172,  16,   243,  197,  192,  168,  123,  1,    0x03, 0x01, 0x73, 0x71,
+                                      0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64, 0x61, 0x62, 0x63, 0x64};
+
+        // Only ICMP echo messages carry an identifier which can be translated.
+        TestCase4To6("v4 icmp error datagram", kIp4Packet, Nat64::Translator::kDrop, nullptr, 0);
+    }
+#endif
+
     {
         // fd02::1               N/A                   IPv6     39     Invalid IPv6 header
         const uint8_t kIp6Packet[] = {0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00,
@@ -291,8 +412,96 @@ void TestNat64(void)
             172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x30, 0x61, 0x62, 0x63, 0x64,
         };
 
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        // 192.168.123.1         172.16.243.197        UDP      32     1024 → 4660 Len=4
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x11, 0x9f,
+                                      0x4d, 192,  168,  123,  1,    172,  16,   243,  197,  0x04, 0x00,
+                                      0x12, 0x34, 0x00, 0x0c, 0x49, 0x5b, 0x61, 0x62, 0x63, 0x64};
+
+        TestCase6To4("port translated v6 udp datagram", kIp6Packet, Nat64::Translator::kForward, kIp4Packet,
+                     sizeof(kIp4Packet));
+#else
         TestCase6To4("mapping pool exhausted", kIp6Packet, Nat64::Translator::kDrop, nullptr, 0);
+#endif
+    }
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    {
+        // 172.16.243.197        192.168.123.1         UDP      32     4660 → 1024 Len=4
+        const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x11, 0xa0,
+                                      0x4d, 172,  16,   243,  197,  192,  168,  123,  1,    0x12, 0x34,
+                                      0x04, 0x00, 0x00, 0x0c, 0x49, 0x5b, 0x61, 0x62, 0x63, 0x64};
+        // fd01::ac10:f3c5       fd02::2               UDP      52     4660 → 43981 Len=4
+        const uint8_t kIp6Packet[] = {
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x3f, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 172,  16,   243,  197,  0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x02, 0x12, 0x34, 0xab, 0xcd, 0x00, 0x0c, 0xe3, 0x30, 0x61, 0x62, 0x63, 0x64,
+        };
+
+        TestCase4To6("port translated v4 udp datagram", kIp4Packet, Nat64::Translator::kForward, kIp6Packet,
+                     sizeof(kIp6Packet));
+    }
+
+    {
+        Nat64::Translator::AddressMappingIterator iterator;
+        otNat64AddressMapping                     mapping;
+        uint16_t                                  numMappings = 0;
+
+        // fd02::1 has one mapping for each of UDP, TCP and ICMP, fd02::2 shares 192.168.123.1 on another UDP port.
+        sInstance->Get<Nat64::Translator>().InitAddressMappingIterator(iterator);
+
+        while (sInstance->Get<Nat64::Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone)
+        {
+            VerifyOrQuit(AsCoreType(&mapping.mIp4) == AsCoreType(&nat64cidr.mAddress));
+
+            if (mapping.mIp6.mFields.m8[15] == 2)
+            {
+                VerifyOrQuit(mapping.mSrcPortOrId == 43981);
+                VerifyOrQuit(mapping.mTranslatedPortOrId == 1024);
+            }
+            else
+            {
+                VerifyOrQuit(mapping.mSrcPortOrId == mapping.mTranslatedPortOrId);
+            }
+
+            numMappings++;
+        }
+
+        VerifyOrQuit(numMappings == 4);
+    }
+
+    {
+        // Each mapping expires after the idle timeout of its own protocol. The mappings above were all created at the
+        // same time, so check their remaining time, then let the ICMP, UDP and TCP mappings expire in turn.
+        static_assert(Nat64::Translator::kIcmpMappingIdleTimeoutMsec < Nat64::Translator::kUdpMappingIdleTimeoutMsec,
+                      "the test expects ICMP mappings to expire before UDP mappings");
+        static_assert(Nat64::Translator::kUdpMappingIdleTimeoutMsec < Nat64::Translator::kTcpMappingIdleTimeoutMsec,
+                      "the test expects UDP mappings to expire before TCP mappings");
+
+        printf("Testing NAT64 per-protocol idle timeouts\n");
+
+        VerifyOrQuit(CountMappings(0xaabb, Nat64::Translator::kIcmpMappingIdleTimeoutMsec) == 1);
+        VerifyOrQuit(CountMappings(43981, Nat64::Translator::kUdpMappingIdleTimeoutMsec) == 1);
+        VerifyOrQuit(CountMappings(1024, Nat64::Translator::kUdpMappingIdleTimeoutMsec) == 1);
+        VerifyOrQuit(CountMappings(43981, Nat64::Translator::kTcpMappingIdleTimeoutMsec) == 1);
+
+        // The expirer runs at the shortest idle timeout, so it releases a mapping within two of those periods.
+        AdvanceTime(2 * Nat64::Translator::kIcmpMappingIdleTimeoutMsec);
+        VerifyOrQuit(CountMappings(0xaabb) == 0);
+        VerifyOrQuit(CountMappings(43981) == 2);
+        VerifyOrQuit(CountMappings(1024) == 1);
+
+        AdvanceTime(Nat64::Translator::kUdpMappingIdleTimeoutMsec);
+        VerifyOrQuit(CountMappings(1024) == 0);
+        VerifyOrQuit(CountMappings(43981) == 1);
+        VerifyOrQuit(CountMappings(43981, Nat64::Translator::kTcpMappingIdleTimeoutMsec - sNow) == 1);
+
+        AdvanceTime(Nat64::Translator::kTcpMappingIdleTimeoutMsec);
+        VerifyOrQuit(CountMappings(43981) == 0);
+
+        printf("  ... PASS\n");
     }
+#endif
 
     testFreeInstance(sInstance);
 }
@@ -31,6 +31,7 @@
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/random.hpp"
 #include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 #include "thread/network_data_service.hpp"
@@ -922,6 +923,284 @@ void TestNetworkDataDsnSrpAnycastSeqNumSelection(void)
     testFreeInstance(instance);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+class FibTestLeader : public Leader
+{
+public:
+    void Populate(const uint8_t *aTlvs, uint8_t aTlvsLength)
+    {
+        memcpy(GetBytes(), aTlvs, aTlvsLength);
+        SetLength(aTlvsLength);
+        SignalNetDataChanged();
+    }
+
+    using LeaderBase::IsOnMeshInTlvs;
+    using LeaderBase::RouteLookupInTlvs;
+};
+
+static const char *const kFibTestPrefixes[] = {"fd00:1:2:3::", "fd00:1:2:4::", "fd00:1::", "2001:db8:1::"};
+
+static void GenerateFibTestAddress(Ip6::Address &aAddress)
+{
+    SuccessOrQuit(aAddress.FromString(
+        kFibTestPrefixes[Random::NonCrypto::GetUint8InRange(0, GetArrayLength(kFibTestPrefixes))]));
+
+    // Randomize some of the bits so the address may only match the shorter prefixes.
+
+    aAddress.mFields.m8[Random::NonCrypto::GetUint8InRange(4, 8)] ^= (1 << Random::NonCrypto::GetUint8InRange(0, 8));
+    Random::NonCrypto::FillBuffer(&aAddress.mFields.m8[8], 8);
+}
+
+static uint8_t GenerateFibTestNetworkData(uint8_t *aTlvs, uint8_t aMaxLength, const uint16_t (&aRlocs)[4])
+{
+    static const uint8_t kPrefixLengths[] = {0, 16, 32, 48, 56, 64};
+
+    uint8_t length      = 0;
+    uint8_t numPrefixes = Random::NonCrypto::GetUint8InRange(1, 7);
+
+    for (uint8_t prefixIndex = 0; prefixIndex < numPrefixes; prefixIndex++)
+    {
+        uint8_t      prefixLength;
+        uint8_t      prefixSize;
+        uint8_t      tlvStart = length;
+        Ip6::Address prefix;
+
+        prefixLength = kPrefixLengths[Random::NonCrypto::GetUint8InRange(0, GetArrayLength(kPrefixLengths))];
+        prefixSize   = BitVectorBytes(prefixLength);
+
+        VerifyOrExit(length + sizeof(PrefixTlv) + prefixSize <= aMaxLength);
+
+        SuccessOrQuit(prefix.FromString(
+            kFibTestPrefixes[Random::NonCrypto::GetUint8InRange(0, GetArrayLength(kFibTestPrefixes))]));
+
+        aTlvs[length++] = (NetworkDataTlv::kTypePrefix << 1) | Random::NonCrypto::GetUint8InRange(0, 2);
+        aTlvs[length++] = 0;
+        aTlvs[length++] = Random::NonCrypto::GetUint8InRange(0, 2); // Domain ID
+        aTlvs[length++] = prefixLength;
+        memcpy(&aTlvs[length], prefix.GetBytes(), prefixSize);
+        length += prefixSize;
+
+        // Add Has Route and Border Router sub-TLVs, each with up to
+        // two entries with random RLOC16, preference and flags.
+
+        for (uint8_t subTlvIndex = Random::NonCrypto::GetUint8InRange(0, 4); subTlvIndex > 0; subTlvIndex--)
+        {
+            bool    isBorderRouter = (Random::NonCrypto::GetUint8InRange(0, 2) != 0);
+            uint8_t type           = isBorderRouter ? NetworkDataTlv::kTypeBorderRouter : NetworkDataTlv::kTypeHasRoute;
+            uint8_t entrySize      = isBorderRouter ? sizeof(BorderRouterEntry) : sizeof(HasRouteEntry);
+            uint8_t numEntries     = Random::NonCrypto::GetUint8InRange(0, 3);
+
+            VerifyOrExit(length + sizeof(NetworkDataTlv) + numEntries * entrySize <= aMaxLength);
+
+            aTlvs[length++] = static_cast<uint8_t>(type << 1) | Random::NonCrypto::GetUint8InRange(0, 2);
+            aTlvs[length++] = numEntries * entrySize;
+
+            for (uint8_t entryIndex = 0; entryIndex < numEntries; entryIndex++)
+            {
+                uint16_t rloc16 = aRlocs[Random::NonCrypto::GetUint8InRange(0, GetArrayLength(aRlocs))];
+
+                aTlvs[length++] = static_cast<uint8_t>(rloc16 >> 8);
+                aTlvs[length++] = static_cast<uint8_t>(rloc16 & 0xff);
+
+                // Preference (two bits), then on-mesh and default route
+                // flags for a Border Router entry.
+
+                aTlvs[length++] = Random::NonCrypto::GetUint8();
+
+                if (isBorderRouter)
+                {
+                    aTlvs[length++] = 0;
+                }
+            }
+        }
+
+        aTlvs[tlvStart + 1] = length - tlvStart - sizeof(NetworkDataTlv);
+    }
+
+exit:
+    return length;
+}
+
+void TestNetworkDataFib(void)
+{
+    static constexpr uint16_t kIterations         = 500;
+    static constexpr uint8_t  kLookupsPerIteration = 50;
+
+    Instance *instance;
+    uint8_t   tlvs[NetworkData::kMaxSize];
+    uint16_t  numRoutes = 0;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataFib()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        // Include the device's own RLOC16 (zero path cost) so that
+        // the tie-breaks between routes with same preference are
+        // also covered.
+
+        const uint16_t kRlocs[4] = {0x2800, 0x4c00, 0x6c01, instance->Get<Mle::MleRouter>().GetRloc16()};
+
+        FibTestLeader &leader = reinterpret_cast<FibTestLeader &>(instance->Get<Leader>());
+
+        for (uint16_t iteration = 0; iteration < kIterations; iteration++)
+        {
+            uint8_t length = GenerateFibTestNetworkData(tlvs, sizeof(tlvs), kRlocs);
+
+            leader.Populate(tlvs, length);
+
+            for (uint8_t lookup = 0; lookup < kLookupsPerIteration; lookup++)
+            {
+                Ip6::Address source;
+                Ip6::Address destination;
+                uint16_t     rloc16      = Mac::kShortAddrInvalid;
+                uint16_t     tlvsRloc16  = Mac::kShortAddrInvalid;
+                Error        error;
+
+                GenerateFibTestAddress(source);
+                GenerateFibTestAddress(destination);
+
+                VerifyOrQuit(leader.IsOnMesh(destination) == leader.IsOnMeshInTlvs(destination));
+
+                error = leader.RouteLookup(source, destination, rloc16);
+                VerifyOrQuit(error == leader.RouteLookupInTlvs(source, destination, tlvsRloc16));
+                VerifyOrQuit(rloc16 == tlvsRloc16);
+
+                if (error == kErrorNone)
+                {
+                    numRoutes++;
+                }
+            }
+        }
+    }
+
+    printf("Found %u routes in %u lookups\n", numRoutes, kIterations * kLookupsPerIteration);
+    VerifyOrQuit(numRoutes > 0);
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+
+void TestNetworkDataContextTable(void)
+{
+    class TestLeader : public Leader
+    {
+    public:
+        void Populate(const uint8_t *aTlvs, uint8_t aTlvsLength)
+        {
+            memcpy(GetBytes(), aTlvs, aTlvsLength);
+            SetLength(aTlvsLength);
+            SignalNetDataChanged();
+        }
+    };
+
+    struct AddressTest
+    {
+        const char *mAddress;
+        Error       mError;
+        uint8_t     mContextId;
+        uint8_t     mPrefixLength;
+    };
+
+    const uint8_t kNetworkData[] = {
+        0x03, 0x0a, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x01,                         // Prefix fd00:1::/32
+        0x07, 0x02, 0x11, 0x20,                                                 // Context ID 1, C = TRUE
+        0x03, 0x0c, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x02,             // Prefix fd00:1:2::/48
+        0x07, 0x02, 0x02, 0x30,                                                 // Context ID 2, C = FALSE
+        0x03, 0x0c, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x02,             // Prefix fd00:1:2::/48
+        0x07, 0x02, 0x13, 0x30,                                                 // Context ID 3, C = TRUE
+        0x03, 0x0e, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, // Prefix fd00:1:2:3::/64
+        0x07, 0x02, 0x12, 0x40,                                                 // Context ID 2, C = TRUE
+        0x03, 0x0c, 0x00, 0x20, 0x20, 0x01, 0x0d, 0xb8,                         // Prefix 2001:db8::/32
+        0x05, 0x04, 0x5c, 0x00, 0x31, 0x00,                                     // Border Router sub-TLV
+    };
+
+    const AddressTest kAddressTests[] = {
+        {"fd00:1:2:3::1", kErrorNone, 2, 64},    // Longest match
+        {"fd00:1:2:4::1", kErrorNone, 2, 48},    // First of the two /48 prefixes
+        {"fd00:1:5::1", kErrorNone, 1, 32},      // Shortest match
+        {"2001:db8::1", kErrorNotFound, 0, 0},   // Prefix without context
+        {"fd00:2::1", kErrorNotFound, 0, 0},     // No matching prefix
+        {"fd00:1:2:3::ff", kErrorNone, 2, 64},   // Longest match
+        {"fd00:1:ffff::1", kErrorNone, 1, 32},   // Shortest match
+        {"2001:db8:1::1", kErrorNotFound, 0, 0}, // Prefix without context
+    };
+
+    Instance       *instance;
+    Lowpan::Context context;
+    Ip6::Address    address;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataContextTable()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        TestLeader &leader = reinterpret_cast<TestLeader &>(instance->Get<Leader>());
+
+        leader.Populate(kNetworkData, sizeof(kNetworkData));
+
+        for (const AddressTest &test : kAddressTests)
+        {
+            SuccessOrQuit(address.FromString(test.mAddress));
+            VerifyOrQuit(leader.GetContext(address, context) == test.mError);
+
+            if (test.mError == kErrorNone)
+            {
+                printf("\n%-16s -> context %u, %s", test.mAddress, context.mContextId,
+                       context.mPrefix.ToString().AsCString());
+                VerifyOrQuit(context.mIsValid);
+                VerifyOrQuit(context.mContextId == test.mContextId);
+                VerifyOrQuit(context.mPrefix.GetLength() == test.mPrefixLength);
+                VerifyOrQuit(address.MatchesPrefix(context.mPrefix));
+            }
+        }
+
+        // Mesh-local address uses the mesh-local prefix context (ID zero).
+
+        address.SetPrefix(instance->Get<Mle::MleRouter>().GetMeshLocalPrefix());
+        SuccessOrQuit(leader.GetContext(address, context));
+        VerifyOrQuit(context.mContextId == Mle::kMeshLocalPrefixContextId);
+        VerifyOrQuit(context.mCompressFlag);
+
+        // Lookup by Context ID finds the first Prefix TLV with the ID.
+
+        SuccessOrQuit(leader.GetContext(2, context));
+        VerifyOrQuit(context.mPrefix.GetLength() == 48);
+        VerifyOrQuit(!context.mCompressFlag);
+
+        SuccessOrQuit(leader.GetContext(3, context));
+        VerifyOrQuit(context.mPrefix.GetLength() == 48);
+        VerifyOrQuit(context.mCompressFlag);
+
+        SuccessOrQuit(leader.GetContext(Mle::kMeshLocalPrefixContextId, context));
+        VerifyOrQuit(context.mPrefix.GetLength() == Ip6::NetworkPrefix::kLength);
+
+        VerifyOrQuit(leader.GetContext(4, context) == kErrorNotFound);
+        VerifyOrQuit(leader.GetContext(15, context) == kErrorNotFound);
+
+        // After the Network Data changes, the contexts are removed.
+
+        leader.Populate(kNetworkData, 0);
+        SuccessOrQuit(address.FromString("fd00:1:2:3::1"));
+        VerifyOrQuit(leader.GetContext(address, context) == kErrorNotFound);
+        VerifyOrQuit(leader.GetContext(2, context) == kErrorNotFound);
+    }
+
+    printf("\n");
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+
 } // namespace NetworkData
 } // namespace ot
 
@@ -933,6 +1212,12 @@ int main(void)
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
+#if OPENTHREAD_CONFIG_NETDATA_FIB_ENABLE
+    ot::NetworkData::TestNetworkDataFib();
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    ot::NetworkData::TestNetworkDataContextTable();
+#endif
 
     printf("\nAll tests passed\n");
     return 0;
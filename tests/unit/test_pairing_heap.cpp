@@ -0,0 +1,228 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.hpp"
+
+#include "common/instance.hpp"
+#include "common/pairing_heap.hpp"
+#include "common/random.hpp"
+
+namespace ot {
+
+class Entry
+{
+    friend class PairingHeap<Entry>;
+
+public:
+    Entry(void)
+        : mValue(0)
+        , mNext(this)
+        , mChild(nullptr)
+        , mPrev(nullptr)
+    {
+    }
+
+    uint32_t GetValue(void) const { return mValue; }
+    void     SetValue(uint32_t aValue) { mValue = aValue; }
+
+private:
+    uint32_t mValue;
+    Entry   *mNext;
+    Entry   *mChild;
+    Entry   *mPrev;
+};
+
+class ValueOrder
+{
+public:
+    bool IsBefore(const Entry &aFirstEntry, const Entry &aSecondEntry) const
+    {
+        return aFirstEntry.GetValue() < aSecondEntry.GetValue();
+    }
+};
+
+static constexpr uint16_t kNumEntries = 200;
+
+// Returns the smallest value of the entries which are in the heap
+// (or `NumericLimits<uint32_t>::kMax` if there are none).
+uint32_t FindMinValue(const Entry *aEntries)
+{
+    uint32_t minValue = NumericLimits<uint32_t>::kMax;
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        if (PairingHeap<Entry>::IsInHeap(aEntries[i]) && (aEntries[i].GetValue() < minValue))
+        {
+            minValue = aEntries[i].GetValue();
+        }
+    }
+
+    return minValue;
+}
+
+void VerifyHead(PairingHeap<Entry> &aHeap, const Entry *aEntries)
+{
+    uint32_t minValue = FindMinValue(aEntries);
+
+    if (minValue == NumericLimits<uint32_t>::kMax)
+    {
+        VerifyOrQuit(aHeap.IsEmpty());
+        VerifyOrQuit(aHeap.GetHead() == nullptr);
+    }
+    else
+    {
+        VerifyOrQuit(!aHeap.IsEmpty());
+        VerifyOrQuit(aHeap.GetHead()->GetValue() == minValue);
+    }
+}
+
+void TestPairingHeap(void)
+{
+    Instance          *instance;
+    PairingHeap<Entry> heap;
+    Entry              entries[kNumEntries];
+    uint32_t           prevValue;
+
+    printf("TestPairingHeap\n");
+
+    // The instance initializes the random number generator.
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    VerifyOrQuit(heap.IsEmpty());
+    VerifyOrQuit(heap.GetHead() == nullptr);
+
+    for (const Entry &entry : entries)
+    {
+        VerifyOrQuit(!PairingHeap<Entry>::IsInHeap(entry));
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Add all entries with random values (with some duplicates), then
+    // remove them from the head, verifying the order.
+
+    for (Entry &entry : entries)
+    {
+        entry.SetValue(Random::NonCrypto::GetUint32InRange(0, kNumEntries / 2));
+        heap.Add(entry, ValueOrder());
+        VerifyOrQuit(PairingHeap<Entry>::IsInHeap(entry));
+        VerifyHead(heap, entries);
+    }
+
+    prevValue = 0;
+
+    while (!heap.IsEmpty())
+    {
+        Entry *head = heap.GetHead();
+
+        VerifyOrQuit(head->GetValue() >= prevValue);
+        prevValue = head->GetValue();
+
+        heap.Remove(*head, ValueOrder());
+        VerifyOrQuit(!PairingHeap<Entry>::IsInHeap(*head));
+        VerifyHead(heap, entries);
+    }
+
+    printf(" - Add and remove head: PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Add all entries, then remove and re-add random entries (with
+    // new values) and remove entries which are not in the heap.
+
+    for (Entry &entry : entries)
+    {
+        entry.SetValue(Random::NonCrypto::GetUint32());
+        heap.Add(entry, ValueOrder());
+    }
+
+    for (uint16_t iter = 0; iter < 5 * kNumEntries; iter++)
+    {
+        Entry &entry = entries[Random::NonCrypto::GetUint16InRange(0, kNumEntries)];
+
+        heap.Remove(entry, ValueOrder());
+        VerifyOrQuit(!PairingHeap<Entry>::IsInHeap(entry));
+        VerifyHead(heap, entries);
+
+        // Removing an entry which is not in the heap is a no-op.
+        heap.Remove(entry, ValueOrder());
+        VerifyHead(heap, entries);
+
+        if (Random::NonCrypto::GetUint8() & 1)
+        {
+            entry.SetValue(Random::NonCrypto::GetUint32());
+            heap.Add(entry, ValueOrder());
+            VerifyOrQuit(PairingHeap<Entry>::IsInHeap(entry));
+            VerifyHead(heap, entries);
+        }
+    }
+
+    printf(" - Remove and re-add random entries: PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove all entries.
+
+    heap.RemoveAll();
+    VerifyOrQuit(heap.IsEmpty());
+
+    for (const Entry &entry : entries)
+    {
+        VerifyOrQuit(!PairingHeap<Entry>::IsInHeap(entry));
+    }
+
+    for (Entry &entry : entries)
+    {
+        heap.Add(entry, ValueOrder());
+    }
+
+    VerifyHead(heap, entries);
+
+    heap.RemoveAll();
+    VerifyOrQuit(heap.IsEmpty());
+
+    for (const Entry &entry : entries)
+    {
+        VerifyOrQuit(!PairingHeap<Entry>::IsInHeap(entry));
+    }
+
+    printf(" - RemoveAll: PASS\n");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestPairingHeap();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "test_util.hpp"
+
+#include "common/rate_meter.hpp"
+
+namespace ot {
+
+void TestRateMeter(void)
+{
+    static constexpr uint32_t kWindow = 1000;
+
+    RateMeter<kWindow> meter;
+    TimeMilli          start(0xfffffc00); // Close to wrap around.
+    TimeMilli          now = start;
+
+    printf("TestRateMeter\n");
+
+    meter.Start(now);
+    VerifyOrQuit(meter.GetRate(now) == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Events in the current window are not reported until it completes.
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        meter.Count(now);
+        now += 100;
+    }
+
+    VerifyOrQuit(meter.GetRate(now) == 0);
+
+    now = start + kWindow;
+    VerifyOrQuit(meter.GetRate(now) == 5);
+    VerifyOrQuit(meter.GetRate(now + kWindow - 1) == 5);
+
+    printf(" - Completed window: PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Counting in the next window keeps reporting the completed one.
+
+    meter.Count(now + 10);
+    meter.Count(now + 20);
+    VerifyOrQuit(meter.GetRate(now + 30) == 5);
+
+    now += kWindow;
+    VerifyOrQuit(meter.GetRate(now) == 2);
+
+    printf(" - Next window: PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // The rate drops to zero once a whole window elapses without any
+    // event, whether or not an event is counted afterwards.
+
+    now += kWindow;
+    VerifyOrQuit(meter.GetRate(now) == 0);
+    VerifyOrQuit(meter.GetRate(now + 100 * kWindow) == 0);
+
+    now += 100 * kWindow + 10;
+    meter.Count(now);
+    VerifyOrQuit(meter.GetRate(now) == 0);
+    VerifyOrQuit(meter.GetRate(now + kWindow) == 1);
+    VerifyOrQuit(meter.GetRate(now + 2 * kWindow) == 0);
+
+    printf(" - Decay: PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestRateMeter();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
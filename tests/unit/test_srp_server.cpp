@@ -89,6 +89,16 @@ otError otPlatRadioTransmit(otInstance *, otRadioFrame *)
 
 otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *) { return &sRadioTxFrame; }
 
+otRadioCaps otPlatRadioGetCaps(otInstance *)
+{
+    // Let the radio handle CSMA backoff and retries so that frames are
+    // passed to `otPlatRadioTransmit()` right away. The lease expiry
+    // test runs for hours of simulated time and the send queue must
+    // be drained.
+
+    return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF | OT_RADIO_CAPS_TRANSMIT_RETRIES;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // `otPlatAlaram`
 
@@ -104,7 +114,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 12000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 void *otPlatCAlloc(size_t aNum, size_t aSize)
@@ -192,6 +202,7 @@ void InitTest(void)
 
     memset(&sRadioTxFrame, 0, sizeof(sRadioTxFrame));
     sRadioTxFrame.mPsdu = sRadioTxFramePsdu;
+    sRadioTxOngoing     = false;
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Initialize Border Router and start Thread operation.
@@ -689,6 +700,749 @@ void TestSrpServerIgnore(void)
     Log("End of TestSrpServerIgnore");
 }
 
+void ValidateLeases(Srp::Server &aServer)
+{
+    // Validate that no registered host or service has an overdue
+    // LEASE or KEY-LEASE, i.e., each one is either removed or deleted
+    // as soon as its lease expires.
+
+    for (const Srp::Server::Host *host = aServer.GetNextHost(nullptr); host != nullptr;
+         host                          = aServer.GetNextHost(host))
+    {
+        const Srp::Server::Service *service = nullptr;
+        Srp::Server::LeaseInfo      leaseInfo;
+
+        host->GetLeaseInfo(leaseInfo);
+        VerifyOrQuit(leaseInfo.mRemainingKeyLease > 0);
+        VerifyOrQuit(host->IsDeleted() || (leaseInfo.mRemainingLease > 0));
+
+        while ((service = host->FindNextService(service)) != nullptr)
+        {
+            service->GetLeaseInfo(leaseInfo);
+            VerifyOrQuit(leaseInfo.mRemainingKeyLease > 0);
+            VerifyOrQuit(service->IsDeleted() || (leaseInfo.mRemainingLease > 0));
+            VerifyOrQuit(!host->IsDeleted() || service->IsDeleted());
+        }
+    }
+}
+
+void TestSrpServerLeaseExpiryAtScale(void)
+{
+    // The hosts register one after the other (taking about three
+    // seconds each) and outlive the registration of all the others.
+    // Every KEY-LEASE is longer than the LEASE of its host. The
+    // internal heap only fits a few dozen hosts, so the full scale
+    // (where walking all the hosts and services on every lease event
+    // would show) needs the external heap.
+
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    static constexpr uint16_t kNumHosts           = 500;
+    static constexpr uint16_t kNumServicesPerHost = 4;
+#else
+    static constexpr uint16_t kNumHosts           = 50;
+    static constexpr uint16_t kNumServicesPerHost = 2;
+#endif
+    static constexpr uint32_t kMinLease     = 60; // in seconds
+    static constexpr uint32_t kLeaseStep    = 7;  // in seconds
+    static constexpr uint32_t kKeyLeaseStep = 3;  // in seconds
+    static constexpr uint32_t kMaxKeyLease =
+        kMinLease + (kNumHosts + 1) * kLeaseStep + kNumHosts * kKeyLeaseStep; // in seconds
+
+    Srp::Server         *srpServer;
+    Srp::Client         *srpClient;
+    Srp::Client::Service services[kNumServicesPerHost];
+    char                 hostName[32];
+    char                 instanceNames[kNumServicesPerHost][32];
+    uint16_t             heapAllocations;
+    uint16_t             numHosts;
+    uint16_t             numServices;
+    uint16_t             numDeletedHosts;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerLeaseExpiryAtScale");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    sUpdateHandlerMode = kAccept;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register many hosts, each with a few services. After each
+    // registration the client forgets the host (without removing it
+    // from the server) so the next host can be registered. Later hosts
+    // get shorter leases, so the hosts expire in the reverse order of
+    // their registration.
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        uint32_t lease = kMinLease + (kNumHosts - i) * kLeaseStep;
+
+        snprintf(hostName, sizeof(hostName), "lq-host-%u", i);
+
+        srpClient->SetLeaseInterval(lease);
+        srpClient->SetKeyLeaseInterval(kMaxKeyLease - i * kKeyLeaseStep);
+
+        SuccessOrQuit(srpClient->SetHostName(hostName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+        for (uint16_t j = 0; j < kNumServicesPerHost; j++)
+        {
+            snprintf(instanceNames[j], sizeof(instanceNames[j]), "lq-srv-%u-%u", i, j);
+
+            memset(&services[j], 0, sizeof(services[j]));
+            services[j].mName         = "_lq._udp";
+            services[j].mInstanceName = instanceNames[j];
+            services[j].mPort         = 1000 + j;
+
+            SuccessOrQuit(srpClient->AddService(services[j]));
+        }
+
+        sProcessedClientCallback = false;
+
+        AdvanceTime(2 * 1000);
+
+        VerifyOrQuit(sProcessedClientCallback);
+        VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+        for (const Srp::Client::Service &service : services)
+        {
+            VerifyOrQuit(service.GetState() == Srp::Client::kRegistered);
+        }
+
+        if (i % 2 == 0)
+        {
+            // Remove a service on every other host. The server retains
+            // its name until its KEY-LEASE, which expires before the
+            // KEY-LEASE of its host (refreshed by this update).
+
+            SuccessOrQuit(srpClient->RemoveService(services[0]));
+
+            sProcessedClientCallback = false;
+
+            AdvanceTime(2 * 1000);
+
+            VerifyOrQuit(sProcessedClientCallback);
+            VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+            VerifyOrQuit(services[0].GetState() == Srp::Client::kRemoved);
+        }
+
+        srpClient->ClearHostAndServices();
+        ValidateLeases(*srpServer);
+    }
+
+    numHosts    = 0;
+    numServices = 0;
+
+    for (const Srp::Server::Host *host = srpServer->GetNextHost(nullptr); host != nullptr;
+         host                          = srpServer->GetNextHost(host))
+    {
+        const Srp::Server::Service *service = nullptr;
+
+        VerifyOrQuit(!host->IsDeleted());
+
+        while ((service = host->FindNextService(service, Srp::Server::kFlagsAnyTypeActiveService)) != nullptr)
+        {
+            numServices++;
+        }
+
+        numHosts++;
+    }
+
+    VerifyOrQuit(numHosts == kNumHosts);
+    VerifyOrQuit(numServices == kNumHosts * kNumServicesPerHost - kNumHosts / 2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Advance time in one second steps and validate that every host
+    // and service is deleted when its LEASE expires and removed when
+    // its KEY-LEASE expires.
+
+    for (uint32_t sec = 0; sec <= kMaxKeyLease; sec++)
+    {
+        AdvanceTime(1000);
+        ValidateLeases(*srpServer);
+
+        if (sec == kMinLease + (kNumHosts + 1) * kLeaseStep)
+        {
+            // All the hosts are deleted, but their names are retained.
+
+            numHosts        = 0;
+            numDeletedHosts = 0;
+
+            for (const Srp::Server::Host *host = srpServer->GetNextHost(nullptr); host != nullptr;
+                 host                          = srpServer->GetNextHost(host))
+            {
+                numHosts++;
+                numDeletedHosts += host->IsDeleted() ? 1 : 0;
+            }
+
+            VerifyOrQuit(numHosts == kNumHosts);
+            VerifyOrQuit(numDeletedHosts == kNumHosts);
+        }
+    }
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    testFreeInstance(sInstance);
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerLeaseExpiryAtScale");
+}
+
+namespace ot {
+
+class UnitTester
+{
+public:
+    static void ValidateNameIndex(Srp::Server &aServer)
+    {
+        // Validates that finding hosts and services by name (using
+        // the name index when it is enabled) agrees with walking the
+        // host and service lists.
+
+        for (const Srp::Server::Host *host = aServer.GetNextHost(nullptr); host != nullptr;
+             host                          = aServer.GetNextHost(host))
+        {
+            const Srp::Server::Service *service = nullptr;
+
+            VerifyOrQuit(aServer.FindHost(host->GetFullName()) == host);
+
+            while ((service = host->FindNextService(service)) != nullptr)
+            {
+                const char *serviceName  = service->GetServiceName();
+                const char *instanceName = service->GetInstanceName();
+
+                VerifyOrQuit(IsFoundByName(aServer, *service));
+                VerifyOrQuit(CountFoundByName(aServer, serviceName, nullptr) ==
+                             CountInLists(aServer, serviceName, nullptr));
+                VerifyOrQuit(CountFoundByName(aServer, nullptr, instanceName) ==
+                             CountInLists(aServer, nullptr, instanceName));
+                VerifyOrQuit(CountFoundByName(aServer, serviceName, instanceName) ==
+                             CountInLists(aServer, serviceName, instanceName));
+            }
+        }
+    }
+
+    static bool HasHost(Srp::Server &aServer, const char *aFullName) { return aServer.FindHost(aFullName) != nullptr; }
+
+private:
+    static bool IsInLists(Srp::Server &aServer, const Srp::Server::Service &aService)
+    {
+        bool isInLists = false;
+
+        for (const Srp::Server::Host *host = aServer.GetNextHost(nullptr); host != nullptr;
+             host                          = aServer.GetNextHost(host))
+        {
+            const Srp::Server::Service *service = nullptr;
+
+            while ((service = host->FindNextService(service)) != nullptr)
+            {
+                isInLists |= (service == &aService);
+            }
+        }
+
+        return isInLists;
+    }
+
+    static bool MatchesNames(const Srp::Server::Service &aService, const char *aServiceName, const char *aInstanceName)
+    {
+        return ((aServiceName == nullptr) ||
+                StringMatch(aService.GetServiceName(), aServiceName, kStringCaseInsensitiveMatch)) &&
+               ((aInstanceName == nullptr) ||
+                StringMatch(aService.GetInstanceName(), aInstanceName, kStringCaseInsensitiveMatch));
+    }
+
+    static uint16_t CountInLists(Srp::Server &aServer, const char *aServiceName, const char *aInstanceName)
+    {
+        uint16_t count = 0;
+
+        for (const Srp::Server::Host *host = aServer.GetNextHost(nullptr); host != nullptr;
+             host                          = aServer.GetNextHost(host))
+        {
+            const Srp::Server::Service *service = nullptr;
+
+            while ((service = host->FindNextService(service)) != nullptr)
+            {
+                count += MatchesNames(*service, aServiceName, aInstanceName) ? 1 : 0;
+            }
+        }
+
+        return count;
+    }
+
+    static uint16_t CountFoundByName(Srp::Server &aServer, const char *aServiceName, const char *aInstanceName)
+    {
+        // Every service found by name must also be in the lists.
+
+        const Srp::Server::Service *service = nullptr;
+        uint16_t                    count   = 0;
+
+        while ((service = aServer.FindNextService(service, Srp::Server::kFlagsAnyService, aServiceName,
+                                                  aInstanceName)) != nullptr)
+        {
+            VerifyOrQuit(IsInLists(aServer, *service));
+            VerifyOrQuit(MatchesNames(*service, aServiceName, aInstanceName));
+            count++;
+        }
+
+        return count;
+    }
+
+    static bool IsFoundByName(Srp::Server &aServer, const Srp::Server::Service &aService)
+    {
+        const Srp::Server::Service *service = nullptr;
+        bool                        isFound = false;
+
+        while ((service = aServer.FindNextService(service, Srp::Server::kFlagsAnyService, aService.GetServiceName(),
+                                                  aService.GetInstanceName())) != nullptr)
+        {
+            isFound |= (service == &aService);
+        }
+
+        return isFound;
+    }
+};
+
+} // namespace ot
+
+void TestSrpServerNameIndex(void)
+{
+    static constexpr uint32_t kLease    = 60;  // in seconds
+    static constexpr uint32_t kKeyLease = 120; // in seconds
+
+    Srp::Server                    *srpServer;
+    Srp::Client                    *srpClient;
+    Srp::Client::Service            service1;
+    Srp::Client::Service            service2;
+    String<Dns::Name::kMaxNameSize> hostFullName;
+    uint16_t                        heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerNameIndex");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    memset(&service1, 0, sizeof(service1));
+    memset(&service2, 0, sizeof(service2));
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    sUpdateHandlerMode = kAccept;
+
+    srpClient->SetLeaseInterval(kLease);
+    srpClient->SetKeyLeaseInterval(kKeyLease);
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register a host with one service.
+
+    SuccessOrQuit(srpClient->AddService(service1));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    ValidateHost(*srpServer, kHostName);
+    hostFullName.Append("%s", srpServer->GetNextHost(nullptr)->GetFullName());
+
+    ot::UnitTester::ValidateNameIndex(*srpServer);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register a second service, the update is merged into the
+    // existing host.
+
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    ValidateHost(*srpServer, kHostName);
+    ot::UnitTester::ValidateNameIndex(*srpServer);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove the first service, the server retains its name.
+
+    SuccessOrQuit(srpClient->RemoveService(service1));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRemoved);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr)->FindNextService(nullptr, Srp::Server::kFlagsAnyTypeDeletedService) !=
+                 nullptr);
+    ot::UnitTester::ValidateNameIndex(*srpServer);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove the host and its services along with the key lease.
+
+    SuccessOrQuit(srpClient->RemoveHostAndServices(/* aShouldRemoveKeyLease */ true));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+    VerifyOrQuit(!ot::UnitTester::HasHost(*srpServer, hostFullName.AsCString()));
+    ot::UnitTester::ValidateNameIndex(*srpServer);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register the host and services again, then let the client
+    // forget them, so that they are deleted when the
+    // LEASE expires and removed when the KEY-LEASE expires.
+
+    srpClient->ClearHostAndServices();
+
+    memset(&service1, 0, sizeof(service1));
+    memset(&service2, 0, sizeof(service2));
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(service1));
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    ValidateHost(*srpServer, kHostName);
+    ot::UnitTester::ValidateNameIndex(*srpServer);
+
+    srpClient->ClearHostAndServices();
+
+    AdvanceTime(kLease * 1000);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) != nullptr);
+    VerifyOrQuit(srpServer->GetNextHost(nullptr)->IsDeleted());
+    VerifyOrQuit(ot::UnitTester::HasHost(*srpServer, hostFullName.AsCString()));
+    ot::UnitTester::ValidateNameIndex(*srpServer);
+
+    AdvanceTime((kKeyLease - kLease) * 1000);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+    VerifyOrQuit(!ot::UnitTester::HasHost(*srpServer, hostFullName.AsCString()));
+    ot::UnitTester::ValidateNameIndex(*srpServer);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    testFreeInstance(sInstance);
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerNameIndex");
+}
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Asynchronous signature verification, the requests are kept until the test reports them.
+
+struct VerifyRequest
+{
+    uint32_t                   mId;
+    otPlatCryptoEcdsaPublicKey mPublicKey;
+    otPlatCryptoSha256Hash     mHash;
+    otPlatCryptoEcdsaSignature mSignature;
+};
+
+static bool                    sAsyncVerifyEnabled = false;
+static bool                    sAsyncVerifyBusy    = false;
+static uint16_t                sNumBusyVerifyCalls = 0;
+static Array<VerifyRequest, 8> sVerifyRequests;
+
+extern "C" otError otPlatCryptoEcdsaVerifyAsync(otInstance                       *aInstance,
+                                                uint32_t                          aRequestId,
+                                                const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                                const otPlatCryptoSha256Hash     *aHash,
+                                                const otPlatCryptoEcdsaSignature *aSignature)
+{
+    VerifyRequest *request;
+
+    VerifyOrQuit(aInstance == sInstance);
+
+    if (!sAsyncVerifyEnabled)
+    {
+        return OT_ERROR_NOT_IMPLEMENTED;
+    }
+
+    if (sAsyncVerifyBusy)
+    {
+        Log("otPlatCryptoEcdsaVerifyAsync() called with %u while busy", aRequestId);
+        sNumBusyVerifyCalls++;
+        return OT_ERROR_NO_BUFS;
+    }
+
+    Log("otPlatCryptoEcdsaVerifyAsync() called with %u", aRequestId);
+
+    request = sVerifyRequests.PushBack();
+    VerifyOrQuit(request != nullptr);
+
+    request->mId        = aRequestId;
+    request->mPublicKey = *aPublicKey;
+    request->mHash      = *aHash;
+    request->mSignature = *aSignature;
+
+    return OT_ERROR_NONE;
+}
+
+void CompleteVerifyRequests(void)
+{
+    for (const VerifyRequest &request : sVerifyRequests)
+    {
+        otError error = otPlatCryptoEcdsaVerify(&request.mPublicKey, &request.mHash, &request.mSignature);
+
+        otPlatCryptoEcdsaVerifyAsyncDone(sInstance, request.mId, error);
+    }
+
+    sVerifyRequests.Clear();
+}
+
+void TestSrpServerAsyncSignatureVerify(void)
+{
+    Srp::Server         *srpServer;
+    Srp::Client         *srpClient;
+    Srp::Client::Service service1;
+    Srp::Client::Service service2;
+    uint16_t             heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerAsyncSignatureVerify");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    sAsyncVerifyEnabled = true;
+    sVerifyRequests.Clear();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register a service, validate that the update is only processed
+    // once the signature verification is reported.
+
+    SuccessOrQuit(srpClient->AddService(service1));
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sVerifyRequests.GetLength() == 1);
+    VerifyOrQuit(!sProcessedUpdateCallback);
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    CompleteVerifyRequests();
+    AdvanceTime(500);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    ValidateHost(*srpServer, kHostName);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove the service while the platform cannot take verification
+    // requests, validate that the update keeps waiting and is
+    // submitted again once the platform accepts it.
+
+    sAsyncVerifyBusy    = true;
+    sNumBusyVerifyCalls = 0;
+
+    SuccessOrQuit(srpClient->RemoveService(service1));
+
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sNumBusyVerifyCalls > 0);
+
+    AdvanceTime(500);
+
+    VerifyOrQuit(sNumBusyVerifyCalls > 1);
+    VerifyOrQuit(sVerifyRequests.IsEmpty());
+    VerifyOrQuit(!sProcessedUpdateCallback);
+    VerifyOrQuit(!sProcessedClientCallback);
+
+    sAsyncVerifyBusy = false;
+
+    AdvanceTime(200);
+
+    VerifyOrQuit(sVerifyRequests.GetLength() == 1);
+    VerifyOrQuit(!sProcessedUpdateCallback);
+
+    CompleteVerifyRequests();
+    AdvanceTime(500);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRemoved);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Report a failed verification, validate that the update is rejected.
+
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sVerifyRequests.GetLength() == 1);
+    otPlatCryptoEcdsaVerifyAsyncDone(sInstance, sVerifyRequests[0].mId, OT_ERROR_SECURITY);
+    sVerifyRequests.Clear();
+
+    AdvanceTime(100);
+
+    VerifyOrQuit(!sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError != kErrorNone);
+    VerifyOrQuit(service2.GetState() != Srp::Client::kRegistered);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server while the verifications of the retried
+    // updates are in flight, then report them.
+
+    sProcessedUpdateCallback = false;
+
+    AdvanceTime(5000);
+
+    VerifyOrQuit(!sVerifyRequests.IsEmpty());
+    VerifyOrQuit(!sProcessedUpdateCallback);
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    sProcessedUpdateCallback = false;
+
+    CompleteVerifyRequests();
+    AdvanceTime(100);
+
+    VerifyOrQuit(!sProcessedUpdateCallback);
+
+    sAsyncVerifyEnabled = false;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    testFreeInstance(sInstance);
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerAsyncSignatureVerify");
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+
 #endif // ENABLE_SRP_TEST
 
 int main(void)
@@ -697,6 +1451,11 @@ int main(void)
     TestSrpServerBase();
     TestSrpServerReject();
     TestSrpServerIgnore();
+    TestSrpServerLeaseExpiryAtScale();
+    TestSrpServerNameIndex();
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_SIGNATURE_VERIFY_ENABLE
+    TestSrpServerAsyncSignatureVerify();
+#endif
     printf("All tests passed\n");
 #else
     printf("SRP_SERVER or SRP_CLIENT feature is not enabled\n");
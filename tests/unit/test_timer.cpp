@@ -32,6 +32,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
+#include "common/new.hpp"
 #include "common/timer.hpp"
 
 enum
@@ -49,6 +50,8 @@ uint32_t sPlatDt;
 bool     sTimerOn;
 uint32_t sCallCount[kCallCountIndexMax];
 
+const ot::Timer *sLastFiredTimer;
+
 extern "C" {
 
 void otPlatAlarmMilliStop(otInstance *)
@@ -108,6 +111,7 @@ public:
     {
         sCallCount[kCallCountIndexTimerHandler]++;
         mFiredCounter++;
+        sLastFiredTimer = this;
     }
 
     uint32_t GetFiredCounter(void) { return mFiredCounter; }
@@ -579,6 +583,171 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * Test the TimerScheduler's behavior with many timers randomly started, stopped, restarted and fired (including timers
+ * with the same fire time), checking the fire order against a reference model.
+ */
+template <typename TimerType> void ManyTimers(uint32_t aTimeShift)
+{
+    static constexpr uint16_t kNumTimers   = 64;
+    static constexpr uint32_t kMaxInterval = 200;
+    static constexpr uint16_t kNumSteps    = 1000;
+
+    struct Model
+    {
+        bool     mRunning;
+        uint32_t mFireTime; // Relative to `aTimeShift`.
+        uint32_t mSequence;
+    };
+
+    alignas(TestTimer<TimerType>) static uint8_t sTimerRaw[kNumTimers][sizeof(TestTimer<TimerType>)];
+
+    ot::Instance         *instance = testInitInstance();
+    TestTimer<TimerType> *timers[kNumTimers];
+    Model                 model[kNumTimers];
+    uint32_t              now      = 0;
+    uint32_t              sequence = 0;
+    uint32_t              seed     = 0x1234567 + aTimeShift;
+    uint32_t              numFired = 0;
+
+    auto random = [&seed](uint32_t aMax) -> uint32_t {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 8) % aMax;
+    };
+
+    // Returns the index of the running timer which should fire next, or `kNumTimers` if none.
+    auto next = [&model](void) -> uint16_t {
+        uint16_t index = kNumTimers;
+
+        for (uint16_t i = 0; i < kNumTimers; i++)
+        {
+            if (!model[i].mRunning)
+            {
+                continue;
+            }
+
+            if ((index == kNumTimers) || (model[i].mFireTime < model[index].mFireTime) ||
+                ((model[i].mFireTime == model[index].mFireTime) && (model[i].mSequence < model[index].mSequence)))
+            {
+                index = i;
+            }
+        }
+
+        return index;
+    };
+
+    printf("TestManyTimers() with aTimeShift=%-10u ", aTimeShift);
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i]          = new (sTimerRaw[i]) TestTimer<TimerType>(*instance);
+        model[i].mRunning  = false;
+        model[i].mFireTime = 0;
+        model[i].mSequence = 0;
+    }
+
+    for (uint16_t step = 0; step < kNumSteps; step++)
+    {
+        uint16_t index;
+
+        // Randomly start, restart or stop a few timers. A small interval range gives many equal fire times.
+
+        for (uint16_t count = random(8); count > 0; count--)
+        {
+            index = static_cast<uint16_t>(random(kNumTimers));
+            sNow  = now + aTimeShift;
+
+            if (random(4) == 0)
+            {
+                timers[index]->Stop();
+                model[index].mRunning = false;
+            }
+            else
+            {
+                uint32_t interval = random(kMaxInterval);
+
+                timers[index]->Start(interval);
+                model[index].mRunning  = true;
+                model[index].mFireTime = now + interval;
+                model[index].mSequence = sequence++;
+            }
+        }
+
+        // Check the platform alarm is set for the next timer.
+
+        index = next();
+
+        if (index == kNumTimers)
+        {
+            VerifyOrQuit(!sTimerOn, "TestManyTimers: Platform Timer State Failed.");
+        }
+        else
+        {
+            VerifyOrQuit(sTimerOn, "TestManyTimers: Platform Timer State Failed.");
+            VerifyOrQuit(sPlatT0 + sPlatDt == model[index].mFireTime + aTimeShift,
+                         "TestManyTimers: Start params Failed.");
+        }
+
+        // Advance the time and fire all expired timers, checking they fire in the expected order.
+
+        now += random(kMaxInterval / 4);
+        sNow = now + aTimeShift;
+
+        while (sTimerOn && (sNow - sPlatT0 >= sPlatDt))
+        {
+            index           = next();
+            sLastFiredTimer = nullptr;
+
+            AlarmFired<TimerType>(instance);
+
+            if ((index != kNumTimers) && (model[index].mFireTime <= now))
+            {
+                VerifyOrQuit(sLastFiredTimer == timers[index], "TestManyTimers: Fire order Failed.");
+                VerifyOrQuit(!timers[index]->IsRunning(), "TestManyTimers: Timer running Failed.");
+                model[index].mRunning = false;
+                numFired++;
+            }
+            else
+            {
+                VerifyOrQuit(sLastFiredTimer == nullptr, "TestManyTimers: Timer fired early.");
+            }
+        }
+
+        for (uint16_t i = 0; i < kNumTimers; i++)
+        {
+            VerifyOrQuit(timers[i]->IsRunning() == model[i].mRunning, "TestManyTimers: Timer running Failed.");
+        }
+    }
+
+    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == numFired, "TestManyTimers: Handler CallCount Failed.");
+
+    for (TestTimer<TimerType> *timer : timers)
+    {
+        timer->Stop();
+    }
+
+    VerifyOrQuit(!sTimerOn, "TestManyTimers: Platform Timer State Failed.");
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+}
+
+template <typename TimerType> int TestManyTimers(void)
+{
+    const uint32_t kTimeShift[] = {0, 0U - 500U, ot::Timer::kMaxDelay};
+
+    for (uint32_t timeShift : kTimeShift)
+    {
+        ManyTimers<TimerType>(timeShift);
+    }
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -671,6 +840,7 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestManyTimers<TimerType>();
 }
 
 int main(void)
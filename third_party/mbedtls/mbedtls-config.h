@@ -42,6 +42,7 @@
 
 #define MBEDTLS_PLATFORM_SNPRINTF_MACRO snprintf
 
+#define MBEDTLS_AESNI_C
 #define MBEDTLS_AES_C
 #define MBEDTLS_AES_ROM_TABLES
 #define MBEDTLS_ASN1_PARSE_C